@@ -0,0 +1,128 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+namespace dtvm {
+
+// Makes a plain struct usable as a solidity struct:
+//
+//   struct Order {
+//     Address maker;
+//     uint256 amount;
+//     uint64_t expiry;
+//   };
+//   DTVM_ABI_STRUCT(Order, maker, amount, expiry)
+//
+// The ABI codec then encodes and decodes Order exactly like the tuple
+// (address,uint256,uint64), so it can be an argument, a return value or an
+// element of an array, and StorageStruct<Order> keeps it in storage with the
+// slot packing of solidity. The macro goes at namespace scope, in the
+// namespace of the struct, after its definition. It only lists the members
+// as pointers to members in a type, so the codec and the storage accessor
+// visit them with a fold expression, one inlined step per member.
+
+// The members of a struct, in declaration order
+template <auto... Members> struct AbiStructFields {
+  static constexpr size_t COUNT = sizeof...(Members);
+};
+
+namespace detail {
+
+template <typename T> struct MemberPointerTraits;
+
+template <typename Class, typename Value>
+struct MemberPointerTraits<Value Class::*> {
+  using class_type = Class;
+  using value_type = Value;
+};
+
+// a type per member pointer, to compare members of different types
+template <auto Member> struct MemberTag {};
+
+// found by argument dependent lookup in the namespace of the struct
+template <typename T>
+using abi_struct_fields_lookup_t =
+    decltype(dtvm_abi_struct_fields(static_cast<const T *>(nullptr)));
+
+template <typename T, typename = void> struct AbiStructInfo {
+  static constexpr bool IS_STRUCT = false;
+};
+
+template <typename T>
+struct AbiStructInfo<T, std::void_t<abi_struct_fields_lookup_t<T>>> {
+  static constexpr bool IS_STRUCT = true;
+  using fields = abi_struct_fields_lookup_t<T>;
+};
+
+} // namespace detail
+
+template <typename T>
+constexpr bool is_abi_struct_v = detail::AbiStructInfo<T>::IS_STRUCT;
+
+// AbiStructFields<&T::a, &T::b, ...> of a struct declared by DTVM_ABI_STRUCT
+template <typename T>
+using abi_struct_fields_t = typename detail::AbiStructInfo<T>::fields;
+
+// The type of the member a member pointer points to
+template <auto Member>
+using member_value_t =
+    typename detail::MemberPointerTraits<decltype(Member)>::value_type;
+
+// Position of Member among Members, checked at compile time
+template <auto Member, auto... Members> constexpr size_t member_index() {
+  constexpr bool matches[] = {
+      std::is_same<detail::MemberTag<Member>,
+                   detail::MemberTag<Members>>::value...};
+  for (size_t i = 0; i < sizeof...(Members); i++) {
+    if (matches[i]) {
+      return i;
+    }
+  }
+  return sizeof...(Members);
+}
+
+} // namespace dtvm
+
+#define DTVM_PP_CAT(a, b) DTVM_PP_CAT_I(a, b)
+#define DTVM_PP_CAT_I(a, b) a##b
+
+#define DTVM_PP_COUNT(...)                                                     \
+  DTVM_PP_COUNT_I(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,   \
+                  3, 2, 1, )
+#define DTVM_PP_COUNT_I(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12,     \
+                        _13, _14, _15, _16, N, ...)                            \
+  N
+
+#define DTVM_PP_MEMBER_POINTER(Type, member) &Type::member
+
+// m(Type, x) for each of up to 16 arguments, separated by commas
+#define DTVM_PP_MAP_1(m, T, x) m(T, x)
+#define DTVM_PP_MAP_2(m, T, x, ...) m(T, x), DTVM_PP_MAP_1(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_3(m, T, x, ...) m(T, x), DTVM_PP_MAP_2(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_4(m, T, x, ...) m(T, x), DTVM_PP_MAP_3(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_5(m, T, x, ...) m(T, x), DTVM_PP_MAP_4(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_6(m, T, x, ...) m(T, x), DTVM_PP_MAP_5(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_7(m, T, x, ...) m(T, x), DTVM_PP_MAP_6(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_8(m, T, x, ...) m(T, x), DTVM_PP_MAP_7(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_9(m, T, x, ...) m(T, x), DTVM_PP_MAP_8(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_10(m, T, x, ...) m(T, x), DTVM_PP_MAP_9(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_11(m, T, x, ...) m(T, x), DTVM_PP_MAP_10(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_12(m, T, x, ...) m(T, x), DTVM_PP_MAP_11(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_13(m, T, x, ...) m(T, x), DTVM_PP_MAP_12(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_14(m, T, x, ...) m(T, x), DTVM_PP_MAP_13(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_15(m, T, x, ...) m(T, x), DTVM_PP_MAP_14(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP_16(m, T, x, ...) m(T, x), DTVM_PP_MAP_15(m, T, __VA_ARGS__)
+#define DTVM_PP_MAP(m, T, ...)                                                 \
+  DTVM_PP_CAT(DTVM_PP_MAP_, DTVM_PP_COUNT(__VA_ARGS__))(m, T, __VA_ARGS__)
+
+// Only its return type is used. It is defined anyway, so the declaration in
+// an anonymous namespace does not warn as unused.
+#define DTVM_ABI_STRUCT(Type, ...)                                             \
+  inline constexpr ::dtvm::AbiStructFields<DTVM_PP_MAP(                        \
+      DTVM_PP_MEMBER_POINTER, Type, __VA_ARGS__)>                              \
+  dtvm_abi_struct_fields(const Type *) {                                       \
+    return {};                                                                 \
+  }
@@ -10,7 +10,10 @@
 #define DTVM_CPP_SDK_VERSION_STRING "0.1.0"
 
 #include "encoding.hpp"
+#include "errors.hpp"
+#include "fixed.hpp"
 #include "hostio.hpp"
+#include "keccak.hpp"
 #include "math.hpp"
 #include "storage.hpp"
 #include "types.hpp"
@@ -19,6 +22,8 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #define SOLIDITY(contract_name, solidity_code)
@@ -37,57 +42,12 @@ public:
     return Input(dtvm::hostio::get_args(), dtvm::hostio::get_args_len());
   }
 
-  template <typename T,
-            std::enable_if_t<std::is_same<T, Address>::value, bool> = true>
-  Address read() {
-    uint32_t read_count = 0;
-    Address result =
-        abi_decode<Address>(data_ + offset_, data_ + len_, read_count);
-    offset_ += read_count;
-    return result;
-  }
-
-  template <typename T,
-            std::enable_if_t<std::is_same<T, std::string>::value, bool> = true>
-  std::string read() {
-    // read offset first
-    uint32_t read_count = 0;
-    uint256 str_offset =
-        abi_decode<uint256>(data_ + offset_, data_ + len_, read_count);
-    offset_ += read_count;
-    uint32_t str_offset_int = str_offset.to_uint32();
-    // then read string in new position
-    std::string str = abi_decode<std::string>(data_ + str_offset_int,
-                                              data_ + len_, read_count);
-    return str;
-  }
-
-  template <typename T,
-            std::enable_if_t<std::is_integral<T>::value, bool> = true>
-  T read() {
-    uint32_t read_count = 0;
-    T result = abi_decode<T>(data_ + offset_, data_ + len_, read_count);
-    offset_ += read_count;
-    return result;
-  }
-
-  template <typename T,
-            std::enable_if_t<std::is_same<T, bool>::value, bool> = true>
-  bool read() {
-    uint32_t read_count = 0;
-    bool result = abi_decode<bool>(data_ + offset_, data_ + len_, read_count);
-    offset_ += read_count;
-    return result;
-  }
-
-  template <typename T,
-            std::enable_if_t<std::is_same<T, uint256>::value, bool> = true>
-  uint256 read() {
-    uint32_t read_count = 0;
-    uint256 result =
-        abi_decode<uint256>(data_ + offset_, data_ + len_, read_count);
-    offset_ += read_count;
-    return result;
+  // Reads the next parameter of any ABI type. Dynamic ones follow their
+  // offset from the start of the parameters. std::string_view and BytesView
+  // point into the calldata, which lives for the whole call, so reading them
+  // costs the same for any length. std::string and Bytes are owning copies.
+  template <typename T> T read() {
+    return detail::abi_decode_element<T>(data_, data_ + len_, offset_);
   }
 
   inline uint32_t read_selector() {
@@ -113,45 +73,118 @@ public:
 private:
   const uint8_t *data_;
   uint32_t len_;
-  uint32_t offset_ = 0;
+  size_t offset_ = 0;
 };
 
 class CResult {
 public:
-  inline CResult(const std::vector<uint8_t> &data, bool success,
-                 int32_t ret_code) {
-    data_ = data;
-    success_ = success;
-    ret_code_ = ret_code;
+  // data is taken by value, so a freshly encoded vector is moved in
+  inline CResult(std::vector<uint8_t> data, bool success, int32_t ret_code)
+      : success_(success), ret_code_(ret_code), data_(std::move(data)) {}
+
+  // The result of finish_encoded, whose return data the host already has
+  static CResult already_finished() {
+    CResult result({}, true, 0);
+    result.finished_ = true;
+    return result;
   }
 
   bool success() const { return success_; }
   int32_t ret_code() const { return ret_code_; }
   const std::vector<uint8_t> &data() const { return data_; }
+  bool finished() const { return finished_; }
 
 private:
   bool success_;
   int32_t ret_code_;
+  bool finished_ = false;
   std::vector<uint8_t> data_;
 };
 
 template <typename T> CResult Ok(const T &arg) {
-  // abi encode arg to bytes
-  std::vector<uint8_t> data = abi_encode<T>(arg);
-  return CResult(data, true, 0);
+  // abi encode arg to bytes, a std::tuple returns several values
+  return CResult(AbiWriter().write_value(arg).take(), true, 0);
 }
 
 CResult Ok() { return CResult({}, true, 0); }
 
+namespace detail {
+
+// Return data up to this size is encoded in static memory by
+// finish_encoded, larger return data on the heap
+constexpr size_t FINISH_SCRATCH_SIZE = 1024;
+
+inline uint8_t *finish_scratch() {
+  static uint8_t scratch[FINISH_SCRATCH_SIZE];
+  return scratch;
+}
+
+} // namespace detail
+
+// Encodes args as the return values of the call, the tuple encoding of a
+// solidity function returning (Args...), and hands them to the host right
+// away instead of through a CResult:
+//
+//   CResult balanceOf(const Address &owner) override {
+//     return finish_encoded(balances_->get(owner));
+//   }
+//
+// Static values are encoded on the stack, dynamic ones in a static scratch
+// buffer, so returning makes no heap allocation. Unlike Ok, a single string
+// or array is encoded with its offset word, like solidity returns it.
+template <typename... Args> CResult finish_encoded(const Args &...args) {
+  constexpr size_t head_size =
+      (size_t(0) + ... + detail::abi_head_size<Args>());
+  if constexpr ((!detail::abi_type_t<Args>::DYNAMIC && ...)) {
+    uint8_t data[head_size != 0 ? head_size : 1];
+    detail::AbiTupleWriter writer(data, head_size);
+    (writer.write(args), ...);
+    hostio::finish(data, int32_t(head_size));
+  } else {
+    const size_t size = abi_encoded_size(args...);
+    std::vector<uint8_t> large;
+    uint8_t *data = detail::finish_scratch();
+    if (size > detail::FINISH_SCRATCH_SIZE) {
+      large.resize(size);
+      data = large.data();
+    }
+    detail::AbiTupleWriter writer(data, head_size);
+    (writer.write(args), ...);
+    hostio::finish(data, int32_t(size));
+  }
+  return CResult::already_finished();
+}
+
 template <typename T> CResult Revert(const T &arg, int32_t ret_code = -1) {
-  // abi encode arg to bytes
-  std::vector<uint8_t> data = abi_encode<T>(arg);
-  return CResult(data, false, ret_code);
+  if constexpr (is_custom_error_v<T>) {
+    // the selector of the DTVM_ERROR, then its arguments
+    return CResult(arg.encode(), false, ret_code);
+  } else {
+    // abi encode arg to bytes
+    return CResult(AbiWriter().write_value(arg).take(), false, ret_code);
+  }
 }
 
-void require(bool condition, const std::string &err) {
+// Reverts with Error(string) unless condition holds. The message is only
+// encoded when it fails, a string literal costs nothing otherwise.
+void require(bool condition, const char *message) {
   if (!condition) {
-    hostio::revert((const uint8_t *)err.c_str(), (int32_t)err.size());
+    revert_with_message(message);
+  }
+}
+
+void require(bool condition, const std::string &message) {
+  if (!condition) {
+    revert_with_message(message);
+  }
+}
+
+// Reverts with a DTVM_ERROR unless condition holds
+template <typename Error,
+          std::enable_if_t<is_custom_error_v<Error>, bool> = true>
+void require(bool condition, const Error &error) {
+  if (!condition) {
+    error.revert();
   }
 }
 
@@ -298,7 +331,7 @@ CResult wrapper_call_contract(Func call_func, const Address &to,
     std::vector<uint8_t> call_result;
     ::returnDataCopy((int32_t) reinterpret_cast<intptr_t>(call_result.data()),
                      0, result_len);
-    return CResult(call_result, true, 0);
+    return CResult(std::move(call_result), true, 0);
   }
   // get hostio result and revert
   int32_t result_len = ::getReturnDataSize();
@@ -308,7 +341,7 @@ CResult wrapper_call_contract(Func call_func, const Address &to,
   std::vector<uint8_t> err;
   ::returnDataCopy((int32_t) reinterpret_cast<intptr_t>(err.data()), 0,
                    result_len);
-  return CResult(err, false, ret);
+  return CResult(std::move(err), false, ret);
 }
 
 inline CResult call(const Address &to,
@@ -356,6 +389,10 @@ public:
 
 namespace contract {
 inline void write_result(const CResult &result) {
+  if (result.finished()) {
+    // finish_encoded handed the return data to the host
+    return;
+  }
   if (result.success()) {
     hostio::finish(result.data().data(), (int32_t)result.data().size());
   } else {
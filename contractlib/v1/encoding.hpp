@@ -2,10 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include "abi_struct.hpp"
+#include "fixed.hpp"
 #include "hostio.hpp"
 #include "math.hpp"
+#include "packed_encoding.hpp"
 #include "types.hpp"
 #include "utils.hpp"
+#include <cstring>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -14,10 +20,11 @@ namespace dtvm {
 // Some types are dynamic types, in Ethereum ABI encoding/decoding, they are
 // first stored with an offset, and then the actual encoded content is placed
 // later. The encoding result of n elements is divided into two parts: the first
-// part is n*32 bytes, where each element in the first part only occupies 32
-// bytes. Dynamic elements in the first part store the offset from the beginning
-// of the first part, pointing to the actual position of the element content in
-// the second part.
+// part holds the heads, 32 bytes per element, or the whole encoding of a
+// static fixed size array or tuple. Dynamic elements in the first part store
+// the offset from the beginning of the first part, pointing to the actual
+// position of the element content in the second part. Vectors, fixed size
+// arrays and tuples nest, each one is such a tuple of its own elements.
 
 // Provide a template function to determine if a type is a dynamic_encoding_type
 template <typename T> bool is_dynamic_encoding_type(const T &value) {
@@ -46,9 +53,98 @@ template <typename T>
 struct is_dynamic_t<T, std::void_t<decltype(std::declval<T>().push_back(
                            std::declval<typename T::value_type>()))>>
     : std::true_type {};
+// views of bytes and strings are dynamic too
+template <> struct is_dynamic_t<BytesView> : std::true_type {};
+template <> struct is_dynamic_t<std::string_view> : std::true_type {};
 
-// abi_encode does not currently support encoding vectors; use abi_encode_vector
-// for vectors
+// Opt in with -DDTVM_ABI_STRICT=1 to reject non canonical encodings of value
+// types the way solc generated decoders do: an integer or address whose
+// unused high bytes are not its zero or sign extension, a bool other than 0
+// or 1, or a bytesN with nonzero bytes after its N bytes reverts. The mode
+// only changes decoding, the encoder output is the same either way.
+#ifndef DTVM_ABI_STRICT
+#define DTVM_ABI_STRICT 0
+#endif
+
+namespace detail {
+
+constexpr bool ABI_STRICT = DTVM_ABI_STRICT;
+
+// Selects bytes of a 32-byte word, as four big endian 64-bit limbs
+struct AbiWordMask {
+  uint64_t limbs[4];
+};
+
+// bytes [begin, end) of the word
+constexpr AbiWordMask abi_word_mask(size_t begin, size_t end) {
+  AbiWordMask mask{};
+  for (size_t i = begin; i < end; i++) {
+    mask.limbs[i / 8] |= uint64_t(0xff) << (8 * (7 - i % 8));
+  }
+  return mask;
+}
+
+// Whether the bytes of word selected by mask all equal fill (0x00 or 0xff),
+// four 64-bit compares instead of a loop over the bytes
+inline bool abi_word_bytes_are(const uint8_t *word, const AbiWordMask &mask,
+                               uint8_t fill) {
+  const uint64_t fill_limb = fill ? ~uint64_t(0) : 0;
+  uint64_t diff = 0;
+  for (size_t i = 0; i < 4; i++) {
+    diff |= (load_be64(word + 8 * i) ^ fill_limb) & mask.limbs[i];
+  }
+  return diff == 0;
+}
+
+// The high bytes of an integer word are its zero or sign extension
+template <typename T> bool abi_integer_is_canonical(const uint8_t *word) {
+  constexpr size_t padding = 32 - sizeof(T);
+  constexpr AbiWordMask mask = abi_word_mask(0, padding);
+  uint8_t fill = 0;
+  if constexpr (std::is_signed<T>::value) {
+    fill = (word[padding] & 0x80) ? 0xff : 0;
+  }
+  return abi_word_bytes_are(word, mask, fill);
+}
+
+inline bool abi_bool_is_canonical(const uint8_t *word) {
+  return abi_integer_is_canonical<uint8_t>(word) && word[31] <= 1;
+}
+
+inline bool abi_address_is_canonical(const uint8_t *word) {
+  constexpr AbiWordMask mask = abi_word_mask(0, 12);
+  return abi_word_bytes_are(word, mask, 0);
+}
+
+// bytesN is followed by zero bytes
+template <size_t N> bool abi_fixed_bytes_is_canonical(const uint8_t *word) {
+  constexpr AbiWordMask mask = abi_word_mask(N, 32);
+  return abi_word_bytes_are(word, mask, 0);
+}
+
+// Reverts on a non canonical value, checked in strict mode only
+inline bool abi_check_canonical(bool canonical) {
+  if (!canonical) {
+    hostio::revert("abi_decode: value is not canonically encoded");
+    return false;
+  }
+  return true;
+}
+
+// The high bytes of an integer word: the sign extension of the value, as
+// solidity encodes intN
+template <typename T> uint8_t abi_integer_padding(const T &value) {
+  if constexpr (std::is_signed<T>::value) {
+    return value < 0 ? 0xff : 0;
+  } else {
+    return 0;
+  }
+}
+
+} // namespace detail
+
+// Encodes one value: a static value as its head, a dynamic one as its content
+// without an offset, a std::tuple or DTVM_ABI_STRUCT as a tuple encoding
 template <typename T,
           std::enable_if_t<!std::is_integral<T>::value, bool> = true>
 std::vector<uint8_t> abi_encode(const T &value);
@@ -94,104 +190,43 @@ std::vector<uint8_t> abi_encode(const Integer &value) {
   const auto &value_bytes = uint256(__uint128_t(value)).bytes();
   std::vector<uint8_t> result;
   result.insert(result.end(), value_bytes.begin(), value_bytes.end());
-  // Since negative numbers extended to uint128 will still be signed, to ensure
-  // correctness, we zero out the leading bytes based on the size of the integer
-  // type.
-  memset(result.data(), 0x0, 32 /* sizeof(uint256_t) */ - sizeof(Integer));
+  // the bytes above the integer type are its sign extension, 0xff for a
+  // negative value
+  memset(result.data(), detail::abi_integer_padding(value),
+         32 /* sizeof(uint256_t) */ - sizeof(Integer));
   return result;
 }
 
 template <> std::vector<uint8_t> abi_encode(const uint256 &value) {
-  const auto &value_bytes = value.bytes();
-  std::vector<uint8_t> result;
-  result.insert(result.end(), value_bytes.begin(), value_bytes.end());
+  std::vector<uint8_t> result(32);
+  value.to_be_bytes(result.data());
   return result;
 }
 
-template <> std::vector<uint8_t> abi_encode(const Address &value) {
-  const auto &addr_bytes = value.to_bytes32();
-  std::vector<uint8_t> result;
-  result.insert(result.end(), addr_bytes.begin(), addr_bytes.end());
+template <> std::vector<uint8_t> abi_encode(const int256 &value) {
+  // two's complement, negative values are sign extended to 32 bytes
+  std::vector<uint8_t> result(32);
+  value.to_bits().to_be_bytes(result.data());
   return result;
 }
 
-template <typename T>
-void process_abi_encode_tuple_element(std::vector<uint8_t> &prefix_part,
-                                      std::vector<uint8_t> &suffix_part,
-                                      uint32_t prefix_part_bytes_count,
-                                      const T &arg) {
-  const auto &arg_encoded =
-      abi_encode<T>(arg); // now arg can't be a vector type
-  if (is_dynamic_encoding_type<T>(arg)) {
-    // write offset in prefix part, and write data in suffix part
-    uint32_t offset = prefix_part_bytes_count + (uint32_t)suffix_part.size();
-    const auto &offset_bytes = uint256(offset).bytes();
-    prefix_part.insert(prefix_part.end(), offset_bytes.begin(),
-                       offset_bytes.end());
-    suffix_part.insert(suffix_part.end(), arg_encoded.begin(),
-                       arg_encoded.end());
-  } else {
-    prefix_part.insert(prefix_part.end(), arg_encoded.begin(),
-                       arg_encoded.end());
-  }
+// fixed point numbers are encoded as their raw uint256 / int256 value
+template <> std::vector<uint8_t> abi_encode(const ufixed18 &value) {
+  return abi_encode(value.to_raw());
 }
 
-template <typename T1, typename... Args>
-std::vector<uint8_t> abi_encode(const std::tuple<T1, Args...> &value) {
-  // If the element type is dynamic, write the offset first,
-  // then append to the end (return type cannot be simply std::vector<uint8_t>)
-  std::vector<uint8_t> prefix_part;
-  std::vector<uint8_t> suffix_part;
-  uint32_t prefix_part_bytes_count =
-      std::tuple_size<std::tuple<T1, Args...>>::value * 32;
-
-  std::apply(
-      [&prefix_part, &suffix_part, &prefix_part_bytes_count](auto &&...args) {
-        (void(process_abi_encode_tuple_element(prefix_part, suffix_part,
-                                               prefix_part_bytes_count, args)),
-         ...);
-      },
-      value);
-  std::vector<uint8_t> result = prefix_part;
-  result.insert(result.end(), suffix_part.begin(), suffix_part.end());
-  return result;
+template <> std::vector<uint8_t> abi_encode(const sfixed18 &value) {
+  return abi_encode(value.to_raw());
 }
 
-template <typename T>
-std::vector<uint8_t> abi_encode_vector(const std::vector<T> &value) {
+template <> std::vector<uint8_t> abi_encode(const Address &value) {
+  const auto &addr_bytes = value.to_bytes32();
   std::vector<uint8_t> result;
-  // 1. write length
-  const auto &length = uint256(value.size());
-  const auto &length_bytes = length.bytes();
-  result.insert(result.end(), length_bytes.begin(), length_bytes.end());
-  // 2. write elements
-  std::vector<uint8_t> all_dynamic_contents;
-  for (size_t i = 0; i < value.size(); i++) {
-    const auto &item = value[i];
-    const auto &element_encoded = abi_encode(item);
-    if (is_dynamic_encoding_type<T>(item)) {
-      // write offset in prefix part, and write data in suffix part
-      uint32_t offset =
-          32 + 32 * value.size() +
-          all_dynamic_contents.size(); // first 32bytes is vector length, second
-                                       // 32bytes is current offset used bytes
-      const auto &offset_bytes = uint256(offset).bytes();
-      result.insert(result.end(), offset_bytes.begin(), offset_bytes.end());
-      all_dynamic_contents.insert(all_dynamic_contents.end(),
-                                  element_encoded.begin(),
-                                  element_encoded.end());
-    } else {
-      result.insert(result.end(), element_encoded.begin(),
-                    element_encoded.end());
-    }
-  }
-  result.insert(result.end(), all_dynamic_contents.begin(),
-                all_dynamic_contents.end());
+  result.insert(result.end(), addr_bytes.begin(), addr_bytes.end());
   return result;
 }
 
-// abi_decode does not currently support decoding vectors; use abi_decode_vector
-// for vectors
+// Decodes one value laid out like abi_encode(value)
 template <typename T, std::enable_if_t<!std::is_integral<T>::value ||
                                            std::is_same<T, bool>::value,
                                        bool> = true>
@@ -206,11 +241,16 @@ T abi_decode(const uint8_t *data, const uint8_t *data_end,
              uint32_t &read_bytes_out) {
   if ((data + 32) > data_end) {
     hostio::revert("abi_decode: data is too short");
+    return T();
   }
-  bytes32 value_bytes;
-  memcpy(value_bytes.data(), data, 32);
   read_bytes_out = 32;
-  __uint128_t u128_value = uint256(value_bytes).to_uint128();
+  if constexpr (detail::ABI_STRICT) {
+    if (!detail::abi_check_canonical(
+            detail::abi_integer_is_canonical<T>(data))) {
+      return T();
+    }
+  }
+  __uint128_t u128_value = uint256::from_be_bytes(data).to_uint128();
   return (T)u128_value;
 }
 
@@ -219,27 +259,52 @@ uint256 abi_decode(const uint8_t *data, const uint8_t *data_end,
                    uint32_t &read_bytes_out) {
   if ((data + 32) > data_end) {
     hostio::revert("abi_decode: data is too short");
+    return uint256();
   }
-  bytes32 value_bytes;
-  memcpy(value_bytes.data(), data, 32);
   read_bytes_out = 32;
-  auto result = uint256(value_bytes);
-  return result;
+  return uint256::from_be_bytes(data);
+}
+
+template <>
+int256 abi_decode(const uint8_t *data, const uint8_t *data_end,
+                  uint32_t &read_bytes_out) {
+  if ((data + 32) > data_end) {
+    hostio::revert("abi_decode: data is too short");
+    return int256();
+  }
+  read_bytes_out = 32;
+  return int256::from_bits(uint256::from_be_bytes(data));
+}
+
+template <>
+ufixed18 abi_decode(const uint8_t *data, const uint8_t *data_end,
+                    uint32_t &read_bytes_out) {
+  return ufixed18::from_raw(
+      abi_decode<uint256>(data, data_end, read_bytes_out));
+}
+
+template <>
+sfixed18 abi_decode(const uint8_t *data, const uint8_t *data_end,
+                    uint32_t &read_bytes_out) {
+  return sfixed18::from_raw(abi_decode<int256>(data, data_end, read_bytes_out));
 }
 
 template <>
 bool abi_decode(const uint8_t *data, const uint8_t *data_end,
                 uint32_t &read_bytes_out) {
-  if ((data + 1) > data_end) {
+  if ((data + 32) > data_end) {
     hostio::revert("abi_decode: data is too short");
+    return false;
   }
   read_bytes_out = 32;
-  for (size_t i = 0; i < 32; i++) {
-    if (data[i] != 0) {
-      return true;
+  if constexpr (detail::ABI_STRICT) {
+    if (!detail::abi_check_canonical(detail::abi_bool_is_canonical(data))) {
+      return false;
     }
+    return data[31] != 0;
   }
-  return false;
+  constexpr detail::AbiWordMask whole_word = detail::abi_word_mask(0, 32);
+  return !detail::abi_word_bytes_are(data, whole_word, 0);
 }
 
 template <>
@@ -247,6 +312,12 @@ Address abi_decode(const uint8_t *data, const uint8_t *data_end,
                    uint32_t &read_bytes_out) {
   if ((data + 32) > data_end) {
     hostio::revert("abi_decode: data is too short");
+    return Address();
+  }
+  if constexpr (detail::ABI_STRICT) {
+    if (!detail::abi_check_canonical(detail::abi_address_is_canonical(data))) {
+      return Address();
+    }
   }
   bytes32 addr_bytes;
   memcpy(addr_bytes.data(), data, 32);
@@ -254,59 +325,601 @@ Address abi_decode(const uint8_t *data, const uint8_t *data_end,
   return Address(addr_bytes);
 }
 
+namespace detail {
+
+constexpr size_t abi_padded_size(size_t size) { return (size + 31) / 32 * 32; }
+
+// The content of a length prefixed bytes or string value, pointing into
+// data. Only the length word is read, so the cost does not depend on the
+// size of the value.
+inline BytesView abi_decode_bytes_view(const uint8_t *data,
+                                       const uint8_t *data_end,
+                                       uint32_t &read_bytes_out) {
+  if (data > data_end || data_end - data < 32) {
+    hostio::revert("abi_decode: data is too short");
+    return BytesView();
+  }
+  const size_t available = size_t(data_end - data) - 32;
+  // compared as uint256 so a huge length can not wrap around
+  const uint256 &length = uint256::from_be_bytes(data);
+  if (length > uint256(available) ||
+      abi_padded_size(size_t(length.to_uint64())) > available) {
+    hostio::revert("abi_decode: data is too short");
+    return BytesView();
+  }
+  const size_t size = size_t(length.to_uint64());
+  read_bytes_out = uint32_t(32 + abi_padded_size(size));
+  return BytesView(data + 32, size);
+}
+
+} // namespace detail
+
+template <>
+BytesView abi_decode(const uint8_t *data, const uint8_t *data_end,
+                     uint32_t &read_bytes_out) {
+  return detail::abi_decode_bytes_view(data, data_end, read_bytes_out);
+}
+
+template <>
+std::string_view abi_decode(const uint8_t *data, const uint8_t *data_end,
+                            uint32_t &read_bytes_out) {
+  return detail::abi_decode_bytes_view(data, data_end, read_bytes_out)
+      .as_string_view();
+}
+
+// the owning form copies the content once
 template <>
 std::string abi_decode(const uint8_t *data, const uint8_t *data_end,
                        uint32_t &read_bytes_out) {
-  // read bytes32 to uint256 as big endian
-  if ((data + 32) > data_end) {
+  return std::string(
+      abi_decode<std::string_view>(data, data_end, read_bytes_out));
+}
+
+template <>
+Bytes abi_decode(const uint8_t *data, const uint8_t *data_end,
+                 uint32_t &read_bytes_out) {
+  return Bytes(
+      abi_decode<BytesView>(data, data_end, read_bytes_out).to_vector());
+}
+
+namespace detail {
+
+// How a type is laid out in the ABI encoding, shared by AbiWriter and the
+// decoder. A static type takes HEAD_SIZE bytes in place, see write() and
+// decode(). A dynamic type has a 32-byte offset in its head and its content
+// after all the heads, see tail_size(), write_tail() and decode_tail().
+// Arrays, vectors, tuples and structs recurse through the AbiType of their
+// elements, so nesting needs no special cases.
+template <typename T, typename Enable = void> struct AbiType;
+
+// string literals and arrays are encoded through the pointer they decay to
+template <typename T> using abi_type_t = AbiType<std::decay_t<T>>;
+
+template <typename T> constexpr size_t abi_head_size() {
+  if constexpr (abi_type_t<T>::DYNAMIC) {
+    return 32;
+  } else {
+    return abi_type_t<T>::HEAD_SIZE;
+  }
+}
+
+template <typename T> size_t abi_tail_size(const T &value) {
+  if constexpr (abi_type_t<T>::DYNAMIC) {
+    return abi_type_t<T>::tail_size(value);
+  } else {
+    return 0;
+  }
+}
+
+// Reverts unless size bytes can be read at data
+inline bool abi_check_size(const uint8_t *data, const uint8_t *data_end,
+                           size_t size) {
+  if (data > data_end || size_t(data_end - data) < size) {
     hostio::revert("abi_decode: data is too short");
+    return false;
   }
-  bytes32 length_bytes;
-  memcpy(length_bytes.data(), data, 32);
-  uint32_t length = uint256(length_bytes).to_uint32();
-  uint32_t unpadded_parts = (length + 31) / 32;
-  std::vector<uint8_t> unpadded_bytes;
-  int offset = 32; // read 32 bytes as length
-  if ((data + offset + 32 * unpadded_parts) > data_end) {
+  return true;
+}
+
+// Decodes the element of type T whose head is head_offset bytes into the
+// tuple that starts at base, and moves head_offset past that head. The
+// offset of a dynamic element counts from base too.
+template <typename T>
+T abi_decode_element(const uint8_t *base, const uint8_t *data_end,
+                     size_t &head_offset) {
+  const size_t available = data_end > base ? size_t(data_end - base) : 0;
+  if (head_offset > available ||
+      available - head_offset < abi_head_size<T>()) {
     hostio::revert("abi_decode: data is too short");
+    return T();
   }
-  for (uint32_t i = 0; i < unpadded_parts; ++i) {
-    unpadded_bytes.insert(unpadded_bytes.end(), data + offset + 32 * i,
-                          data + offset + 32 * (i + 1));
+  const uint8_t *head = base + head_offset;
+  head_offset += abi_head_size<T>();
+  if constexpr (AbiType<T>::DYNAMIC) {
+    const uint256 &offset = uint256::from_be_bytes(head);
+    // the content starts with at least one word
+    if (offset >= uint256(available)) {
+      hostio::revert("abi_decode: data is too short");
+      return T();
+    }
+    return AbiType<T>::decode_tail(base + size_t(offset.to_uint64()),
+                                   data_end);
+  } else {
+    return AbiType<T>::decode(head, data_end);
   }
-  read_bytes_out = 32 + unpadded_parts * 32;
-  return std::string(unpadded_bytes.begin(), unpadded_bytes.begin() + length);
 }
 
-template <typename E>
-std::vector<E> abi_decode_vector(const uint8_t *data, const uint8_t *data_end,
-                                 uint32_t &read_bytes_out) {
-  // decode length, then decode elements
-  std::vector<E> result;
-  if ((data + 32) > data_end) {
-    hostio::revert("abi_decode: data is too short");
+// Fills a tuple encoding in place: the heads from base on, the content of
+// the dynamic elements after all the heads
+class AbiTupleWriter {
+public:
+  AbiTupleWriter(uint8_t *base, size_t head_size)
+      : base_(base), head_(base), tail_(base + head_size) {}
+
+  template <typename T> void write(const T &value) {
+    using Type = abi_type_t<T>;
+    if constexpr (Type::DYNAMIC) {
+      uint256(size_t(tail_ - base_)).to_be_bytes(head_);
+      tail_ += Type::write_tail(tail_, value);
+      head_ += 32;
+    } else {
+      Type::write(head_, value);
+      head_ += Type::HEAD_SIZE;
+    }
   }
-  bytes32 length_bytes;
-  memcpy(length_bytes.data(), data, 32);
-  uint32_t length = uint256(length_bytes).to_uint32();
-  for (uint32_t i = 0; i < length; i++) {
-    uint32_t offset = 32 + i * 32;
-    if (is_dynamic_t<E>()) {
-      bytes32 offset_bytes;
-      memcpy(offset_bytes.data(), data + 32 + i * 32, 32);
-      offset = uint256(offset_bytes).to_uint32();
-      if ((data + offset + 32) > data_end) {
-        hostio::revert("abi_decode: data is too short");
+
+  // bytes written, heads and tails
+  size_t size() const { return size_t(tail_ - base_); }
+
+private:
+  uint8_t *base_;
+  uint8_t *head_;
+  uint8_t *tail_;
+};
+
+// The elements of an array or vector, encoded as a tuple of that many
+// elements
+template <typename Container>
+size_t abi_sequence_size(const Container &values) {
+  using T = typename Container::value_type;
+  size_t size = values.size() * abi_head_size<T>();
+  if constexpr (AbiType<T>::DYNAMIC) {
+    for (const T &value : values) {
+      size += AbiType<T>::tail_size(value);
+    }
+  }
+  return size;
+}
+
+template <typename Container>
+size_t write_abi_sequence(uint8_t *out, const Container &values) {
+  using T = typename Container::value_type;
+  AbiTupleWriter writer(out, values.size() * abi_head_size<T>());
+  for (const auto &value : values) {
+    // named explicitly so std::vector<bool> proxies encode as bool
+    writer.write<T>(value);
+  }
+  return writer.size();
+}
+
+// One word holding a scalar, decoded by its abi_decode specialization
+template <typename T> struct AbiWord {
+  static constexpr bool DYNAMIC = false;
+  static constexpr size_t HEAD_SIZE = 32;
+  static T decode(const uint8_t *data, const uint8_t *data_end) {
+    uint32_t read_bytes = 0;
+    return abi_decode<T>(data, data_end, read_bytes);
+  }
+};
+
+template <typename T>
+struct AbiType<T, std::enable_if_t<std::is_integral<T>::value>>
+    : AbiWord<T> {
+  static void write(uint8_t *out, const T &value) {
+    uint256(__uint128_t(value)).to_be_bytes(out);
+    // the same layout as abi_encode, negative values are sign extended
+    memset(out, abi_integer_padding(value), 32 - sizeof(T));
+  }
+};
+
+template <> struct AbiType<uint256> : AbiWord<uint256> {
+  static void write(uint8_t *out, const uint256 &value) {
+    value.to_be_bytes(out);
+  }
+};
+
+template <> struct AbiType<int256> : AbiWord<int256> {
+  static void write(uint8_t *out, const int256 &value) {
+    value.to_bits().to_be_bytes(out);
+  }
+};
+
+template <> struct AbiType<ufixed18> : AbiWord<ufixed18> {
+  static void write(uint8_t *out, const ufixed18 &value) {
+    value.to_raw().to_be_bytes(out);
+  }
+};
+
+template <> struct AbiType<sfixed18> : AbiWord<sfixed18> {
+  static void write(uint8_t *out, const sfixed18 &value) {
+    value.to_raw().to_bits().to_be_bytes(out);
+  }
+};
+
+template <> struct AbiType<Address> : AbiWord<Address> {
+  static void write(uint8_t *out, const Address &value) {
+    memset(out, 0, 12);
+    memcpy(out + 12, value.data(), 20);
+  }
+};
+
+// bytes1 to bytes32, left aligned in their word
+template <typename T, size_t N>
+constexpr bool is_abi_fixed_bytes_v =
+    std::is_same<T, uint8_t>::value && N >= 1 && N <= 32;
+
+template <size_t N>
+struct AbiType<std::array<uint8_t, N>,
+               std::enable_if_t<is_abi_fixed_bytes_v<uint8_t, N>>> {
+  static constexpr bool DYNAMIC = false;
+  static constexpr size_t HEAD_SIZE = 32;
+  static void write(uint8_t *out, const std::array<uint8_t, N> &value) {
+    memcpy(out, value.data(), N);
+    memset(out + N, 0, 32 - N);
+  }
+  static std::array<uint8_t, N> decode(const uint8_t *data,
+                                       const uint8_t *data_end) {
+    std::array<uint8_t, N> result{};
+    if (!abi_check_size(data, data_end, 32)) {
+      return result;
+    }
+    if constexpr (ABI_STRICT) {
+      if (!abi_check_canonical(abi_fixed_bytes_is_canonical<N>(data))) {
+        return result;
       }
     }
+    memcpy(result.data(), data, N);
+    return result;
+  }
+};
 
-    uint32_t element_read_bytes_count = 0;
-    E element =
-        abi_decode<E>(data + offset, data_end, element_read_bytes_count);
-    result.push_back(element);
+// length word, then the bytes zero padded to a multiple of 32
+inline void write_abi_bytes(uint8_t *out, const uint8_t *data, size_t size) {
+  uint256(size).to_be_bytes(out);
+  if (size != 0) {
+    memcpy(out + 32, data, size);
   }
-  read_bytes_out = 32 + length * 32;
-  return result;
+  memset(out + 32 + size, 0, abi_padded_size(size) - size);
+}
+
+// bytes and string, decoded by their abi_decode specialization
+template <typename T> struct AbiByteString {
+  static constexpr bool DYNAMIC = true;
+  static size_t tail_size(const T &value) {
+    return 32 + abi_padded_size(value.size());
+  }
+  static size_t write_tail(uint8_t *out, const T &value) {
+    write_abi_bytes(out, (const uint8_t *)value.data(), value.size());
+    return tail_size(value);
+  }
+  static T decode_tail(const uint8_t *data, const uint8_t *data_end) {
+    uint32_t read_bytes = 0;
+    return abi_decode<T>(data, data_end, read_bytes);
+  }
+};
+
+template <> struct AbiType<std::string> : AbiByteString<std::string> {};
+
+template <>
+struct AbiType<std::string_view> : AbiByteString<std::string_view> {};
+
+template <> struct AbiType<BytesView> : AbiByteString<BytesView> {};
+
+template <> struct AbiType<Bytes> : AbiByteString<Bytes> {};
+
+// encode only, there is nothing to decode a C string into
+template <typename Char>
+struct AbiType<Char *, std::enable_if_t<std::is_same<
+                           std::remove_const_t<Char>, char>::value>> {
+  static constexpr bool DYNAMIC = true;
+  static size_t tail_size(const char *value) {
+    return 32 + abi_padded_size(strlen(value));
+  }
+  static size_t write_tail(uint8_t *out, const char *value) {
+    write_abi_bytes(out, (const uint8_t *)value, strlen(value));
+    return tail_size(value);
+  }
+};
+
+// T[N]: inline when T is static, otherwise a tuple of N elements in the tail
+template <typename T, size_t N>
+struct AbiType<std::array<T, N>,
+               std::enable_if_t<!is_abi_fixed_bytes_v<T, N>>> {
+  static_assert(N > 0, "zero length arrays are not ABI types");
+  static constexpr bool DYNAMIC = AbiType<T>::DYNAMIC;
+  static constexpr size_t HEAD_SIZE = N * abi_head_size<T>();
+
+  static void write(uint8_t *out, const std::array<T, N> &value) {
+    write_abi_sequence(out, value);
+  }
+  static size_t tail_size(const std::array<T, N> &value) {
+    return abi_sequence_size(value);
+  }
+  static size_t write_tail(uint8_t *out, const std::array<T, N> &value) {
+    return write_abi_sequence(out, value);
+  }
+  static std::array<T, N> decode(const uint8_t *data,
+                                 const uint8_t *data_end) {
+    std::array<T, N> result{};
+    size_t head_offset = 0;
+    for (size_t i = 0; i < N; i++) {
+      result[i] = abi_decode_element<T>(data, data_end, head_offset);
+    }
+    return result;
+  }
+  static std::array<T, N> decode_tail(const uint8_t *data,
+                                      const uint8_t *data_end) {
+    return decode(data, data_end);
+  }
+};
+
+// T[]: the length word, then a tuple of that many elements
+template <typename T> struct AbiType<std::vector<T>> {
+  static constexpr bool DYNAMIC = true;
+
+  static size_t tail_size(const std::vector<T> &value) {
+    return 32 + abi_sequence_size(value);
+  }
+  static size_t write_tail(uint8_t *out, const std::vector<T> &value) {
+    uint256(value.size()).to_be_bytes(out);
+    return 32 + write_abi_sequence(out + 32, value);
+  }
+  static std::vector<T> decode_tail(const uint8_t *data,
+                                    const uint8_t *data_end) {
+    std::vector<T> result;
+    if (!abi_check_size(data, data_end, 32)) {
+      return result;
+    }
+    const uint256 &length = uint256::from_be_bytes(data);
+    const uint8_t *elements = data + 32;
+    // every element takes at least its head, which bounds the length
+    // before anything is allocated
+    if (length > uint256(size_t(data_end - elements) / abi_head_size<T>())) {
+      hostio::revert("abi_decode: data is too short");
+      return result;
+    }
+    const size_t count = size_t(length.to_uint64());
+    result.reserve(count);
+    size_t head_offset = 0;
+    for (size_t i = 0; i < count; i++) {
+      result.push_back(abi_decode_element<T>(elements, data_end, head_offset));
+    }
+    return result;
+  }
+};
+
+// (T1, T2, ...): inline when every element is static
+template <typename... Args> struct AbiType<std::tuple<Args...>> {
+  static constexpr bool DYNAMIC = (AbiType<Args>::DYNAMIC || ...);
+  static constexpr size_t HEAD_SIZE = (size_t(0) + ... + abi_head_size<Args>());
+
+  static void write(uint8_t *out, const std::tuple<Args...> &value) {
+    write_tail(out, value);
+  }
+  static size_t tail_size(const std::tuple<Args...> &value) {
+    return std::apply(
+        [](const Args &...args) {
+          return HEAD_SIZE + (size_t(0) + ... + abi_tail_size(args));
+        },
+        value);
+  }
+  static size_t write_tail(uint8_t *out, const std::tuple<Args...> &value) {
+    AbiTupleWriter writer(out, HEAD_SIZE);
+    std::apply([&writer](const Args &...args) { (writer.write(args), ...); },
+               value);
+    return writer.size();
+  }
+  static std::tuple<Args...> decode(const uint8_t *data,
+                                    const uint8_t *data_end) {
+    size_t head_offset = 0;
+    // a braced list evaluates the elements in order
+    return std::tuple<Args...>{
+        abi_decode_element<Args>(data, data_end, head_offset)...};
+  }
+  static std::tuple<Args...> decode_tail(const uint8_t *data,
+                                         const uint8_t *data_end) {
+    return decode(data, data_end);
+  }
+};
+
+// A struct declared with DTVM_ABI_STRUCT, encoded like the tuple of its
+// members. Each step of the folds reads or writes one member in place.
+template <typename T, typename Fields> struct AbiStruct;
+
+template <typename T, auto... Members>
+struct AbiStruct<T, AbiStructFields<Members...>> {
+  static constexpr bool DYNAMIC =
+      (AbiType<member_value_t<Members>>::DYNAMIC || ...);
+  static constexpr size_t HEAD_SIZE =
+      (size_t(0) + ... + abi_head_size<member_value_t<Members>>());
+
+  static void write(uint8_t *out, const T &value) { write_tail(out, value); }
+  static size_t tail_size(const T &value) {
+    return HEAD_SIZE + (size_t(0) + ... + abi_tail_size(value.*Members));
+  }
+  static size_t write_tail(uint8_t *out, const T &value) {
+    AbiTupleWriter writer(out, HEAD_SIZE);
+    (writer.write<member_value_t<Members>>(value.*Members), ...);
+    return writer.size();
+  }
+  static T decode(const uint8_t *data, const uint8_t *data_end) {
+    T result{};
+    size_t head_offset = 0;
+    ((result.*Members = abi_decode_element<member_value_t<Members>>(
+          data, data_end, head_offset)),
+     ...);
+    return result;
+  }
+  static T decode_tail(const uint8_t *data, const uint8_t *data_end) {
+    return decode(data, data_end);
+  }
+};
+
+template <typename T>
+struct AbiType<T, std::enable_if_t<is_abi_struct_v<T>>>
+    : AbiStruct<T, abi_struct_fields_t<T>> {};
+
+} // namespace detail
+
+// Exact size of the tuple encoding of args, heads plus tails
+template <typename... Args> size_t abi_encoded_size(const Args &...args) {
+  return (size_t(0) + ... + detail::abi_head_size<Args>()) +
+         (size_t(0) + ... + detail::abi_tail_size(args));
+}
+
+// The same for static types only, known at compile time
+template <typename... Args> constexpr size_t abi_static_encoded_size() {
+  static_assert((!detail::abi_type_t<Args>::DYNAMIC && ...),
+                "abi_static_encoded_size of a dynamic type");
+  return (size_t(0) + ... + detail::abi_head_size<Args>());
+}
+
+// Encodes straight into one buffer:
+//
+//   AbiWriter writer;
+//   writer.write_call(0xa9059cbb, to, amount);
+//
+// write_tuple lays out its arguments like abi_encode(std::make_tuple(...))
+// and write_value its argument like abi_encode(value); write_call is
+// write_selector followed by write_tuple. Each write first computes the exact
+// encoded size, grows the buffer once and then fills the head and tail parts
+// in place, with no temporary vector per element.
+class AbiWriter {
+public:
+  AbiWriter() = default;
+  explicit AbiWriter(size_t capacity) { buffer_.reserve(capacity); }
+
+  AbiWriter &write_selector(uint32_t selector) {
+    put_selector(grow(4), selector);
+    return *this;
+  }
+
+  template <typename... Args> AbiWriter &write_tuple(const Args &...args) {
+    put_tuple(grow(abi_encoded_size(args...)), args...);
+    return *this;
+  }
+
+  // the selector and the arguments, sized once and grown once
+  template <typename... Args>
+  AbiWriter &write_call(uint32_t selector, const Args &...args) {
+    uint8_t *out = grow(4 + abi_encoded_size(args...));
+    put_selector(out, selector);
+    put_tuple(out + 4, args...);
+    return *this;
+  }
+
+  // a single value: the content of a dynamic one without an offset, a
+  // std::tuple as a tuple encoding
+  template <typename T> AbiWriter &write_value(const T &value) {
+    using Type = detail::abi_type_t<T>;
+    if constexpr (Type::DYNAMIC) {
+      Type::write_tail(grow(Type::tail_size(value)), value);
+    } else {
+      Type::write(grow(Type::HEAD_SIZE), value);
+    }
+    return *this;
+  }
+
+  const std::vector<uint8_t> &data() const { return buffer_; }
+
+  size_t size() const { return buffer_.size(); }
+
+  // Moves the encoded bytes out, leaving the writer empty
+  std::vector<uint8_t> take() { return std::move(buffer_); }
+
+private:
+  static void put_selector(uint8_t *out, uint32_t selector) {
+    out[0] = uint8_t(selector >> 24);
+    out[1] = uint8_t(selector >> 16);
+    out[2] = uint8_t(selector >> 8);
+    out[3] = uint8_t(selector);
+  }
+
+  template <typename... Args>
+  static void put_tuple(uint8_t *out, const Args &...args) {
+    detail::AbiTupleWriter writer(
+        out, (size_t(0) + ... + detail::abi_head_size<Args>()));
+    (writer.write(args), ...);
+  }
+
+  // The zero fill of resize is not needed, every write covers all the bytes
+  // it grew, padding included. std::vector can not grow uninitialized though,
+  // and the buffer has to stay a std::vector for take() to hand it out
+  // without a copy; the fill is one memset over memory the encoding writes
+  // next anyway.
+  uint8_t *grow(size_t size) {
+    size_t old_size = buffer_.size();
+    buffer_.resize(old_size + size);
+    return buffer_.data() + old_size;
+  }
+
+  std::vector<uint8_t> buffer_;
+};
+
+template <typename T, std::enable_if_t<!std::is_integral<T>::value, bool>>
+std::vector<uint8_t> abi_encode(const T &value) {
+  return AbiWriter().write_value(value).take();
+}
+
+template <typename T1, typename... Args>
+std::vector<uint8_t> abi_encode(const std::tuple<T1, Args...> &value) {
+  return AbiWriter().write_value(value).take();
+}
+
+// abi_encode(std::make_tuple(args...)) without copying the arguments
+template <typename... Args>
+std::vector<uint8_t> abi_encode_args(const Args &...args) {
+  return AbiWriter().write_tuple(args...).take();
+}
+
+// The calldata of an external call: the selector, then the arguments
+template <typename... Args>
+std::vector<uint8_t> abi_encode_call(uint32_t selector, const Args &...args) {
+  return AbiWriter().write_call(selector, args...).take();
+}
+
+template <typename T>
+std::vector<uint8_t> abi_encode_vector(const std::vector<T> &value) {
+  return abi_encode(value);
+}
+
+template <typename T, std::enable_if_t<!std::is_integral<T>::value ||
+                                           std::is_same<T, bool>::value,
+                                       bool>>
+T abi_decode(const uint8_t *data, const uint8_t *data_end,
+             uint32_t &read_bytes_out) {
+  using Type = detail::AbiType<T>;
+  if constexpr (Type::DYNAMIC) {
+    T result = Type::decode_tail(data, data_end);
+    read_bytes_out = uint32_t(Type::tail_size(result));
+    return result;
+  } else {
+    read_bytes_out = uint32_t(Type::HEAD_SIZE);
+    return Type::decode(data, data_end);
+  }
+}
+
+// The tuple encoding of Args, e.g. calldata after the selector
+template <typename... Args>
+std::tuple<Args...> abi_decode_args(const uint8_t *data,
+                                    const uint8_t *data_end) {
+  return detail::AbiType<std::tuple<Args...>>::decode(data, data_end);
+}
+
+template <typename E>
+std::vector<E> abi_decode_vector(const uint8_t *data, const uint8_t *data_end,
+                                 uint32_t &read_bytes_out) {
+  return abi_decode<std::vector<E>>(data, data_end, read_bytes_out);
 }
 
 template <typename T> T abi_decode_all(const std::vector<uint8_t> &data) {
@@ -0,0 +1,238 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "abi_struct.hpp"
+#include "encoding.hpp"
+#include "fixed.hpp"
+#include "hostio.hpp"
+#include "keccak.hpp"
+#include "math.hpp"
+#include "types.hpp"
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace dtvm {
+
+// Solidity custom errors:
+//
+//   DTVM_ERROR(InsufficientBalance, uint256, uint256)
+//   ...
+//   require(balance >= amount, InsufficientBalance(balance, amount));
+//
+// reverts with the selector of "InsufficientBalance(uint256,uint256)" and
+// the ABI encoded arguments, 68 bytes where Error(string) with a message
+// takes at least 100. The signature and its selector are computed at
+// compile time from the C++ argument types.
+
+namespace detail {
+
+// Appends text at out + size and returns the new size
+constexpr size_t append_abi_name(char *out, size_t size,
+                                 std::string_view text) {
+  for (char c : text) {
+    out[size++] = c;
+  }
+  return size;
+}
+
+constexpr size_t append_abi_number(char *out, size_t size, size_t number) {
+  char digits[20] = {};
+  size_t count = 0;
+  do {
+    digits[count++] = char('0' + number % 10);
+    number /= 10;
+  } while (number != 0);
+  while (count != 0) {
+    out[size++] = digits[--count];
+  }
+  return size;
+}
+
+// The solidity name of a type in signatures, appended by append()
+template <typename T, typename Enable = void> struct AbiTypeName;
+
+template <typename... Args>
+constexpr size_t append_abi_names(char *out, size_t size) {
+  if constexpr (sizeof...(Args) == 0) {
+    // "()" of an error without arguments
+    (void)out;
+    return size;
+  }
+  bool first = true;
+  ((size = first ? size : append_abi_name(out, size, ","), first = false,
+    size = AbiTypeName<Args>::append(out, size)),
+   ...);
+  return size;
+}
+
+template <typename T>
+struct AbiTypeName<T, std::enable_if_t<std::is_integral<T>::value &&
+                                       !std::is_same<T, bool>::value>> {
+  static constexpr size_t append(char *out, size_t size) {
+    size = append_abi_name(out, size,
+                           std::is_signed<T>::value ? "int" : "uint");
+    return append_abi_number(out, size, 8 * sizeof(T));
+  }
+};
+
+#define DTVM_ABI_TYPE_NAME(Type, name)                                         \
+  template <> struct AbiTypeName<Type> {                                       \
+    static constexpr size_t append(char *out, size_t size) {                   \
+      return append_abi_name(out, size, name);                                 \
+    }                                                                          \
+  };
+
+DTVM_ABI_TYPE_NAME(bool, "bool")
+DTVM_ABI_TYPE_NAME(uint256, "uint256")
+DTVM_ABI_TYPE_NAME(int256, "int256")
+// the fixed point types are encoded as their raw value
+DTVM_ABI_TYPE_NAME(ufixed18, "uint256")
+DTVM_ABI_TYPE_NAME(sfixed18, "int256")
+DTVM_ABI_TYPE_NAME(Address, "address")
+DTVM_ABI_TYPE_NAME(std::string, "string")
+DTVM_ABI_TYPE_NAME(std::string_view, "string")
+DTVM_ABI_TYPE_NAME(Bytes, "bytes")
+DTVM_ABI_TYPE_NAME(BytesView, "bytes")
+
+#undef DTVM_ABI_TYPE_NAME
+
+template <typename T, size_t N> struct AbiTypeName<std::array<T, N>> {
+  static constexpr size_t append(char *out, size_t size) {
+    if constexpr (is_abi_fixed_bytes_v<T, N>) {
+      size = append_abi_name(out, size, "bytes");
+      return append_abi_number(out, size, N);
+    } else {
+      size = AbiTypeName<T>::append(out, size);
+      size = append_abi_name(out, size, "[");
+      size = append_abi_number(out, size, N);
+      return append_abi_name(out, size, "]");
+    }
+  }
+};
+
+template <typename T> struct AbiTypeName<std::vector<T>> {
+  static constexpr size_t append(char *out, size_t size) {
+    size = AbiTypeName<T>::append(out, size);
+    return append_abi_name(out, size, "[]");
+  }
+};
+
+template <typename... Args> struct AbiTypeName<std::tuple<Args...>> {
+  static constexpr size_t append(char *out, size_t size) {
+    size = append_abi_name(out, size, "(");
+    size = append_abi_names<Args...>(out, size);
+    return append_abi_name(out, size, ")");
+  }
+};
+
+template <typename T, typename Fields> struct AbiStructTypeName;
+
+template <typename T, auto... Members>
+struct AbiStructTypeName<T, AbiStructFields<Members...>>
+    : AbiTypeName<std::tuple<member_value_t<Members>...>> {};
+
+template <typename T>
+struct AbiTypeName<T, std::enable_if_t<is_abi_struct_v<T>>>
+    : AbiStructTypeName<T, abi_struct_fields_t<T>> {};
+
+} // namespace detail
+
+// A function or error signature like "transfer(address,uint256)", built at
+// compile time. Longer signatures than CAPACITY do not compile.
+struct AbiSignature {
+  static constexpr size_t CAPACITY = 256;
+  char data[CAPACITY];
+  size_t size;
+
+  constexpr std::string_view view() const {
+    return std::string_view(data, size);
+  }
+};
+
+template <typename... Args>
+constexpr AbiSignature abi_signature(std::string_view name) {
+  AbiSignature signature{};
+  size_t size = detail::append_abi_name(signature.data, 0, name);
+  size = detail::AbiTypeName<std::tuple<Args...>>::append(signature.data, size);
+  signature.size = size;
+  return signature;
+}
+
+// The selector of Error(string), which require and solidity's revert("...")
+// put before the message. revert_with_message in math.hpp encodes it by
+// hand, below the codec.
+constexpr uint32_t ERROR_STRING_SELECTOR = function_selector("Error(string)");
+static_assert(ERROR_STRING_SELECTOR == 0x08c379a0,
+              "revert_with_message hard codes the Error(string) selector");
+
+// Base of the errors declared by DTVM_ERROR, holding the arguments
+template <typename Error, typename Params> class CustomError;
+
+template <typename Error, typename... Args>
+class CustomError<Error, std::tuple<Args...>> {
+public:
+  using custom_error_tag = void;
+
+  CustomError(const Args &...args) : args_(args...) {}
+
+  const std::tuple<Args...> &args() const { return args_; }
+
+  // The revert data: the selector, then the arguments
+  std::vector<uint8_t> encode() const {
+    return std::apply(
+        [](const Args &...args) {
+          return abi_encode_call(Error::SELECTOR, args...);
+        },
+        args_);
+  }
+
+  // Reverts with encode(), built on the stack when every argument is static
+  [[gnu::noinline, gnu::cold]] void revert() const {
+    if constexpr ((!detail::abi_type_t<Args>::DYNAMIC && ...)) {
+      constexpr size_t size = 4 + abi_static_encoded_size<Args...>();
+      uint8_t data[size];
+      data[0] = uint8_t(Error::SELECTOR >> 24);
+      data[1] = uint8_t(Error::SELECTOR >> 16);
+      data[2] = uint8_t(Error::SELECTOR >> 8);
+      data[3] = uint8_t(Error::SELECTOR);
+      std::apply(
+          [&data](const Args &...args) {
+            detail::AbiTupleWriter writer(data + 4, size - 4);
+            (writer.write(args), ...);
+          },
+          args_);
+      hostio::revert(data, int32_t(size));
+    } else {
+      const std::vector<uint8_t> &data = encode();
+      hostio::revert(data.data(), int32_t(data.size()));
+    }
+  }
+
+private:
+  std::tuple<Args...> args_;
+};
+
+template <typename T, typename = void>
+struct is_custom_error : std::false_type {};
+
+template <typename T>
+struct is_custom_error<T, std::void_t<typename T::custom_error_tag>>
+    : std::true_type {};
+
+template <typename T>
+constexpr bool is_custom_error_v = is_custom_error<T>::value;
+
+} // namespace dtvm
+
+// Declares the error type Name with arguments of the given types, at
+// namespace or class scope
+#define DTVM_ERROR(Name, ...)                                                  \
+  struct Name : ::dtvm::CustomError<Name, std::tuple<__VA_ARGS__>> {           \
+    using ::dtvm::CustomError<Name, std::tuple<__VA_ARGS__>>::CustomError;     \
+    static constexpr uint32_t SELECTOR = ::dtvm::function_selector(            \
+        ::dtvm::abi_signature<__VA_ARGS__>(#Name).view());                     \
+  };
@@ -0,0 +1,477 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "hostio.hpp"
+#include "math.hpp"
+#include <cstdint>
+
+namespace dtvm {
+
+// 18 decimals fixed point numbers, the ufixed18 / sfixed18 counterparts of
+// the UD60x18 / SD59x18 solidity types. The raw value is the number scaled by
+// 10^18 and is what the abi and the storage see, so a ufixed18 is encoded as
+// a plain uint256 and a sfixed18 as an int256.
+//
+// Products and quotients go through the 512-bit mul_div, so they only fail
+// when the result itself does not fit. Errors revert like solidity 0.8:
+// Panic(0x11) on overflow, Panic(0x12) on division by zero, and an error
+// message for inputs outside the domain of exp, log and sqrt.
+
+namespace detail {
+
+constexpr uint64_t FIXED18_UNIT = 1000000000000000000ull;
+// log2(e) scaled by 10^18
+constexpr uint64_t FIXED18_LOG2_E = 1442695040888963407ull;
+// exp2 overflows at 192, exp at ln(2^192) (scaled by 10^18)
+constexpr __uint128_t FIXED18_EXP2_MAX_INPUT = __uint128_t(192) * FIXED18_UNIT;
+constexpr __uint128_t FIXED18_EXP_MAX_INPUT =
+    __uint128_t(133084258667509499ull) * 1000 + 440;
+// below these exp2 and exp round to zero
+constexpr __uint128_t FIXED18_EXP2_MIN_NEGATED =
+    __uint128_t(59794705707972522ull) * 1000 + 261;
+constexpr __uint128_t FIXED18_EXP_MIN_NEGATED =
+    __uint128_t(41446531673892822ull) * 1000 + 322;
+
+// Fraction bits of 2^(2^-k), k = 1..64, in 1.64 fixed point rounded to
+// nearest. The integer part is always 1.
+inline constexpr uint64_t exp2_fraction_table[64] = {
+    0x6a09e667f3bcc909, 0x306fe0a31b7152df, 0x172b83c7d517adce,
+    0x0b5586cf9890f62a, 0x059b0d31585743ae, 0x02c9a3e778060ee7,
+    0x0163da9fb33356d8, 0x00b1afa5abcbed61, 0x0058c86da1c09ea2,
+    0x002c605e2e8cec50, 0x00162f3904051fa1, 0x000b175effdc76ba,
+    0x00058ba01fb9f96d, 0x0002c5cc37da9492, 0x000162e525ee0547,
+    0x0000b17255775c04, 0x000058b91b5bc9ae, 0x00002c5c89d5ec6d,
+    0x0000162e43f4f831, 0x00000b1721bcfc9a, 0x0000058b90cf1e6e,
+    0x000002c5c863b73f, 0x00000162e430e5a2, 0x000000b172183551,
+    0x00000058b90c0b49, 0x0000002c5c8601cc, 0x000000162e42fff0,
+    0x0000000b17217fbb, 0x000000058b90bfce, 0x00000002c5c85fe3,
+    0x0000000162e42ff1, 0x00000000b17217f8, 0x0000000058b90bfc,
+    0x000000002c5c85fe, 0x00000000162e42ff, 0x000000000b17217f,
+    0x00000000058b90c0, 0x0000000002c5c860, 0x000000000162e430,
+    0x0000000000b17218, 0x000000000058b90c, 0x00000000002c5c86,
+    0x0000000000162e43, 0x00000000000b1721, 0x0000000000058b91,
+    0x000000000002c5c8, 0x00000000000162e4, 0x000000000000b172,
+    0x00000000000058b9, 0x0000000000002c5d, 0x000000000000162e,
+    0x0000000000000b17, 0x000000000000058c, 0x00000000000002c6,
+    0x0000000000000163, 0x00000000000000b1, 0x0000000000000059,
+    0x000000000000002c, 0x0000000000000016, 0x000000000000000b,
+    0x0000000000000006, 0x0000000000000003, 0x0000000000000001,
+    0x0000000000000001};
+
+// 2^x scaled by 10^18, x in 64.64 fixed point below 192. 1.0 starts as
+// 2^191 and every factor is below 2, so the 256-bit products never overflow.
+constexpr uint256 exp2_64x64(const uint256 &x) {
+  uint256 result = uint256(1) << 191;
+  const uint64_t fraction = uint64_t(x.low);
+  for (int k = 0; k < 64; k++) {
+    if (((fraction >> (63 - k)) & 1) != 0) {
+      // result * 2^(2^-(k+1)) = result + result * fraction_k / 2^64
+      result = result + ((result * uint256(exp2_fraction_table[k])) >> 64);
+    }
+  }
+  const uint64_t integer = uint64_t(x.low >> 64);
+  return (result * uint256(FIXED18_UNIT)) >> size_t(191 - integer);
+}
+
+// 2^x for raw x < 192 * 10^18
+constexpr uint256 fixed18_exp2(const uint256 &x) {
+  return exp2_64x64((x << 64) / uint256(FIXED18_UNIT));
+}
+
+// log2(x) for raw x >= 10^18. The integer part is the msb of x / 10^18, the
+// fraction bits come from repeatedly squaring x / 2^n, which stays in
+// [1, 2) and so fits in native 128-bit products.
+constexpr uint256 fixed18_log2(const uint256 &x) {
+  const int n = msb(x / uint256(FIXED18_UNIT));
+  uint256 result = uint256(uint64_t(n)) * uint256(FIXED18_UNIT);
+  uint64_t y = uint64_t((x >> size_t(n)).low);
+  if (y == FIXED18_UNIT) {
+    return result;
+  }
+  for (uint64_t delta = FIXED18_UNIT / 2; delta > 0; delta >>= 1) {
+    y = uint64_t(__uint128_t(y) * y / FIXED18_UNIT);
+    if (y >= 2 * FIXED18_UNIT) {
+      result = result + uint256(delta);
+      y >>= 1;
+    }
+  }
+  return result;
+}
+
+// sqrt(x) for raw x, the 10^18 rescale must fit in 256 bits
+constexpr uint256 fixed18_sqrt(const uint256 &x) {
+  uint256 scaled;
+  if (mul_overflow(x, uint256(FIXED18_UNIT), scaled)) {
+    revert_with_message("fixed18: sqrt input too big");
+    return uint256(0);
+  }
+  return sqrt(scaled);
+}
+
+// int256 with the given magnitude and sign, reverts with Panic(0x11) when it
+// does not fit
+constexpr int256 fixed18_signed(const uint256 &magnitude, bool negative) {
+  const uint256 &limit = uint256(1) << 255; // |min()|
+  if (negative ? magnitude > limit : magnitude >= limit) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+  }
+  const int256 &result = int256::from_bits(magnitude);
+  return negative ? -result : result;
+}
+
+} // namespace detail
+
+struct ufixed18 {
+  uint256 value; // raw value, the number scaled by 10^18
+
+  constexpr ufixed18() : value() {}
+
+  static constexpr ufixed18 from_raw(const uint256 &raw) {
+    ufixed18 result;
+    result.value = raw;
+    return result;
+  }
+
+  // n * 10^18, reverts with Panic(0x11) when it does not fit
+  static constexpr ufixed18 from_integer(const uint256 &n) {
+    return from_raw(checked_mul(n, uint256(detail::FIXED18_UNIT)));
+  }
+
+  static constexpr ufixed18 unit() {
+    return from_raw(uint256(detail::FIXED18_UNIT));
+  }
+
+  constexpr const uint256 &to_raw() const { return value; }
+
+  // the integer part, rounded down
+  constexpr uint256 to_integer() const {
+    return value / uint256(detail::FIXED18_UNIT);
+  }
+
+  constexpr ufixed18 operator+(const ufixed18 &other) const {
+    return from_raw(checked_add(value, other.value));
+  }
+
+  constexpr ufixed18 operator-(const ufixed18 &other) const {
+    return from_raw(checked_sub(value, other.value));
+  }
+
+  // x * y / 10^18 rounded down
+  constexpr ufixed18 operator*(const ufixed18 &other) const {
+    return from_raw(
+        mul_div(value, other.value, uint256(detail::FIXED18_UNIT)));
+  }
+
+  // x * 10^18 / y rounded down
+  constexpr ufixed18 operator/(const ufixed18 &other) const {
+    return from_raw(
+        mul_div(value, uint256(detail::FIXED18_UNIT), other.value));
+  }
+
+  constexpr ufixed18 &operator+=(const ufixed18 &other) {
+    return *this = *this + other;
+  }
+
+  constexpr ufixed18 &operator-=(const ufixed18 &other) {
+    return *this = *this - other;
+  }
+
+  constexpr ufixed18 &operator*=(const ufixed18 &other) {
+    return *this = *this * other;
+  }
+
+  constexpr ufixed18 &operator/=(const ufixed18 &other) {
+    return *this = *this / other;
+  }
+
+  constexpr bool operator==(const ufixed18 &other) const {
+    return value == other.value;
+  }
+  constexpr bool operator!=(const ufixed18 &other) const {
+    return value != other.value;
+  }
+  constexpr bool operator<(const ufixed18 &other) const {
+    return value < other.value;
+  }
+  constexpr bool operator<=(const ufixed18 &other) const {
+    return value <= other.value;
+  }
+  constexpr bool operator>(const ufixed18 &other) const {
+    return value > other.value;
+  }
+  constexpr bool operator>=(const ufixed18 &other) const {
+    return value >= other.value;
+  }
+};
+
+struct sfixed18 {
+  int256 value; // raw value, the number scaled by 10^18
+
+  constexpr sfixed18() : value() {}
+
+  static constexpr sfixed18 from_raw(const int256 &raw) {
+    sfixed18 result;
+    result.value = raw;
+    return result;
+  }
+
+  // n * 10^18, reverts with Panic(0x11) when it does not fit
+  static constexpr sfixed18 from_integer(const int256 &n) {
+    return from_raw(detail::fixed18_signed(
+        checked_mul(n.abs(), uint256(detail::FIXED18_UNIT)),
+        n.is_negative()));
+  }
+
+  static constexpr sfixed18 unit() {
+    return from_raw(int256(detail::FIXED18_UNIT));
+  }
+
+  constexpr const int256 &to_raw() const { return value; }
+
+  // the integer part, rounded toward zero
+  constexpr int256 to_integer() const {
+    return value / int256(detail::FIXED18_UNIT);
+  }
+
+  constexpr bool is_negative() const { return value.is_negative(); }
+
+  constexpr sfixed18 operator-() const {
+    return from_raw(detail::fixed18_signed(value.abs(), !is_negative()));
+  }
+
+  constexpr sfixed18 operator+(const sfixed18 &other) const {
+    const int256 &result = value + other.value;
+    // overflow when both operands have the same sign and the result not
+    if (is_negative() == other.is_negative() &&
+        result.is_negative() != is_negative()) {
+      panic(PANIC_ARITHMETIC_OVERFLOW);
+    }
+    return from_raw(result);
+  }
+
+  constexpr sfixed18 operator-(const sfixed18 &other) const {
+    const int256 &result = value - other.value;
+    if (is_negative() != other.is_negative() &&
+        result.is_negative() != is_negative()) {
+      panic(PANIC_ARITHMETIC_OVERFLOW);
+    }
+    return from_raw(result);
+  }
+
+  // x * y / 10^18 rounded toward zero
+  constexpr sfixed18 operator*(const sfixed18 &other) const {
+    return from_raw(detail::fixed18_signed(
+        mul_div(value.abs(), other.value.abs(),
+                uint256(detail::FIXED18_UNIT)),
+        is_negative() != other.is_negative()));
+  }
+
+  // x * 10^18 / y rounded toward zero
+  constexpr sfixed18 operator/(const sfixed18 &other) const {
+    return from_raw(detail::fixed18_signed(
+        mul_div(value.abs(), uint256(detail::FIXED18_UNIT),
+                other.value.abs()),
+        is_negative() != other.is_negative()));
+  }
+
+  constexpr sfixed18 &operator+=(const sfixed18 &other) {
+    return *this = *this + other;
+  }
+
+  constexpr sfixed18 &operator-=(const sfixed18 &other) {
+    return *this = *this - other;
+  }
+
+  constexpr sfixed18 &operator*=(const sfixed18 &other) {
+    return *this = *this * other;
+  }
+
+  constexpr sfixed18 &operator/=(const sfixed18 &other) {
+    return *this = *this / other;
+  }
+
+  constexpr bool operator==(const sfixed18 &other) const {
+    return value == other.value;
+  }
+  constexpr bool operator!=(const sfixed18 &other) const {
+    return value != other.value;
+  }
+  constexpr bool operator<(const sfixed18 &other) const {
+    return value < other.value;
+  }
+  constexpr bool operator<=(const sfixed18 &other) const {
+    return value <= other.value;
+  }
+  constexpr bool operator>(const sfixed18 &other) const {
+    return value > other.value;
+  }
+  constexpr bool operator>=(const sfixed18 &other) const {
+    return value >= other.value;
+  }
+};
+
+// ufixed18 functions
+
+// 2^x, reverts for x >= 192
+constexpr ufixed18 exp2(const ufixed18 &x) {
+  if (x.value >= uint256(detail::FIXED18_EXP2_MAX_INPUT)) {
+    revert_with_message("ufixed18: exp2 input too big");
+    return ufixed18();
+  }
+  return ufixed18::from_raw(detail::fixed18_exp2(x.value));
+}
+
+// e^x computed as 2^(x * log2(e)), reverts for x > 133.084258667509499440
+constexpr ufixed18 exp(const ufixed18 &x) {
+  if (x.value > uint256(detail::FIXED18_EXP_MAX_INPUT)) {
+    revert_with_message("ufixed18: exp input too big");
+    return ufixed18();
+  }
+  return exp2(x * ufixed18::from_raw(uint256(detail::FIXED18_LOG2_E)));
+}
+
+// log2(x), reverts for x < 1 where the result would be negative
+constexpr ufixed18 log2(const ufixed18 &x) {
+  if (x < ufixed18::unit()) {
+    revert_with_message("ufixed18: log input too small");
+    return ufixed18();
+  }
+  return ufixed18::from_raw(detail::fixed18_log2(x.value));
+}
+
+// ln(x) = log2(x) / log2(e), reverts for x < 1
+constexpr ufixed18 ln(const ufixed18 &x) {
+  return ufixed18::from_raw(log2(x).value * uint256(detail::FIXED18_UNIT) /
+                            uint256(detail::FIXED18_LOG2_E));
+}
+
+// reverts when x * 10^18 does not fit in 256 bits
+constexpr ufixed18 sqrt(const ufixed18 &x) {
+  return ufixed18::from_raw(detail::fixed18_sqrt(x.value));
+}
+
+// x^y = 2^(log2(x) * y). Bases below 1 go through 1/x so log2 stays
+// positive: x^y = 1 / (1/x)^y.
+constexpr ufixed18 pow(const ufixed18 &x, const ufixed18 &y) {
+  const ufixed18 &one = ufixed18::unit();
+  if (x == ufixed18()) {
+    return y == ufixed18() ? one : ufixed18();
+  }
+  if (x == one || y == ufixed18()) {
+    return one;
+  }
+  if (y == one) {
+    return x;
+  }
+  if (x > one) {
+    return exp2(log2(x) * y);
+  }
+  return one / exp2(log2(one / x) * y);
+}
+
+// x^n for an integer n by square and multiply, each step rounds down
+constexpr ufixed18 powu(const ufixed18 &x, const uint256 &n) {
+  ufixed18 result = (n.low & 1) != 0 ? x : ufixed18::unit();
+  ufixed18 square = x;
+  for (uint256 rest = n >> 1; rest != uint256(0); rest = rest >> 1) {
+    square = square * square;
+    if ((rest.low & 1) != 0) {
+      result = result * square;
+    }
+  }
+  return result;
+}
+
+// sfixed18 functions
+
+// 2^x, rounds to zero below -59.794705707972522261 and reverts for x >= 192
+constexpr sfixed18 exp2(const sfixed18 &x) {
+  if (x.is_negative()) {
+    const uint256 &negated = x.value.abs();
+    if (negated > uint256(detail::FIXED18_EXP2_MIN_NEGATED)) {
+      return sfixed18();
+    }
+    // 2^x = 1 / 2^-x
+    const uint256 &unit = uint256(detail::FIXED18_UNIT);
+    return sfixed18::from_raw(
+        int256(unit * unit / detail::fixed18_exp2(negated)));
+  }
+  if (x.value >= int256(uint256(detail::FIXED18_EXP2_MAX_INPUT))) {
+    revert_with_message("sfixed18: exp2 input too big");
+    return sfixed18();
+  }
+  return sfixed18::from_raw(int256(detail::fixed18_exp2(x.value.abs())));
+}
+
+// e^x computed as 2^(x * log2(e)), rounds to zero below
+// -41.446531673892822322 and reverts above 133.084258667509499440
+constexpr sfixed18 exp(const sfixed18 &x) {
+  if (x.is_negative()) {
+    if (x.value.abs() > uint256(detail::FIXED18_EXP_MIN_NEGATED)) {
+      return sfixed18();
+    }
+  } else if (x.value.abs() > uint256(detail::FIXED18_EXP_MAX_INPUT)) {
+    revert_with_message("sfixed18: exp input too big");
+    return sfixed18();
+  }
+  return exp2(x * sfixed18::from_raw(int256(detail::FIXED18_LOG2_E)));
+}
+
+// log2(x) for x > 0, log2(x) = -log2(1/x) when x < 1
+constexpr sfixed18 log2(const sfixed18 &x) {
+  if (x.is_negative() || x.value == int256(0)) {
+    revert_with_message("sfixed18: log input must be positive");
+    return sfixed18();
+  }
+  const uint256 &unit = uint256(detail::FIXED18_UNIT);
+  const uint256 &raw = x.value.abs();
+  if (raw >= unit) {
+    return sfixed18::from_raw(int256(detail::fixed18_log2(raw)));
+  }
+  return sfixed18::from_raw(-int256(detail::fixed18_log2(unit * unit / raw)));
+}
+
+// ln(x) = log2(x) / log2(e) for x > 0
+constexpr sfixed18 ln(const sfixed18 &x) {
+  return sfixed18::from_raw(log2(x).value * int256(detail::FIXED18_UNIT) /
+                            int256(detail::FIXED18_LOG2_E));
+}
+
+// reverts for negative x and when x * 10^18 does not fit in 255 bits
+constexpr sfixed18 sqrt(const sfixed18 &x) {
+  if (x.is_negative()) {
+    revert_with_message("sfixed18: sqrt input must not be negative");
+    return sfixed18();
+  }
+  if (x.value > int256::max() / int256(detail::FIXED18_UNIT)) {
+    revert_with_message("sfixed18: sqrt input too big");
+    return sfixed18();
+  }
+  return sfixed18::from_raw(int256(detail::fixed18_sqrt(x.value.abs())));
+}
+
+// x^y = 2^(log2(x) * y) for x >= 0
+constexpr sfixed18 pow(const sfixed18 &x, const sfixed18 &y) {
+  const sfixed18 &one = sfixed18::unit();
+  if (x == sfixed18()) {
+    return y == sfixed18() ? one : sfixed18();
+  }
+  if (x == one || y == sfixed18()) {
+    return one;
+  }
+  if (y == one) {
+    return x;
+  }
+  return exp2(log2(x) * y);
+}
+
+// x^n for an integer n, negative bases give a negative result for odd n
+constexpr sfixed18 powu(const sfixed18 &x, const uint256 &n) {
+  const uint256 &magnitude =
+      powu(ufixed18::from_raw(x.value.abs()), n).value;
+  return sfixed18::from_raw(
+      detail::fixed18_signed(magnitude, x.is_negative() && (n.low & 1) != 0));
+}
+
+} // namespace dtvm
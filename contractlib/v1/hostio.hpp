@@ -80,27 +80,55 @@ inline void emit_log(const std::vector<std::vector<uint8_t>> &topics,
 
 inline uint64_t get_gas_left() { return (uint64_t)::getGasLeft(); }
 
-inline bytes32 read_storage(const dtvm::uint256 &key) {
+inline bytes32 read_storage(const bytes32 &key) {
   // if not exist, return 32 bytes zero
   bytes32 result = {0};
-  ::storageLoad((ADDRESS_UINT) reinterpret_cast<intptr_t>(key.bytes().data()),
+  ::storageLoad((ADDRESS_UINT) reinterpret_cast<intptr_t>(key.data()),
                 (ADDRESS_UINT) reinterpret_cast<intptr_t>(result.data()));
   return result;
 }
 
-inline void write_storage(const dtvm::uint256 &key, const bytes32 &value) {
-  ::storageStore((ADDRESS_UINT) reinterpret_cast<intptr_t>(key.bytes().data()),
+inline bytes32 read_storage(const dtvm::uint256 &key) {
+  return read_storage(key.bytes());
+}
+
+inline void write_storage(const bytes32 &key, const bytes32 &value) {
+  ::storageStore((ADDRESS_UINT) reinterpret_cast<intptr_t>(key.data()),
                  (ADDRESS_UINT) reinterpret_cast<intptr_t>(value.data()));
 }
 
-inline bytes32 keccak256(const std::vector<uint8_t> &data) {
+inline void write_storage(const dtvm::uint256 &key, const bytes32 &value) {
+  write_storage(key.bytes(), value);
+}
+
+// Load a storage word straight into an uint256, the big endian bytes are
+// converted once on the stack without an intermediate bytes32
+inline dtvm::uint256 read_storage_word(const bytes32 &key) {
+  uint8_t result[32] = {0};
+  ::storageLoad((ADDRESS_UINT) reinterpret_cast<intptr_t>(key.data()),
+                (ADDRESS_UINT) reinterpret_cast<intptr_t>(result));
+  return dtvm::uint256::from_be_bytes(result);
+}
+
+inline void write_storage_word(const bytes32 &key,
+                               const dtvm::uint256 &value) {
+  uint8_t encoded[32];
+  value.to_be_bytes(encoded);
+  ::storageStore((ADDRESS_UINT) reinterpret_cast<intptr_t>(key.data()),
+                 (ADDRESS_UINT) reinterpret_cast<intptr_t>(encoded));
+}
+
+inline bytes32 keccak256(const uint8_t *data, size_t size) {
   bytes32 result;
-  ::keccak256((ADDRESS_UINT) reinterpret_cast<intptr_t>(data.data()),
-              (int32_t)data.size(),
+  ::keccak256((ADDRESS_UINT) reinterpret_cast<intptr_t>(data), (int32_t)size,
               (ADDRESS_UINT) reinterpret_cast<intptr_t>(result.data()));
   return result;
 }
 
+inline bytes32 keccak256(const std::vector<uint8_t> &data) {
+  return keccak256(data.data(), data.size());
+}
+
 inline bytes32 keccak256(const bytes32 &data) {
   bytes32 result{};
   ::keccak256((ADDRESS_UINT) reinterpret_cast<intptr_t>(data.data()),
@@ -0,0 +1,139 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "math.hpp"
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace dtvm {
+
+// Keccak-256 evaluated by the compiler, for hashes of constant strings such
+// as function selectors and event topics:
+//
+//   case DTVM_SELECTOR("transfer(address,uint256)"): ...
+//   constexpr bytes32 topic =
+//       DTVM_EVENT_TOPIC("Transfer(address,address,uint256)");
+//
+// The macros force compile time evaluation, so dispatch and logging pay no
+// hashing at runtime and the numbers can not drift from the signatures.
+// Data only known at runtime is hashed by hostio::keccak256 instead.
+
+namespace detail {
+
+constexpr uint64_t KECCAK_ROUND_CONSTANTS[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+// rotation of lane x + 5 * y in the rho step
+constexpr unsigned KECCAK_ROTATIONS[25] = {
+    0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+    25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14};
+
+// bytes absorbed per permutation, 1600 bits minus twice the 256-bit output
+constexpr size_t KECCAK256_RATE = 136;
+
+constexpr uint64_t rotl64(uint64_t value, unsigned shift) {
+  return shift == 0 ? value : (value << shift) | (value >> (64 - shift));
+}
+
+constexpr void keccak_f1600(uint64_t (&lanes)[25]) {
+  for (size_t round = 0; round < 24; round++) {
+    // theta
+    uint64_t columns[5] = {};
+    for (size_t x = 0; x < 5; x++) {
+      columns[x] = lanes[x] ^ lanes[x + 5] ^ lanes[x + 10] ^ lanes[x + 15] ^
+                   lanes[x + 20];
+    }
+    for (size_t x = 0; x < 5; x++) {
+      const uint64_t d = columns[(x + 4) % 5] ^ rotl64(columns[(x + 1) % 5], 1);
+      for (size_t y = 0; y < 25; y += 5) {
+        lanes[x + y] ^= d;
+      }
+    }
+    // rho and pi
+    uint64_t moved[25] = {};
+    for (size_t x = 0; x < 5; x++) {
+      for (size_t y = 0; y < 5; y++) {
+        moved[y + 5 * ((2 * x + 3 * y) % 5)] =
+            rotl64(lanes[x + 5 * y], KECCAK_ROTATIONS[x + 5 * y]);
+      }
+    }
+    // chi
+    for (size_t y = 0; y < 25; y += 5) {
+      for (size_t x = 0; x < 5; x++) {
+        lanes[x + y] = moved[x + y] ^
+                       (~moved[(x + 1) % 5 + y] & moved[(x + 2) % 5 + y]);
+      }
+    }
+    // iota
+    lanes[0] ^= KECCAK_ROUND_CONSTANTS[round];
+  }
+}
+
+// xors byte i of a block into the little endian lanes
+constexpr void keccak_absorb_byte(uint64_t (&lanes)[25], size_t i,
+                                  uint8_t byte) {
+  lanes[i / 8] ^= uint64_t(byte) << (8 * (i % 8));
+}
+
+} // namespace detail
+
+// Keccak-256 of data (the original padding used by ethereum, not SHA3-256)
+constexpr bytes32 const_keccak256(std::string_view data) {
+  uint64_t lanes[25] = {};
+  size_t offset = 0;
+  for (; data.size() - offset >= detail::KECCAK256_RATE;
+       offset += detail::KECCAK256_RATE) {
+    for (size_t i = 0; i < detail::KECCAK256_RATE; i++) {
+      detail::keccak_absorb_byte(lanes, i, uint8_t(data[offset + i]));
+    }
+    detail::keccak_f1600(lanes);
+  }
+  const size_t rest = data.size() - offset;
+  for (size_t i = 0; i < rest; i++) {
+    detail::keccak_absorb_byte(lanes, i, uint8_t(data[offset + i]));
+  }
+  detail::keccak_absorb_byte(lanes, rest, 0x01);
+  detail::keccak_absorb_byte(lanes, detail::KECCAK256_RATE - 1, 0x80);
+  detail::keccak_f1600(lanes);
+
+  bytes32 result{};
+  for (size_t i = 0; i < 32; i++) {
+    result[i] = uint8_t(lanes[i / 8] >> (8 * (i % 8)));
+  }
+  return result;
+}
+
+// The first four bytes of the hash of a signature like
+// "transfer(address,uint256)", big endian as read by Input::read_selector
+constexpr uint32_t function_selector(std::string_view signature) {
+  const bytes32 hash = const_keccak256(signature);
+  return uint32_t(hash[0]) << 24 | uint32_t(hash[1]) << 16 |
+         uint32_t(hash[2]) << 8 | uint32_t(hash[3]);
+}
+
+// topic0 of an event, the whole hash of its signature
+constexpr bytes32 event_topic(std::string_view signature) {
+  return const_keccak256(signature);
+}
+
+} // namespace dtvm
+
+// Constant expressions, usable as case labels and template arguments
+#define DTVM_SELECTOR(signature)                                               \
+  (std::integral_constant<uint32_t,                                            \
+                          ::dtvm::function_selector(signature)>::value)
+
+#define DTVM_EVENT_TOPIC(signature)                                            \
+  ([] {                                                                        \
+    constexpr ::dtvm::bytes32 topic = ::dtvm::event_topic(signature);          \
+    return topic;                                                              \
+  }())
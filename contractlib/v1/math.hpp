@@ -6,206 +6,1706 @@
 #include <array>
 #include <climits>
 #include <cstdint>
+#include <cstring>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 
 namespace dtvm {
 
 typedef std::array<uint8_t, 32> bytes32;
 typedef std::array<uint8_t, 20> bytes20;
 
-struct uint256 {
-  __uint128_t high;
-  __uint128_t low;
-  uint256() : high(0), low(0) {}
-  uint256(__uint128_t low) : high(0), low(low) {}
-  uint256(const uint256 &other) : high(other.high), low(other.low) {}
+// Solidity panic codes
+// https://docs.soliditylang.org/en/latest/control-structures.html#panic-via-assert-and-error-via-require
+enum PanicCode : uint8_t {
+  PANIC_ARITHMETIC_OVERFLOW = 0x11,
+  PANIC_DIVISION_BY_ZERO = 0x12,
+};
 
-  uint256(__uint128_t high_part, __uint128_t low_part)
-      : high(high_part), low(low_part) {}
-  uint256(const bytes32 &bs) { // big endian bytes
-    __uint128_t highB_bytes = 0, low_bytes = 0;
-    // Convert byte sequence from big-endian to little-endian __uint128_t
-    for (size_t i = 0; i < sizeof(high); ++i) {
-      highB_bytes |= static_cast<__uint128_t>(bs[i])
-                     << (8 * (sizeof(high) - i - 1));
+// Revert with the Solidity Panic(uint256) encoding, the same data a solidity
+// contract reverts with on failed arithmetic
+inline void panic(uint8_t code) {
+  // selector of Panic(uint256) followed by the big endian code
+  uint8_t data[36] = {0x4e, 0x48, 0x7b, 0x71};
+  for (size_t i = 4; i < 35; i++) {
+    data[i] = 0;
+  }
+  data[35] = code;
+  ::revert((ADDRESS_UINT) reinterpret_cast<intptr_t>(data), 36);
+}
+
+// Revert with the Solidity Error(string) encoding of message, the data of
+// require(false, message) and revert(message). Kept out of line, so the
+// checks that call it stay a single branch.
+[[gnu::noinline, gnu::cold]] inline void
+revert_with_message(std::string_view message) {
+  // selector of Error(string), the offset 0x20, the length, then the
+  // message zero padded to a multiple of 32 bytes
+  const size_t size = message.size();
+  std::vector<uint8_t> data(4 + 64 + (size + 31) / 32 * 32, 0);
+  data[0] = 0x08;
+  data[1] = 0xc3;
+  data[2] = 0x79;
+  data[3] = 0xa0;
+  data[35] = 0x20;
+  for (size_t i = 0; i < sizeof(size_t); i++) {
+    data[67 - i] = uint8_t(size >> (8 * i));
+  }
+  if (size != 0) {
+    memcpy(data.data() + 68, message.data(), size);
+  }
+  ::revert((ADDRESS_UINT) reinterpret_cast<intptr_t>(data.data()),
+           (int32_t)data.size());
+}
+
+#ifdef __has_builtin
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define DTVM_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+namespace detail {
+
+// Long division helpers work on little endian 32-bit digits, so every step
+// only needs 64-bit multiplications and divisions, which are native
+// instructions in wasm (128-bit ones lower to compiler-rt libcalls).
+
+constexpr int clz32(uint32_t x) { return x == 0 ? 32 : __builtin_clz(x); }
+
+// Big endian 64-bit load/store, a single bswap on little endian hosts
+// (wasm and x86). Constant evaluation cannot memcpy, it assembles the bytes.
+constexpr uint64_t load_be64(const uint8_t *data) {
+#ifdef DTVM_HAS_IS_CONSTANT_EVALUATED
+  if (!__builtin_is_constant_evaluated()) {
+    uint64_t v = 0;
+    memcpy(&v, data, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return v;
+#else
+    return __builtin_bswap64(v);
+#endif
+  }
+#endif
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++) {
+    v = (v << 8) | data[i];
+  }
+  return v;
+}
+
+constexpr void store_be64(uint8_t *data, uint64_t v) {
+#ifdef DTVM_HAS_IS_CONSTANT_EVALUATED
+  if (!__builtin_is_constant_evaluated()) {
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    memcpy(data, &v, 8);
+    return;
+  }
+#endif
+  for (int i = 7; i >= 0; i--) {
+    data[i] = uint8_t(v);
+    v >>= 8;
+  }
+}
+
+// Number of significant digits, 0 for zero
+constexpr int significant_digits(const uint32_t *digits, int count) {
+  while (count > 0 && digits[count - 1] == 0) {
+    --count;
+  }
+  return count;
+}
+
+// Divide the m digits number u by the single digit v (v != 0), q gets m
+// digits, returns the remainder
+constexpr uint32_t divmod_digits_by_digit(const uint32_t *u, int m, uint32_t v,
+                                       uint32_t *q) {
+  uint64_t rem = 0;
+  for (int i = m - 1; i >= 0; --i) {
+    uint64_t cur = (rem << 32) | u[i];
+    q[i] = uint32_t(cur / v);
+    rem = cur % v;
+  }
+  return uint32_t(rem);
+}
+
+// Knuth, TAOCP Vol. 2, 4.3.1, Algorithm D.
+// u has m digits, v has n digits with n >= 2, v[n-1] != 0 and m >= n.
+// q gets m-n+1 digits and r gets n digits. MaxDigits bounds m, so the
+// working copies live on the stack.
+template <int MaxDigits>
+constexpr void knuth_divmod(const uint32_t *u, int m, const uint32_t *v, int n,
+                  uint32_t *q, uint32_t *r) {
+  const uint64_t base = uint64_t(1) << 32;
+  uint32_t un[MaxDigits + 1] = {};
+  uint32_t vn[MaxDigits] = {};
+
+  // D1. normalize so the top digit of the divisor has its high bit set
+  int s = clz32(v[n - 1]);
+  for (int i = n - 1; i > 0; --i) {
+    vn[i] = uint32_t((uint64_t(v[i]) << s) | (uint64_t(v[i - 1]) >> (32 - s)));
+  }
+  vn[0] = v[0] << s;
+  un[m] = uint32_t(uint64_t(u[m - 1]) >> (32 - s));
+  for (int i = m - 1; i > 0; --i) {
+    un[i] = uint32_t((uint64_t(u[i]) << s) | (uint64_t(u[i - 1]) >> (32 - s)));
+  }
+  un[0] = u[0] << s;
+
+  for (int j = m - n; j >= 0; --j) {
+    // D3. estimate the quotient digit from the top two digits, it is at most
+    // 2 too large after the correction loop
+    uint64_t num = (uint64_t(un[j + n]) << 32) | un[j + n - 1];
+    uint64_t qhat = num / vn[n - 1];
+    uint64_t rhat = num - qhat * vn[n - 1];
+    while (qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+      --qhat;
+      rhat += vn[n - 1];
+      if (rhat >= base) {
+        break;
+      }
+    }
+
+    // D4. multiply and subtract
+    int64_t borrow = 0;
+    int64_t t = 0;
+    for (int i = 0; i < n; ++i) {
+      uint64_t p = qhat * vn[i];
+      t = int64_t(un[i + j]) - borrow - int64_t(p & 0xFFFFFFFFull);
+      un[i + j] = uint32_t(t);
+      borrow = int64_t(p >> 32) - (t >> 32);
     }
-    for (size_t i = 0; i < sizeof(low); ++i) {
-      low_bytes |= static_cast<__uint128_t>(bs[i + 16])
-                   << (8 * (sizeof(low) - i - 1));
+    t = int64_t(un[j + n]) - borrow;
+    un[j + n] = uint32_t(t);
+
+    // D5/D6. add back when the estimate was one too large (rare)
+    q[j] = uint32_t(qhat);
+    if (t < 0) {
+      q[j] -= 1;
+      uint64_t carry = 0;
+      for (int i = 0; i < n; ++i) {
+        uint64_t sum = uint64_t(un[i + j]) + vn[i] + carry;
+        un[i + j] = uint32_t(sum);
+        carry = sum >> 32;
+      }
+      un[j + n] = uint32_t(un[j + n] + carry);
     }
-    high = highB_bytes;
-    low = low_bytes;
   }
-  // Addition operator
-  uint256 operator+(const uint256 &other) const {
-    __uint128_t newLow = low + other.low;
-    __uint128_t carry = newLow < low; // Check if there is a carry
-    newLow = newLow &
-             ~(carry << (sizeof(__uint128_t) * 8 - 1)); // Clear the carry bit
-    __uint128_t newHigh = high + other.high + carry;
-    return uint256(newHigh, newLow);
+
+  // D8. unnormalize the remainder
+  for (int i = 0; i < n - 1; ++i) {
+    r[i] = uint32_t((uint64_t(un[i]) >> s) | (uint64_t(un[i + 1]) << (32 - s)));
+  }
+  r[n - 1] = uint32_t(uint64_t(un[n - 1]) >> s);
+}
+
+} // namespace detail
+
+// uint256 arithmetic backends. The storage is always the two __uint128_t
+// halves, the backend only picks how add, sub, mul, shifts and compares are
+// computed. Select one with -DDTVM_UINT256_BACKEND=<value>:
+// - DTVM_UINT256_BACKEND_U128: native __uint128_t arithmetic, best on 64-bit
+//   hosts that have 128-bit multiply and shift instructions
+// - DTVM_UINT256_BACKEND_LIMB64: 4x64-bit limbs with add-with-carry chains,
+//   only emits native i64 instructions on wasm32 where 128-bit multiply and
+//   variable shifts are compiler-rt libcalls
+// - DTVM_UINT256_BACKEND_BITINT: clang's unsigned _BitInt(256)
+// The default is LIMB64 in wasm and U128 elsewhere.
+#define DTVM_UINT256_BACKEND_U128 1
+#define DTVM_UINT256_BACKEND_LIMB64 2
+#define DTVM_UINT256_BACKEND_BITINT 3
+
+#ifndef DTVM_UINT256_BACKEND
+#ifdef IN_WASM_ENV
+#define DTVM_UINT256_BACKEND DTVM_UINT256_BACKEND_LIMB64
+#else
+#define DTVM_UINT256_BACKEND DTVM_UINT256_BACKEND_U128
+#endif
+#endif
+
+// 512 bits are needed for the overflow checked multiplication
+#if defined(__BITINT_MAXWIDTH__) && __BITINT_MAXWIDTH__ >= 512
+#define DTVM_HAS_BITINT_256 1
+#endif
+
+#ifdef __has_builtin
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#define DTVM_HAS_BUILTIN_ADDC 1
+#endif
+#endif
+
+namespace detail {
+
+// a + b + carry_in, the carry out is 0 or 1
+constexpr uint64_t addc64(uint64_t a, uint64_t b, uint64_t carry_in,
+                       uint64_t &carry_out) {
+#if defined(DTVM_HAS_BUILTIN_ADDC) && defined(DTVM_HAS_IS_CONSTANT_EVALUATED)
+  if (!__builtin_is_constant_evaluated()) {
+    unsigned long long carry = 0;
+    uint64_t sum = __builtin_addcll(a, b, carry_in, &carry);
+    carry_out = carry;
+    return sum;
+  }
+#endif
+  uint64_t sum = 0;
+  bool c1 = __builtin_add_overflow(a, b, &sum);
+  bool c2 = __builtin_add_overflow(sum, carry_in, &sum);
+  carry_out = c1 | c2;
+  return sum;
+}
+
+// a - b - borrow_in, the borrow out is 0 or 1
+constexpr uint64_t subb64(uint64_t a, uint64_t b, uint64_t borrow_in,
+                       uint64_t &borrow_out) {
+#if defined(DTVM_HAS_BUILTIN_ADDC) && defined(DTVM_HAS_IS_CONSTANT_EVALUATED)
+  if (!__builtin_is_constant_evaluated()) {
+    unsigned long long borrow = 0;
+    uint64_t diff = __builtin_subcll(a, b, borrow_in, &borrow);
+    borrow_out = borrow;
+    return diff;
+  }
+#endif
+  uint64_t diff = 0;
+  bool b1 = __builtin_sub_overflow(a, b, &diff);
+  bool b2 = __builtin_sub_overflow(diff, borrow_in, &diff);
+  borrow_out = b1 | b2;
+  return diff;
+}
+
+// Full 64x64 -> 128-bit product, returns the low half. wasm32 has no
+// 64-bit multiply-high, so it is built from 32-bit halves there instead of
+// calling __multi3.
+constexpr uint64_t mul64(uint64_t a, uint64_t b, uint64_t &high) {
+#ifdef IN_WASM_ENV
+  uint64_t a_lo = uint32_t(a), a_hi = a >> 32;
+  uint64_t b_lo = uint32_t(b), b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo;
+  uint64_t hi_lo = a_hi * b_lo;
+  uint64_t lo_hi = a_lo * b_hi;
+  uint64_t hi_hi = a_hi * b_hi;
+  uint64_t cross = (lo_lo >> 32) + uint32_t(hi_lo) + lo_hi;
+  high = hi_hi + (hi_lo >> 32) + (cross >> 32);
+  return (cross << 32) | uint32_t(lo_lo);
+#else
+  __uint128_t product = __uint128_t(a) * b;
+  high = uint64_t(product >> 64);
+  return uint64_t(product);
+#endif
+}
+
+// Division by a 64-bit constant with a precomputed reciprocal (Moller and
+// Granlund, "Improved division by invariant integers", 2011). The divisor is
+// shifted until its top bit is set and v = floor((2^128 - 1) / NORM) - 2^64
+// is folded at compile time, so each 128 by 64-bit step is two multiplies
+// and two corrections instead of a __udivti3 call.
+template <uint64_t D> struct ConstantDivisor {
+  static_assert(D != 0, "division by zero");
+  static constexpr int SHIFT = __builtin_clzll(D);
+  static constexpr uint64_t NORM = D << SHIFT;
+  static constexpr uint64_t RECIPROCAL =
+      uint64_t(~__uint128_t(0) / NORM - (__uint128_t(1) << 64));
+
+  // (rem * 2^64 + u) / NORM, requires rem < NORM. rem receives the new
+  // remainder.
+  static constexpr uint64_t step(uint64_t &rem, uint64_t u) {
+    uint64_t q1 = 0;
+    uint64_t q0 = mul64(RECIPROCAL, rem, q1);
+    uint64_t carry = 0;
+    q0 = addc64(q0, u, 0, carry);
+    q1 += rem + 1 + carry;
+    uint64_t r = u - q1 * NORM;
+    // the estimate is at most one too large or one too small
+    if (r > q0) {
+      q1--;
+      r += NORM;
+    }
+    if (r >= NORM) {
+      q1++;
+      r -= NORM;
+    }
+    rem = r;
+    return q1;
+  }
+};
+
+struct U128Backend {
+  template <typename U> static constexpr U add(const U &a, const U &b) {
+    __uint128_t new_low = a.low + b.low;
+    __uint128_t carry = new_low < a.low;
+    return U(a.high + b.high + carry, new_low);
+  }
+
+  template <typename U> static constexpr U sub(const U &a, const U &b) {
+    __uint128_t new_low = a.low - b.low;
+    __uint128_t borrow = a.low < b.low;
+    return U(a.high - b.high - borrow, new_low);
+  }
+
+  // The *_overflow forms return the wrapped result in out and whether the
+  // carry (or borrow) left the 256 bits
+  template <typename U>
+  static constexpr bool add_overflow(const U &a, const U &b, U &out) {
+    __uint128_t new_low = a.low + b.low;
+    __uint128_t carry = new_low < a.low;
+    __uint128_t new_high = 0;
+    bool overflow = __builtin_add_overflow(a.high, b.high, &new_high);
+    overflow |= __builtin_add_overflow(new_high, carry, &new_high);
+    out = U(new_high, new_low);
+    return overflow;
+  }
+
+  template <typename U>
+  static constexpr bool sub_overflow(const U &a, const U &b, U &out) {
+    __uint128_t new_low = a.low - b.low;
+    __uint128_t borrow = a.low < b.low;
+    __uint128_t new_high = 0;
+    bool overflow = __builtin_sub_overflow(a.high, b.high, &new_high);
+    overflow |= __builtin_sub_overflow(new_high, borrow, &new_high);
+    out = U(new_high, new_low);
+    return overflow;
+  }
+
+  template <typename U>
+  static constexpr bool mul_overflow(const U &a, const U &b, U &out) {
+    // a.high * b.high is at least 2^256 when both are non zero, the cross
+    // products must fit in 128 bits and their sum must not carry out
+    bool overflow = a.high != 0 && b.high != 0;
+    U cross1 = U::multiply128(a.high, b.low);
+    U cross2 = U::multiply128(b.high, a.low);
+    overflow |= cross1.high != 0 || cross2.high != 0;
+    U low = U::multiply128(a.low, b.low);
+    __uint128_t new_high = low.high;
+    overflow |= __builtin_add_overflow(new_high, cross1.low, &new_high);
+    overflow |= __builtin_add_overflow(new_high, cross2.low, &new_high);
+    out = U(new_high, low.low);
+    return overflow;
   }
 
-  uint256 operator-(const uint256 &other) const {
-    __uint128_t newLow = low - other.low;
-    __uint128_t borrow = newLow > low; // Check if there is a borrow
-    newLow = newLow &
-             ~(borrow << (sizeof(__uint128_t) * 8 - 1)); // Clear the borrow bit
-    __uint128_t newHigh = high - other.high - borrow;
-    return uint256(newHigh, newLow);
+  template <typename U> static constexpr U mul(const U &a, const U &b) {
+    // The high part * high part result has already overflowed, so no need
+    // to consider it. new high part = a.high * b.low + b.high * a.low +
+    // overflow part (a.low * b.low), new low part = a.low * b.low
+    __uint128_t new_high =
+        a.high * b.low + b.high * a.low + U::multiply128(a.low, b.low).high;
+    return U(new_high, a.low * b.low);
   }
 
-  uint256 operator>>(size_t shift) const {
+  template <typename U> static constexpr U shl(const U &a, size_t shift) {
     if (shift == 0) {
-      return *this;
-    }
-    if (shift == 128) {
-      return uint256(0, high);
-    }
-    shift =
-        shift > 256 ? 256 : shift; // Limit the shift to no more than 256 bits
-    uint256 result;
-    if (shift > 128) {
-      // all low shifted
-      result.low = high >> (shift - 128);
-      result.high = 0;
-    } else {
-      result.high = high >> shift;
-      result.low = (low >> shift) + (high << (128 - shift));
+      return a;
     }
-    return result;
+    if (shift >= 256) {
+      return U(0);
+    }
+    if (shift >= 128) {
+      return U(a.low << (shift - 128), 0);
+    }
+    return U((a.high << shift) | (a.low >> (128 - shift)), a.low << shift);
   }
 
-  uint256 operator<<(size_t shift) const {
+  template <typename U> static constexpr U shr(const U &a, size_t shift) {
     if (shift == 0) {
-      return *this;
-    }
-    if (shift == 128) {
-      return uint256(low, 0);
-    }
-    shift =
-        shift > 256 ? 256 : shift; // Limit the shift to no more than 256 bits
-    uint256 result;
-    if (shift > 128) {
-      // all high shifted
-      result.high = low << (shift - 128);
-      result.low = 0;
-    } else {
-      result.high = (high << shift) + (low >> (128 - shift));
-      result.low = low << shift;
+      return a;
     }
-    return result;
+    if (shift >= 256) {
+      return U(0);
+    }
+    if (shift >= 128) {
+      return U(0, a.high >> (shift - 128));
+    }
+    return U(a.high >> shift, (a.low >> shift) | (a.high << (128 - shift)));
+  }
+
+  template <typename U> static constexpr bool lt(const U &a, const U &b) {
+    return a.high < b.high || (a.high == b.high && a.low < b.low);
+  }
+};
+
+struct Limb64Backend {
+  template <typename U>
+  static constexpr void to_limbs(const U &a, uint64_t *limbs) {
+    limbs[0] = uint64_t(a.low);
+    limbs[1] = uint64_t(a.low >> 64);
+    limbs[2] = uint64_t(a.high);
+    limbs[3] = uint64_t(a.high >> 64);
+  }
+
+  template <typename U> static constexpr U from_limbs(const uint64_t *limbs) {
+    return U((__uint128_t(limbs[3]) << 64) | limbs[2],
+             (__uint128_t(limbs[1]) << 64) | limbs[0]);
+  }
+
+  template <typename U>
+  static constexpr bool add_overflow(const U &a, const U &b, U &out) {
+    uint64_t x[4] = {}, y[4] = {}, r[4] = {};
+    to_limbs(a, x);
+    to_limbs(b, y);
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++) {
+      r[i] = addc64(x[i], y[i], carry, carry);
+    }
+    out = from_limbs<U>(r);
+    return carry != 0;
+  }
+
+  template <typename U>
+  static constexpr bool sub_overflow(const U &a, const U &b, U &out) {
+    uint64_t x[4] = {}, y[4] = {}, r[4] = {};
+    to_limbs(a, x);
+    to_limbs(b, y);
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++) {
+      r[i] = subb64(x[i], y[i], borrow, borrow);
+    }
+    out = from_limbs<U>(r);
+    return borrow != 0;
+  }
+
+  // the unused carry out is dropped by the optimizer
+  template <typename U> static constexpr U add(const U &a, const U &b) {
+    U r;
+    add_overflow(a, b, r);
+    return r;
+  }
+
+  template <typename U> static constexpr U sub(const U &a, const U &b) {
+    U r;
+    sub_overflow(a, b, r);
+    return r;
+  }
+
+  // Full schoolbook multiplication, any partial product or carry above limb
+  // 3 means the result does not fit
+  template <typename U>
+  static constexpr bool mul_overflow(const U &a, const U &b, U &out) {
+    uint64_t x[4] = {}, y[4] = {}, r[4] = {};
+    to_limbs(a, x);
+    to_limbs(b, y);
+    bool overflow = false;
+    for (int i = 0; i < 4; i++) {
+      uint64_t carry = 0;
+      for (int j = 0; j < 4; j++) {
+        if (i + j >= 4) {
+          overflow |= x[i] != 0 && y[j] != 0;
+          continue;
+        }
+        uint64_t high = 0;
+        uint64_t low = mul64(x[i], y[j], high);
+        uint64_t c1 = 0, c2 = 0;
+        low = addc64(low, r[i + j], 0, c1);
+        low = addc64(low, carry, 0, c2);
+        r[i + j] = low;
+        carry = high + c1 + c2;
+      }
+      overflow |= carry != 0;
+    }
+    out = from_limbs<U>(r);
+    return overflow;
+  }
+
+  // Schoolbook multiplication keeping the low 4 limbs, the partial products
+  // above limb 3 are never computed
+  template <typename U> static constexpr U mul(const U &a, const U &b) {
+    uint64_t x[4] = {}, y[4] = {}, r[4] = {};
+    to_limbs(a, x);
+    to_limbs(b, y);
+    for (int i = 0; i < 4; i++) {
+      uint64_t carry = 0;
+      for (int j = 0; i + j < 3; j++) {
+        uint64_t high = 0;
+        uint64_t low = mul64(x[i], y[j], high);
+        uint64_t c1 = 0, c2 = 0;
+        low = addc64(low, r[i + j], 0, c1);
+        low = addc64(low, carry, 0, c2);
+        r[i + j] = low;
+        carry = high + c1 + c2;
+      }
+      r[3] += x[i] * y[3 - i] + carry;
+    }
+    return from_limbs<U>(r);
+  }
+
+  template <typename U> static constexpr U shl(const U &a, size_t shift) {
+    if (shift >= 256) {
+      return U(0);
+    }
+    uint64_t x[4] = {}, r[4] = {};
+    to_limbs(a, x);
+    const size_t limb_shift = shift / 64;
+    const size_t bit_shift = shift % 64;
+    for (int i = 3; i >= 0; i--) {
+      int src = i - int(limb_shift);
+      uint64_t v = src >= 0 ? x[src] << bit_shift : 0;
+      if (bit_shift != 0 && src > 0) {
+        v |= x[src - 1] >> (64 - bit_shift);
+      }
+      r[i] = v;
+    }
+    return from_limbs<U>(r);
+  }
+
+  template <typename U> static constexpr U shr(const U &a, size_t shift) {
+    if (shift >= 256) {
+      return U(0);
+    }
+    uint64_t x[4] = {}, r[4] = {};
+    to_limbs(a, x);
+    const size_t limb_shift = shift / 64;
+    const size_t bit_shift = shift % 64;
+    for (int i = 0; i < 4; i++) {
+      int src = i + int(limb_shift);
+      uint64_t v = src < 4 ? x[src] >> bit_shift : 0;
+      if (bit_shift != 0 && src < 3) {
+        v |= x[src + 1] << (64 - bit_shift);
+      }
+      r[i] = v;
+    }
+    return from_limbs<U>(r);
+  }
+
+  // a < b is the borrow out of a - b
+  template <typename U> static constexpr bool lt(const U &a, const U &b) {
+    uint64_t x[4] = {}, y[4] = {};
+    to_limbs(a, x);
+    to_limbs(b, y);
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++) {
+      subb64(x[i], y[i], borrow, borrow);
+    }
+    return borrow != 0;
+  }
+};
+
+#ifdef DTVM_HAS_BITINT_256
+struct BitIntBackend {
+  typedef unsigned _BitInt(256) word;
+
+  template <typename U> static constexpr word to_word(const U &a) {
+    return (word(a.high) << 128) | word(a.low);
+  }
+
+  template <typename U> static constexpr U from_word(const word &w) {
+    return U(__uint128_t(w >> 128), __uint128_t(w));
+  }
+
+  template <typename U> static constexpr U add(const U &a, const U &b) {
+    return from_word<U>(to_word(a) + to_word(b));
+  }
+
+  template <typename U> static constexpr U sub(const U &a, const U &b) {
+    return from_word<U>(to_word(a) - to_word(b));
+  }
+
+  template <typename U> static constexpr U mul(const U &a, const U &b) {
+    return from_word<U>(to_word(a) * to_word(b));
+  }
+
+  template <typename U>
+  static constexpr bool add_overflow(const U &a, const U &b, U &out) {
+    word r = to_word(a) + to_word(b);
+    out = from_word<U>(r);
+    return r < to_word(a);
+  }
+
+  template <typename U>
+  static constexpr bool sub_overflow(const U &a, const U &b, U &out) {
+    out = from_word<U>(to_word(a) - to_word(b));
+    return to_word(a) < to_word(b);
+  }
+
+  // the checked arithmetic builtins reject _BitInt wider than 128 bits, so
+  // multiply in 512 bits and look at the high half
+  template <typename U>
+  static constexpr bool mul_overflow(const U &a, const U &b, U &out) {
+    typedef unsigned _BitInt(512) wide;
+    wide r = wide(to_word(a)) * wide(to_word(b));
+    out = from_word<U>(word(r));
+    return (r >> 256) != 0;
+  }
+
+  template <typename U> static constexpr U shl(const U &a, size_t shift) {
+    return shift >= 256 ? U(0) : from_word<U>(to_word(a) << shift);
+  }
+
+  template <typename U> static constexpr U shr(const U &a, size_t shift) {
+    return shift >= 256 ? U(0) : from_word<U>(to_word(a) >> shift);
+  }
+
+  template <typename U> static constexpr bool lt(const U &a, const U &b) {
+    return to_word(a) < to_word(b);
+  }
+};
+#endif // DTVM_HAS_BITINT_256
+
+#if DTVM_UINT256_BACKEND == DTVM_UINT256_BACKEND_U128
+typedef U128Backend Uint256Backend;
+#elif DTVM_UINT256_BACKEND == DTVM_UINT256_BACKEND_LIMB64
+typedef Limb64Backend Uint256Backend;
+#elif DTVM_UINT256_BACKEND == DTVM_UINT256_BACKEND_BITINT
+#ifndef DTVM_HAS_BITINT_256
+#error "DTVM_UINT256_BACKEND_BITINT requires a compiler with _BitInt(256)"
+#endif
+typedef BitIntBackend Uint256Backend;
+#else
+#error "unknown DTVM_UINT256_BACKEND"
+#endif
+
+} // namespace detail
+
+struct uint256 {
+  __uint128_t high;
+  __uint128_t low;
+  constexpr uint256() : high(0), low(0) {}
+  constexpr uint256(__uint128_t low) : high(0), low(low) {}
+  constexpr uint256(const uint256 &other) : high(other.high), low(other.low) {}
+
+  constexpr uint256(__uint128_t high_part, __uint128_t low_part)
+      : high(high_part), low(low_part) {}
+  constexpr uint256(const bytes32 &bs) // big endian bytes
+      : uint256(from_be_bytes(bs.data())) {}
+
+  // Load 32 big endian bytes (a storage word or an abi word in calldata)
+  // with four 64-bit byte swaps, no bytes32 temporary needed
+  static constexpr uint256 from_be_bytes(const uint8_t *data) {
+    return uint256((__uint128_t(detail::load_be64(data)) << 64) |
+                       detail::load_be64(data + 8),
+                   (__uint128_t(detail::load_be64(data + 16)) << 64) |
+                       detail::load_be64(data + 24));
+  }
+
+  // Store as 32 big endian bytes
+  constexpr void to_be_bytes(uint8_t *out) const {
+    detail::store_be64(out, uint64_t(high >> 64));
+    detail::store_be64(out + 8, uint64_t(high));
+    detail::store_be64(out + 16, uint64_t(low >> 64));
+    detail::store_be64(out + 24, uint64_t(low));
+  }
+
+  // Addition operator
+  constexpr uint256 operator+(const uint256 &other) const {
+    return detail::Uint256Backend::add(*this, other);
+  }
+
+  constexpr uint256 operator-(const uint256 &other) const {
+    return detail::Uint256Backend::sub(*this, other);
   }
 
-  uint256 operator&(const uint256 &rhs) const {
+  constexpr uint256 operator>>(size_t shift) const {
+    return detail::Uint256Backend::shr(*this, shift);
+  }
+
+  constexpr uint256 operator<<(size_t shift) const {
+    return detail::Uint256Backend::shl(*this, shift);
+  }
+
+  constexpr uint256 operator&(const uint256 &rhs) const {
     return uint256(high & rhs.high, low & rhs.low);
   }
 
-  uint256 operator|(const uint256 &rhs) const {
+  constexpr uint256 operator|(const uint256 &rhs) const {
     return uint256(high | rhs.high, low | rhs.low);
   }
 
-  uint256 operator^(const uint256 &rhs) const {
+  constexpr uint256 operator^(const uint256 &rhs) const {
     return uint256(high ^ rhs.high, low ^ rhs.low);
   }
 
-  static uint256 multiply128(const __uint128_t &a, const __uint128_t &b) {
+  constexpr uint256 operator~() const { return uint256(~high, ~low); }
+
+  static constexpr uint256 multiply128(const __uint128_t &a,
+                                       const __uint128_t &b) {
     __uint128_t a_high = a >> 64;
     __uint128_t a_low = a & 0xFFFFFFFFFFFFFFFFull;
     __uint128_t b_high = b >> 64;
     __uint128_t b_low = b & 0xFFFFFFFFFFFFFFFFull;
     // new low part = a.low * b.low
-    // new high part = a.high * b.low + b.high * a.low + overflow part from
-    // (a.low * b.low) overflow high part = a.high * b.high + overflow part from
-    // (new high part)
+    // new middle part = a.high * b.low + b.high * a.low + overflow part from
+    // (a.low * b.low), summed per 64-bit half so the carries are not lost
+    // overflow high part = a.high * b.high + overflow part from
+    // (new middle part)
     __uint128_t new_low = a_low * b_low;
-    __uint128_t new_high = a_high * b_low + b_high * a_low + (new_low >> 64);
-    __uint128_t overflow_high = a_high * b_high + (new_high >> 64);
-    __uint128_t not_overflow_part = ((new_high & 0xFFFFFFFFFFFFFFFFull) << 64) +
+    __uint128_t cross1 = a_high * b_low;
+    __uint128_t cross2 = b_high * a_low;
+    __uint128_t new_mid = (new_low >> 64) + (cross1 & 0xFFFFFFFFFFFFFFFFull) +
+                          (cross2 & 0xFFFFFFFFFFFFFFFFull);
+    __uint128_t overflow_high =
+        a_high * b_high + (cross1 >> 64) + (cross2 >> 64) + (new_mid >> 64);
+    __uint128_t not_overflow_part = ((new_mid & 0xFFFFFFFFFFFFFFFFull) << 64) +
                                     (new_low & 0xFFFFFFFFFFFFFFFFull);
     return uint256(overflow_high, not_overflow_part);
   }
 
-  uint256 operator*(const uint256 &other) const {
-    __uint128_t a = low, b = other.low;
-    __uint128_t ah = high, bh = other.high;
-    // The high part * high part result has already overflowed, so no need to
-    // consider it new high part = n1.high * n2.low + n2.high * n1.low +
-    // overflow part (n1.low * n2.low) new low part = n1.low * n2.low
-    __uint128_t new_high = ah * b + bh * a + multiply128(a, b).high;
-    __uint128_t new_low = a * b;
+  constexpr uint256 operator*(const uint256 &other) const {
+    return detail::Uint256Backend::mul(*this, other);
+  }
+
+  // Little endian 32-bit digits, used by the long division
+  constexpr void to_digits(uint32_t *digits) const {
+    digits[0] = uint32_t(low);
+    digits[1] = uint32_t(low >> 32);
+    digits[2] = uint32_t(low >> 64);
+    digits[3] = uint32_t(low >> 96);
+    digits[4] = uint32_t(high);
+    digits[5] = uint32_t(high >> 32);
+    digits[6] = uint32_t(high >> 64);
+    digits[7] = uint32_t(high >> 96);
+  }
+
+  static constexpr uint256 from_digits(const uint32_t *digits) {
+    __uint128_t new_low = (__uint128_t(digits[3]) << 96) |
+                          (__uint128_t(digits[2]) << 64) |
+                          (__uint128_t(digits[1]) << 32) | digits[0];
+    __uint128_t new_high = (__uint128_t(digits[7]) << 96) |
+                           (__uint128_t(digits[6]) << 64) |
+                           (__uint128_t(digits[5]) << 32) | digits[4];
     return uint256(new_high, new_low);
   }
 
-  // TODO: operator / , %
+  // Returns {quotient, remainder}. Division by zero reverts with
+  // Panic(0x12) like solidity does.
+  constexpr std::pair<uint256, uint256> divmod(const uint256 &divisor) const {
+    if (divisor.high == 0) {
+      if (divisor.low == 0) {
+        panic(PANIC_DIVISION_BY_ZERO);
+        return {uint256(0), uint256(0)};
+      }
+      if (high == 0) {
+        // both fit in 128 bits
+        return {uint256(low / divisor.low), uint256(low % divisor.low)};
+      }
+      if ((divisor.low >> 64) == 0) {
+        return divmod_u64(uint64_t(divisor.low));
+      }
+    }
+    if (*this < divisor) {
+      return {uint256(0), *this};
+    }
 
-  bool operator==(const uint256 &other) const {
-    return high == other.high && low == other.low;
+    uint32_t u[8] = {}, v[8] = {}, q[8] = {}, r[8] = {};
+    to_digits(u);
+    divisor.to_digits(v);
+    int m = detail::significant_digits(u, 8);
+    int n = detail::significant_digits(v, 8);
+    detail::knuth_divmod<8>(u, m, v, n, q, r);
+    return {from_digits(q), from_digits(r)};
   }
 
-  bool operator!=(const uint256 &other) const { return !(*this == other); }
+  constexpr uint256 operator/(const uint256 &other) const {
+    return divmod(other).first;
+  }
 
-  bool operator<(const uint256 &other) const {
-    if (high < other.high) {
-      return true;
-    } else if (high == other.high) {
-      return low < other.low;
-    } else {
-      return false;
-    }
+  constexpr uint256 operator%(const uint256 &other) const {
+    return divmod(other).second;
   }
 
-  bool operator<=(const uint256 &other) const {
-    return (*this == other) || (*this < other);
+  constexpr bool operator==(const uint256 &other) const {
+    return high == other.high && low == other.low;
   }
 
-  bool operator>(const uint256 &other) const {
-    if (high > other.high) {
-      return true;
-    } else if (high == other.high) {
-      return low > other.low;
-    } else {
-      return false;
-    }
+  constexpr bool operator!=(const uint256 &other) const {
+    return !(*this == other);
   }
 
-  bool operator>=(const uint256 &other) const {
-    return (*this == other) || (*this > other);
+  constexpr bool operator<(const uint256 &other) const {
+    return detail::Uint256Backend::lt(*this, other);
   }
 
-  uint256 &operator=(const uint256 &other) {
+  constexpr bool operator<=(const uint256 &other) const {
+    return !(other < *this);
+  }
+
+  constexpr bool operator>(const uint256 &other) const { return other < *this; }
+
+  constexpr bool operator>=(const uint256 &other) const {
+    return !(*this < other);
+  }
+
+  constexpr uint256 &operator=(const uint256 &other) {
     high = other.high;
     low = other.low;
     return *this;
   }
 
-  static uint256 max() {
+  static constexpr uint256 max() {
     return uint256((__uint128_t)__int128_t(-1), (__uint128_t)__int128_t(-1));
   }
 
-  bytes32 bytes() const {
-    // as big endian
-    bytes32 result;
-    auto bytes_high = reinterpret_cast<const uint8_t *>(&high);
-    auto bytes_low = reinterpret_cast<const uint8_t *>(&low);
-    // big endian byte order
-    for (size_t i = 0; i < sizeof(high); ++i) {
-      result[i] = bytes_high[sizeof(high) - i - 1];
+  // Short division by a divisor that fits in 64 bits (divisor != 0)
+  constexpr std::pair<uint256, uint256> divmod_u64(uint64_t divisor) const {
+    if ((divisor >> 32) == 0) {
+      // single digit divisor, only native 64-bit divisions
+      uint32_t u[8] = {}, q[8] = {};
+      to_digits(u);
+      uint32_t rem = detail::divmod_digits_by_digit(u, 8, uint32_t(divisor), q);
+      return {from_digits(q), uint256(rem)};
     }
-    for (size_t i = 0; i < sizeof(low); ++i) {
-      result[i + 16] = bytes_low[sizeof(low) - i - 1];
+    uint64_t limbs[4] = {uint64_t(low), uint64_t(low >> 64), uint64_t(high),
+                         uint64_t(high >> 64)};
+    uint64_t q[4] = {};
+    uint64_t rem = 0;
+    for (int i = 3; i >= 0; --i) {
+      __uint128_t cur = (__uint128_t(rem) << 64) | limbs[i];
+      q[i] = uint64_t(cur / divisor);
+      rem = uint64_t(cur % divisor);
     }
+    return {uint256((__uint128_t(q[3]) << 64) | q[2],
+                    (__uint128_t(q[1]) << 64) | q[0]),
+            uint256(rem)};
+  }
+
+  // Division by a compile time constant, e.g. x.div_by<1000000000000000000>()
+  // for 18 decimals. Only multiplies and shifts are emitted; a power of two
+  // is a plain shift and mask.
+  template <uint64_t D>
+  constexpr std::pair<uint256, uint256> divmod_by() const {
+    static_assert(D != 0, "division by zero");
+    if constexpr ((D & (D - 1)) == 0) {
+      constexpr size_t shift = __builtin_ctzll(D);
+      return {*this >> shift, uint256(low & (D - 1))};
+    } else {
+      using Divisor = detail::ConstantDivisor<D>;
+      constexpr int shift = Divisor::SHIFT;
+      uint64_t u[4] = {uint64_t(low), uint64_t(low >> 64), uint64_t(high),
+                       uint64_t(high >> 64)};
+      // normalize the dividend along with the divisor, the bits shifted out
+      // of the top limb start the remainder
+      uint64_t rem = 0;
+      if constexpr (shift != 0) {
+        rem = u[3] >> (64 - shift);
+        u[3] = (u[3] << shift) | (u[2] >> (64 - shift));
+        u[2] = (u[2] << shift) | (u[1] >> (64 - shift));
+        u[1] = (u[1] << shift) | (u[0] >> (64 - shift));
+        u[0] <<= shift;
+      }
+      uint64_t q3 = Divisor::step(rem, u[3]);
+      uint64_t q2 = Divisor::step(rem, u[2]);
+      uint64_t q1 = Divisor::step(rem, u[1]);
+      uint64_t q0 = Divisor::step(rem, u[0]);
+      return {uint256((__uint128_t(q3) << 64) | q2,
+                      (__uint128_t(q1) << 64) | q0),
+              uint256(rem >> shift)};
+    }
+  }
+
+  template <uint64_t D> constexpr uint256 div_by() const {
+    return divmod_by<D>().first;
+  }
+
+  template <uint64_t D> constexpr uint256 mod_by() const {
+    return divmod_by<D>().second;
+  }
+
+  constexpr bytes32 bytes() const {
+    // as big endian
+    bytes32 result{};
+    to_be_bytes(result.data());
     return result;
   }
 
-  __uint128_t to_uint128() const { return low; }
+  constexpr __uint128_t to_uint128() const { return low; }
 
-  uint64_t to_uint64() const { return uint64_t(low); }
+  constexpr uint64_t to_uint64() const { return uint64_t(low); }
 
-  uint32_t to_uint32() const { return uint32_t(low); }
+  constexpr uint32_t to_uint32() const { return uint32_t(low); }
 
-  uint16_t to_uint16() const { return uint16_t(low); }
+  constexpr uint16_t to_uint16() const { return uint16_t(low); }
 
-  uint8_t to_uint8() const { return uint8_t(low); }
+  constexpr uint8_t to_uint8() const { return uint8_t(low); }
 };
+
+// Full precision arithmetic. The intermediate product keeps all 512 bits
+// (like the FullMath routines AMM code relies on), and everything lives on
+// the stack.
+
+// Full 512-bit product of a * b, returns {high, low}
+constexpr std::pair<uint256, uint256> mul_full(const uint256 &a,
+                                            const uint256 &b) {
+  const uint256 ll = uint256::multiply128(a.low, b.low);
+  const uint256 lh = uint256::multiply128(a.low, b.high);
+  const uint256 hl = uint256::multiply128(a.high, b.low);
+  const uint256 hh = uint256::multiply128(a.high, b.high);
+  // sum the middle 128-bit column, it carries at most 2 into the next one
+  __uint128_t mid = ll.high + lh.low;
+  __uint128_t carry = mid < lh.low;
+  mid += hl.low;
+  carry += mid < hl.low;
+  __uint128_t upper_low = hh.low + lh.high;
+  __uint128_t upper_carry = upper_low < lh.high;
+  upper_low += hl.high;
+  upper_carry += upper_low < hl.high;
+  upper_low += carry;
+  upper_carry += upper_low < carry;
+  return {uint256(hh.high + upper_carry, upper_low), uint256(mid, ll.low)};
+}
+
+// Divide the 512-bit number {high, low} by divisor, requires high < divisor
+// so the quotient fits in 256 bits. Returns {quotient, remainder}.
+constexpr std::pair<uint256, uint256> divmod_512(const uint256 &high,
+                                              const uint256 &low,
+                                              const uint256 &divisor) {
+  if (high == uint256(0)) {
+    return low.divmod(divisor);
+  }
+  uint32_t u[16] = {}, v[8] = {}, q[16] = {}, r[8] = {};
+  low.to_digits(u);
+  high.to_digits(u + 8);
+  divisor.to_digits(v);
+  int m = detail::significant_digits(u, 16);
+  int n = detail::significant_digits(v, 8);
+  if (n == 1) {
+    r[0] = detail::divmod_digits_by_digit(u, m, v[0], q);
+  } else {
+    detail::knuth_divmod<16>(u, m, v, n, q, r);
+  }
+  return {uint256::from_digits(q), uint256::from_digits(r)};
+}
+
+// floor(a * b / denominator) without overflow of the intermediate product.
+// Reverts with Panic(0x12) when denominator is zero and Panic(0x11) when the
+// result does not fit in 256 bits.
+constexpr uint256 mul_div(const uint256 &a, const uint256 &b,
+                       const uint256 &denominator) {
+  if (denominator == uint256(0)) {
+    panic(PANIC_DIVISION_BY_ZERO);
+    return uint256(0);
+  }
+  const auto &product = mul_full(a, b);
+  if (product.first >= denominator) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+    return uint256(0);
+  }
+  return divmod_512(product.first, product.second, denominator).first;
+}
+
+// ceil(a * b / denominator), reverts like mul_div
+constexpr uint256 mul_div_round_up(const uint256 &a, const uint256 &b,
+                                const uint256 &denominator) {
+  if (denominator == uint256(0)) {
+    panic(PANIC_DIVISION_BY_ZERO);
+    return uint256(0);
+  }
+  const auto &product = mul_full(a, b);
+  if (product.first >= denominator) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+    return uint256(0);
+  }
+  const auto &result = divmod_512(product.first, product.second, denominator);
+  if (result.second == uint256(0)) {
+    return result.first;
+  }
+  if (result.first == uint256::max()) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+    return uint256(0);
+  }
+  return result.first + uint256(1);
+}
+
+// (a * b) % modulus with a 512-bit intermediate, same as solidity mulmod.
+// Reverts with Panic(0x12) when modulus is zero.
+constexpr uint256 mulmod(const uint256 &a, const uint256 &b,
+                      const uint256 &modulus) {
+  if (modulus == uint256(0)) {
+    panic(PANIC_DIVISION_BY_ZERO);
+    return uint256(0);
+  }
+  const auto &product = mul_full(a, b);
+  // reduce the high half first so the quotient fits in 256 bits
+  const uint256 &high = product.first % modulus;
+  return divmod_512(high, product.second, modulus).second;
+}
+
+// (a + b) % modulus with a 257-bit intermediate, same as solidity addmod.
+// Reverts with Panic(0x12) when modulus is zero.
+constexpr uint256 addmod(const uint256 &a, const uint256 &b,
+                      const uint256 &modulus) {
+  if (modulus == uint256(0)) {
+    panic(PANIC_DIVISION_BY_ZERO);
+    return uint256(0);
+  }
+  const uint256 &x = a % modulus;
+  const uint256 &y = b % modulus;
+  // x + y < 2 * modulus, so one conditional subtraction is enough. When the
+  // sum wraps, the wrapped difference is the right result.
+  const uint256 &sum = x + y;
+  bool carry = sum < x;
+  return (carry || sum >= modulus) ? sum - modulus : sum;
+}
+
+// Overflow detecting arithmetic, out receives the wrapped result and the
+// return value is the carry (or borrow) out of 256 bits
+constexpr bool add_overflow(const uint256 &a, const uint256 &b, uint256 &out) {
+  return detail::Uint256Backend::add_overflow(a, b, out);
+}
+
+constexpr bool sub_overflow(const uint256 &a, const uint256 &b, uint256 &out) {
+  return detail::Uint256Backend::sub_overflow(a, b, out);
+}
+
+constexpr bool mul_overflow(const uint256 &a, const uint256 &b, uint256 &out) {
+  return detail::Uint256Backend::mul_overflow(a, b, out);
+}
+
+// Solidity >= 0.8 arithmetic, reverts with Panic(0x11) on overflow
+constexpr uint256 checked_add(const uint256 &a, const uint256 &b) {
+  uint256 result;
+  if (add_overflow(a, b, result)) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+  }
+  return result;
+}
+
+constexpr uint256 checked_sub(const uint256 &a, const uint256 &b) {
+  uint256 result;
+  if (sub_overflow(a, b, result)) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+  }
+  return result;
+}
+
+constexpr uint256 checked_mul(const uint256 &a, const uint256 &b) {
+  uint256 result;
+  if (mul_overflow(a, b, result)) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+  }
+  return result;
+}
+
+// Wrapping arithmetic (solidity unchecked { ... }), the same as the uint256
+// operators but explicit at the call site. Only for proven bounds.
+constexpr uint256 unchecked_add(const uint256 &a, const uint256 &b) {
+  return a + b;
+}
+
+constexpr uint256 unchecked_sub(const uint256 &a, const uint256 &b) {
+  return a - b;
+}
+
+constexpr uint256 unchecked_mul(const uint256 &a, const uint256 &b) {
+  return a * b;
+}
+
+// uint256 whose +, -, * (and the compound assignments) revert with
+// Panic(0x11) on overflow. Plain uint256 operands convert implicitly, so
+// mixed expressions stay checked; value() gives the plain uint256 back.
+struct checked_uint256 {
+  uint256 v;
+
+  constexpr checked_uint256() : v() {}
+  constexpr checked_uint256(const uint256 &value) : v(value) {}
+  constexpr checked_uint256(__uint128_t value) : v(value) {}
+
+  constexpr const uint256 &value() const { return v; }
+
+  friend constexpr checked_uint256 operator+(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return checked_add(a.v, b.v);
+  }
+
+  friend constexpr checked_uint256 operator-(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return checked_sub(a.v, b.v);
+  }
+
+  friend constexpr checked_uint256 operator*(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return checked_mul(a.v, b.v);
+  }
+
+  // division and modulo cannot overflow, they only panic on zero divisor
+  friend constexpr checked_uint256 operator/(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return a.v / b.v;
+  }
+
+  friend constexpr checked_uint256 operator%(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return a.v % b.v;
+  }
+
+  constexpr checked_uint256 &operator+=(const checked_uint256 &other) {
+    v = checked_add(v, other.v);
+    return *this;
+  }
+
+  constexpr checked_uint256 &operator-=(const checked_uint256 &other) {
+    v = checked_sub(v, other.v);
+    return *this;
+  }
+
+  constexpr checked_uint256 &operator*=(const checked_uint256 &other) {
+    v = checked_mul(v, other.v);
+    return *this;
+  }
+
+  friend constexpr bool operator==(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return a.v == b.v;
+  }
+  friend constexpr bool operator!=(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return a.v != b.v;
+  }
+  friend constexpr bool operator<(const checked_uint256 &a,
+                                  const checked_uint256 &b) {
+    return a.v < b.v;
+  }
+  friend constexpr bool operator<=(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return a.v <= b.v;
+  }
+  friend constexpr bool operator>(const checked_uint256 &a,
+                                  const checked_uint256 &b) {
+    return a.v > b.v;
+  }
+  friend constexpr bool operator>=(const checked_uint256 &a,
+                                   const checked_uint256 &b) {
+    return a.v >= b.v;
+  }
+};
+
+// Bit scans over the four 64-bit limbs
+
+// Leading zero bits, 256 for zero
+constexpr int clz(const uint256 &x) {
+  const uint64_t limbs[4] = {uint64_t(x.high >> 64), uint64_t(x.high),
+                             uint64_t(x.low >> 64), uint64_t(x.low)};
+  for (int i = 0; i < 4; i++) {
+    if (limbs[i] != 0) {
+      return i * 64 + __builtin_clzll(limbs[i]);
+    }
+  }
+  return 256;
+}
+
+// Trailing zero bits, 256 for zero
+constexpr int ctz(const uint256 &x) {
+  const uint64_t limbs[4] = {uint64_t(x.low), uint64_t(x.low >> 64),
+                             uint64_t(x.high), uint64_t(x.high >> 64)};
+  for (int i = 0; i < 4; i++) {
+    if (limbs[i] != 0) {
+      return i * 64 + __builtin_ctzll(limbs[i]);
+    }
+  }
+  return 256;
+}
+
+constexpr int popcount(const uint256 &x) {
+  return __builtin_popcountll(uint64_t(x.low)) +
+         __builtin_popcountll(uint64_t(x.low >> 64)) +
+         __builtin_popcountll(uint64_t(x.high)) +
+         __builtin_popcountll(uint64_t(x.high >> 64));
+}
+
+// Index of the most significant set bit, -1 for zero
+constexpr int msb(const uint256 &x) { return 255 - clz(x); }
+
+// floor(log2(x)), 0 for zero like the solidity math libraries
+constexpr uint32_t log2(const uint256 &x) {
+  return x == uint256(0) ? 0 : uint32_t(msb(x));
+}
+
+namespace detail {
+
+constexpr std::array<uint256, 78> make_pow10_table() {
+  std::array<uint256, 78> table{};
+  table[0] = uint256(1);
+  for (size_t i = 1; i < table.size(); i++) {
+    table[i] = table[i - 1] * uint256(10);
+  }
+  return table;
+}
+
+// 10^0 .. 10^77, every power of ten below 2^256
+inline constexpr std::array<uint256, 78> pow10_table = make_pow10_table();
+
+} // namespace detail
+
+// floor(log10(x)), 0 for zero. The bit length gives the estimate
+// (1233 / 4096 ~ log10(2)) and one table compare corrects it.
+constexpr uint32_t log10(const uint256 &x) {
+  if (x == uint256(0)) {
+    return 0;
+  }
+  uint32_t estimate = (uint32_t(msb(x)) + 1) * 1233 >> 12;
+  return estimate - (x < detail::pow10_table[estimate] ? 1 : 0);
+}
+
+namespace detail {
+
+// Square and multiply over the exponent bits, overflow reports whether the
+// exact result needs more than 256 bits
+constexpr uint256 pow_impl(const uint256 &base, const uint256 &exponent,
+                           bool &overflow) {
+  uint256 result(1);
+  uint256 square = base;
+  overflow = false;
+  const int bits = msb(exponent) + 1;
+  for (int i = 0; i < bits; i++) {
+    const __uint128_t &half = i < 128 ? exponent.low : exponent.high;
+    if (((half >> (i % 128)) & 1) != 0) {
+      overflow |= mul_overflow(result, square, result);
+    }
+    // the last square is never used, an overflow of any earlier one means
+    // the result overflows too (the top exponent bit is set)
+    if (i + 1 < bits) {
+      overflow |= mul_overflow(square, square, square);
+    }
+  }
+  return result;
+}
+
+} // namespace detail
+
+// base ** exponent modulo 2^256 (solidity unchecked exponentiation)
+constexpr uint256 pow(const uint256 &base, const uint256 &exponent) {
+  bool overflow = false;
+  return detail::pow_impl(base, exponent, overflow);
+}
+
+// base ** exponent, reverts with Panic(0x11) on overflow like solidity 0.8
+constexpr uint256 checked_pow(const uint256 &base, const uint256 &exponent) {
+  bool overflow = false;
+  const uint256 &result = detail::pow_impl(base, exponent, overflow);
+  if (overflow) {
+    panic(PANIC_ARITHMETIC_OVERFLOW);
+  }
+  return result;
+}
+
+namespace detail {
+
+// floor(sqrt(x)) with native 64-bit divisions
+constexpr uint64_t sqrt64(uint64_t x) {
+  if (x < 2) {
+    return x;
+  }
+  uint64_t root = uint64_t(1) << ((63 - __builtin_clzll(x)) / 2 + 1);
+  uint64_t next = (root + x / root) >> 1;
+  while (next < root) {
+    root = next;
+    next = (root + x / root) >> 1;
+  }
+  return root;
+}
+
+} // namespace detail
+
+// floor(sqrt(x)). The msb picks the top 64 bits (an even shift), their
+// 64-bit root seeds Newton from above within 2^-31 relative error. Each
+// round squares the error, so three 256-bit rounds leave the floor root or
+// one more, fixed up with a multiplication.
+constexpr uint256 sqrt(const uint256 &x) {
+  const int top_bit = msb(x);
+  if (top_bit < 64) {
+    return uint256(detail::sqrt64(uint64_t(x.low)));
+  }
+  const size_t shift = size_t(top_bit - 63 + 1) & ~size_t(1);
+  uint256 root = uint256(detail::sqrt64(uint64_t((x >> shift).low)) + 1)
+                 << (shift / 2);
+  for (int i = 0; i < 3; i++) {
+    root = (root + x / root) >> 1;
+  }
+  uint256 square;
+  if (mul_overflow(root, root, square) || square > x) {
+    root = root - uint256(1);
+  }
+  return root;
+}
+
+// Two's complement signed 256-bit integer (solidity int256). It wraps the
+// same limbs as uint256, so addition, subtraction, multiplication and the
+// bitwise operators are exactly the unsigned ones and only division,
+// modulo, right shift and comparisons look at the sign.
+struct int256 {
+  uint256 value; // two's complement bits
+
+  constexpr int256() : value() {}
+  constexpr int256(__int128_t v)
+      : value(__uint128_t(v < 0 ? -1 : 0), __uint128_t(v)) {}
+  template <typename Int,
+            std::enable_if_t<std::is_integral<Int>::value &&
+                                 std::is_signed<Int>::value &&
+                                 !std::is_same<Int, __int128_t>::value,
+                             bool> = true>
+  constexpr int256(Int v) : int256(__int128_t(v)) {}
+  template <typename UInt,
+            std::enable_if_t<std::is_integral<UInt>::value &&
+                                 !std::is_signed<UInt>::value,
+                             bool> = true>
+  constexpr int256(UInt v) : value(__uint128_t(v)) {}
+  // reinterpret unsigned bits as two's complement
+  explicit constexpr int256(const uint256 &bits) : value(bits) {}
+  // big endian bytes
+  explicit constexpr int256(const bytes32 &bs) : value(bs) {}
+
+  static constexpr int256 from_bits(const uint256 &bits) {
+    return int256(bits);
+  }
+
+  // the raw two's complement bits
+  constexpr const uint256 &to_bits() const { return value; }
+
+  constexpr bool is_negative() const { return (value.high >> 127) != 0; }
+
+  // absolute value as unsigned, also correct for min()
+  constexpr uint256 abs() const {
+    return is_negative() ? (-*this).value : value;
+  }
+
+  constexpr int256 operator-() const { return int256(~value + uint256(1)); }
+
+  constexpr int256 operator+(const int256 &other) const {
+    return int256(value + other.value);
+  }
+
+  constexpr int256 operator-(const int256 &other) const {
+    return int256(value - other.value);
+  }
+
+  constexpr int256 operator*(const int256 &other) const {
+    return int256(value * other.value);
+  }
+
+  // Truncates toward zero and the remainder takes the sign of the dividend,
+  // like solidity (sdiv/smod). min() / -1 wraps to min() like the other
+  // unchecked operators. Division by zero reverts with Panic(0x12).
+  constexpr std::pair<int256, int256> divmod(const int256 &divisor) const {
+    const auto &result = abs().divmod(divisor.abs());
+    int256 quotient(result.first);
+    int256 remainder(result.second);
+    if (is_negative() != divisor.is_negative()) {
+      quotient = -quotient;
+    }
+    if (is_negative()) {
+      remainder = -remainder;
+    }
+    return {quotient, remainder};
+  }
+
+  constexpr int256 operator/(const int256 &other) const {
+    return divmod(other).first;
+  }
+
+  constexpr int256 operator%(const int256 &other) const {
+    return divmod(other).second;
+  }
+
+  // arithmetic shift, fills with the sign bit
+  constexpr int256 operator>>(size_t shift) const {
+    if (shift >= 255) {
+      return is_negative() ? int256(-1) : int256(0);
+    }
+    uint256 shifted = value >> shift;
+    if (is_negative() && shift > 0) {
+      shifted = shifted | ~(uint256::max() >> shift);
+    }
+    return int256(shifted);
+  }
+
+  constexpr int256 operator<<(size_t shift) const {
+    if (shift >= 256) {
+      return int256(0);
+    }
+    return int256(value << shift);
+  }
+
+  constexpr int256 operator&(const int256 &rhs) const {
+    return int256(value & rhs.value);
+  }
+
+  constexpr int256 operator|(const int256 &rhs) const {
+    return int256(value | rhs.value);
+  }
+
+  constexpr int256 operator^(const int256 &rhs) const {
+    return int256(value ^ rhs.value);
+  }
+
+  constexpr int256 operator~() const { return int256(~value); }
+
+  constexpr bool operator==(const int256 &other) const {
+    return value == other.value;
+  }
+
+  constexpr bool operator!=(const int256 &other) const {
+    return value != other.value;
+  }
+
+  constexpr bool operator<(const int256 &other) const {
+    if (is_negative() != other.is_negative()) {
+      return is_negative();
+    }
+    // same sign, two's complement order matches the unsigned one
+    return value < other.value;
+  }
+
+  constexpr bool operator<=(const int256 &other) const {
+    return !(other < *this);
+  }
+
+  constexpr bool operator>(const int256 &other) const { return other < *this; }
+
+  constexpr bool operator>=(const int256 &other) const {
+    return !(*this < other);
+  }
+
+  static constexpr int256 max() { return int256(uint256::max() >> 1); }
+
+  static constexpr int256 min() {
+    return int256(uint256(__uint128_t(1) << 127, 0));
+  }
+
+  // Sign extend the lowest `bits` bits (1..256) of value, like the evm
+  // SIGNEXTEND opcode does for bits = 8 * (b + 1)
+  static constexpr int256 sign_extend(const uint256 &value, size_t bits) {
+    if (bits == 0 || bits >= 256) {
+      return int256(value);
+    }
+    const uint256 &mask = uint256::max() >> (256 - bits);
+    const uint256 &sign_bit = uint256(1) << (bits - 1);
+    if ((value & sign_bit) != uint256(0)) {
+      return int256(value | ~mask);
+    }
+    return int256(value & mask);
+  }
+
+  constexpr bytes32 bytes() const { return value.bytes(); }
+
+  constexpr __int128_t to_int128() const { return __int128_t(value.low); }
+
+  constexpr int64_t to_int64() const { return int64_t(value.low); }
+
+  constexpr int32_t to_int32() const { return int32_t(value.low); }
+
+  constexpr int16_t to_int16() const { return int16_t(value.low); }
+
+  constexpr int8_t to_int8() const { return int8_t(value.low); }
+};
+
+namespace detail {
+
+// Not constexpr, so reaching it while a literal is constant evaluated turns
+// a malformed or out of range literal into a compile error
+inline void invalid_uint256_literal() {}
+
+constexpr int literal_digit_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// Decimal or 0x prefixed hex, digit separators are skipped
+constexpr uint256 parse_uint256_literal(const char *chars, size_t length) {
+  uint256 result;
+  uint32_t base = 10;
+  size_t i = 0;
+  if (length > 2 && chars[0] == '0' && (chars[1] == 'x' || chars[1] == 'X')) {
+    base = 16;
+    i = 2;
+  } else if (length > 1 && chars[0] == '0') {
+    // octal and binary literals are not supported
+    invalid_uint256_literal();
+  }
+  for (; i < length; i++) {
+    if (chars[i] == '\'') {
+      continue;
+    }
+    int digit = literal_digit_value(chars[i]);
+    if (digit < 0 || uint32_t(digit) >= base) {
+      invalid_uint256_literal();
+      return result;
+    }
+    bool overflow = mul_overflow(result, uint256(base), result);
+    overflow |= add_overflow(result, uint256(uint32_t(digit)), result);
+    if (overflow) {
+      invalid_uint256_literal();
+    }
+  }
+  return result;
+}
+
+} // namespace detail
+
+inline namespace literals {
+
+// 1000000000000000000_u256, 0xffff_u256. The value is always computed at
+// compile time, so a constant like 10**18 is data instead of instructions.
+template <char... Chars> constexpr uint256 operator""_u256() {
+  constexpr char chars[] = {Chars...};
+  constexpr uint256 value =
+      detail::parse_uint256_literal(chars, sizeof...(Chars));
+  return value;
+}
+
+} // namespace literals
+
+
+namespace detail {
+
+inline constexpr char decimal_digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// 10^19 is the largest power of ten below 2^64
+constexpr uint64_t DEC_CHUNK_DIVISOR = 10000000000000000000ull;
+constexpr size_t DEC_CHUNK_DIGITS = 19;
+
+// Writes value backwards so that it ends right before `end`, two digits per
+// table lookup, and returns where it starts. With pad the chunk is zero
+// filled to exactly 19 digits.
+inline char *write_dec_u64(char *end, uint64_t value, bool pad) {
+  char *p = end;
+  while (value >= 100) {
+    p -= 2;
+    std::memcpy(p, &decimal_digit_pairs[(value % 100) * 2], 2);
+    value /= 100;
+  }
+  if (value >= 10) {
+    p -= 2;
+    std::memcpy(p, &decimal_digit_pairs[value * 2], 2);
+  } else {
+    *--p = char('0' + value);
+  }
+  while (pad && p > end - DEC_CHUNK_DIGITS) {
+    *--p = '0';
+  }
+  return p;
+}
+
+} // namespace detail
+
+inline std::string to_dec_string(const uint256 &value) {
+  // 2^256 - 1 has 78 digits
+  char buffer[80];
+  char *end = buffer + sizeof(buffer);
+  char *p = end;
+  uint64_t limbs[4] = {uint64_t(value.low), uint64_t(value.low >> 64),
+                       uint64_t(value.high), uint64_t(value.high >> 64)};
+  int top = 3;
+  while (top > 0 && limbs[top] == 0) {
+    top--;
+  }
+  // peel off the lowest 19 digits with one short division per chunk until
+  // the rest fits in a single limb
+  while (top > 0) {
+    // 10^19 has its top bit set, so the reciprocal steps need no
+    // normalization
+    using Divisor = detail::ConstantDivisor<detail::DEC_CHUNK_DIVISOR>;
+    static_assert(Divisor::SHIFT == 0, "");
+    uint64_t rem = 0;
+    for (int i = top; i >= 0; --i) {
+      limbs[i] = Divisor::step(rem, limbs[i]);
+    }
+    p = detail::write_dec_u64(p, rem, true);
+    // the divisor is below 2^64 so at most one limb empties per chunk
+    if (limbs[top] == 0) {
+      top--;
+    }
+  }
+  p = detail::write_dec_u64(p, limbs[0], false);
+  return std::string(p, end);
+}
+
+// Parses plain decimal digits, reverts on anything else or on a value that
+// does not fit in 256 bits
+inline uint256 from_dec_string(const std::string &str) {
+  if (str.empty()) {
+    revert_with_message("from_dec_string: empty string");
+    return uint256();
+  }
+  uint256 result;
+  // the leading chunk takes the remainder so every later one is 19 digits
+  size_t chunk = str.size() % detail::DEC_CHUNK_DIGITS;
+  if (chunk == 0) {
+    chunk = detail::DEC_CHUNK_DIGITS;
+  }
+  for (size_t i = 0; i < str.size(); i += chunk) {
+    if (i != 0) {
+      chunk = detail::DEC_CHUNK_DIGITS;
+    }
+    uint64_t digits = 0;
+    for (size_t j = i; j < i + chunk; j++) {
+      char c = str[j];
+      if (c < '0' || c > '9') {
+        revert_with_message(std::string("from_dec_string: invalid digit in ") +
+                            str);
+        return uint256();
+      }
+      digits = digits * 10 + uint64_t(c - '0');
+    }
+    bool overflow = mul_overflow(result, detail::pow10_table[chunk], result);
+    overflow |= add_overflow(result, uint256(digits), result);
+    if (overflow) {
+      revert_with_message(std::string("from_dec_string: value out of range ") +
+                          str);
+      return uint256();
+    }
+  }
+  return result;
+}
+
+// Shortest 0x prefixed lowercase hex, "0x0" for zero, the JSON-RPC
+// quantity format
+inline std::string to_hex_string(const uint256 &value) {
+  uint8_t be[32] = {};
+  value.to_be_bytes(be);
+  size_t digits = value == uint256(0) ? 1 : size_t(259 - clz(value)) / 4;
+  std::string result(2 + digits, '0');
+  result[1] = 'x';
+  for (size_t i = 0; i < digits; i++) {
+    size_t nibble = 64 - digits + i;
+    uint8_t byte = be[nibble / 2];
+    result[2 + i] = detail::hex_digits[nibble % 2 ? byte & 0xf : byte >> 4];
+  }
+  return result;
+}
+
+// Accepts an optional 0x/0X prefix and up to 64 significant hex digits of
+// either case, reverts otherwise
+inline uint256 from_hex_string(const std::string &str) {
+  size_t begin = 0;
+  if (str.size() >= 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) {
+    begin = 2;
+  }
+  if (begin == str.size()) {
+    revert_with_message(std::string("from_hex_string: no digits in ") + str);
+    return uint256();
+  }
+  // leading zeros do not count toward the 64 digits
+  size_t first = begin;
+  while (first + 1 < str.size() && str[first] == '0') {
+    first++;
+  }
+  if (str.size() - first > 64) {
+    revert_with_message(std::string("from_hex_string: value out of range ") +
+                        str);
+    return uint256();
+  }
+  uint64_t limbs[4] = {};
+  for (size_t i = first; i < str.size(); i++) {
+    int digit = detail::literal_digit_value(str[i]);
+    if (digit < 0) {
+      revert_with_message(std::string("from_hex_string: invalid digit in ") +
+                          str);
+      return uint256();
+    }
+    size_t shift = (str.size() - 1 - i) * 4;
+    limbs[shift / 64] |= uint64_t(digit) << (shift % 64);
+  }
+  return uint256((__uint128_t(limbs[3]) << 64) | limbs[2],
+                 (__uint128_t(limbs[1]) << 64) | limbs[0]);
+}
+
 } // namespace dtvm
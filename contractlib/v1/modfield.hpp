@@ -0,0 +1,291 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "math.hpp"
+#include <array>
+#include <cstdint>
+
+namespace dtvm {
+
+// Arithmetic modulo an odd 256-bit prime in Montgomery form, for the curve
+// and pairing math the host does not provide as precompiles.
+//
+// The modulus comes from a params struct with a `static constexpr uint256 P`
+// member (a uint256 can not be a template argument before C++20). Everything
+// derived from it, the limbs, -P^-1 mod 2^64 and R^2 mod P, is computed at
+// compile time, so a multiplication is the 4x4 limb CIOS loop and nothing
+// else. Values are kept as a * 2^256 mod P and only converted back by
+// to_uint256().
+
+namespace detail {
+
+using Limbs4 = std::array<uint64_t, 4>;
+
+constexpr Limbs4 to_limbs(const uint256 &x) {
+  return {uint64_t(x.low), uint64_t(x.low >> 64), uint64_t(x.high),
+          uint64_t(x.high >> 64)};
+}
+
+constexpr uint256 from_limbs(const Limbs4 &x) {
+  return uint256((__uint128_t(x[3]) << 64) | x[2],
+                 (__uint128_t(x[1]) << 64) | x[0]);
+}
+
+// -p^-1 mod 2^64 for odd p. Each Newton step doubles the correct low bits
+// and p * p = 1 mod 8 gives the first 3.
+constexpr uint64_t montgomery_n0(uint64_t p) {
+  uint64_t inv = p;
+  for (int i = 0; i < 5; i++) {
+    inv *= 2 - p * inv;
+  }
+  return 0 - inv;
+}
+
+constexpr bool limbs_less(const Limbs4 &a, const Limbs4 &b) {
+  for (int i = 3; i >= 0; i--) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i];
+    }
+  }
+  return false;
+}
+
+// out = a - b, returns the borrow
+constexpr uint64_t limbs_sub(const Limbs4 &a, const Limbs4 &b, Limbs4 &out) {
+  uint64_t borrow = 0;
+  for (int i = 0; i < 4; i++) {
+    out[i] = subb64(a[i], b[i], borrow, borrow);
+  }
+  return borrow;
+}
+
+// out = a + b, returns the carry
+constexpr uint64_t limbs_add(const Limbs4 &a, const Limbs4 &b, Limbs4 &out) {
+  uint64_t carry = 0;
+  for (int i = 0; i < 4; i++) {
+    out[i] = addc64(a[i], b[i], carry, carry);
+  }
+  return carry;
+}
+
+// t + a * b + carry, the low limb is returned and the high one replaces carry.
+// Built on mul64 and addc64 rather than __uint128_t, which wasm32 lowers to
+// __multi3 calls. The high limb can not overflow, the sum is below 2^128.
+constexpr uint64_t mac(uint64_t t, uint64_t a, uint64_t b, uint64_t &carry) {
+  uint64_t high = 0;
+  uint64_t low = mul64(a, b, high);
+  uint64_t c1 = 0, c2 = 0;
+  low = addc64(low, t, 0, c1);
+  low = addc64(low, carry, 0, c2);
+  carry = high + c1 + c2;
+  return low;
+}
+
+// a * b * 2^-256 mod p for a, b < p, coarsely integrated operand scanning:
+// every row of the product is reduced right away, so the accumulator never
+// grows past 6 limbs. The rows are written out because the nested loops are
+// only unrolled at -O3.
+constexpr Limbs4 montgomery_mul(const Limbs4 &a, const Limbs4 &b,
+                                const Limbs4 &p, uint64_t n0) {
+  uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0;
+  for (int i = 0; i < 4; i++) {
+    uint64_t carry = 0;
+    t0 = mac(t0, a[0], b[i], carry);
+    t1 = mac(t1, a[1], b[i], carry);
+    t2 = mac(t2, a[2], b[i], carry);
+    t3 = mac(t3, a[3], b[i], carry);
+    uint64_t t5 = 0;
+    t4 = addc64(t4, carry, 0, t5);
+
+    // adding m * p clears the lowest limb, which is then shifted out
+    uint64_t m = t0 * n0;
+    carry = 0;
+    mac(t0, m, p[0], carry);
+    t0 = mac(t1, m, p[1], carry);
+    t1 = mac(t2, m, p[2], carry);
+    t2 = mac(t3, m, p[3], carry);
+    uint64_t c = 0;
+    t3 = addc64(t4, carry, 0, c);
+    t4 = t5 + c;
+  }
+  // the result is below 2p, one conditional subtraction brings it below p
+  Limbs4 result = {t0, t1, t2, t3};
+  if (t4 != 0 || !limbs_less(result, p)) {
+    limbs_sub(result, p, result);
+  }
+  return result;
+}
+
+} // namespace detail
+
+template <typename Params> class ModField {
+public:
+  static constexpr uint256 P = Params::P;
+  static_assert((P.low & 1) == 1 && P > uint256(1),
+                "ModField needs an odd modulus");
+
+  constexpr ModField() : limbs_{} {}
+
+  // x mod P, converted to Montgomery form
+  static constexpr ModField from_uint256(const uint256 &x) {
+    const detail::Limbs4 &reduced = detail::to_limbs(x < P ? x : x % P);
+    return from_montgomery_limbs(detail::montgomery_mul(reduced, R2_LIMBS,
+                                                        P_LIMBS, N0));
+  }
+
+  static constexpr ModField zero() { return ModField(); }
+
+  static constexpr ModField one() {
+    return from_montgomery_limbs(R_MOD_LIMBS);
+  }
+
+  constexpr uint256 to_uint256() const {
+    return detail::from_limbs(
+        detail::montgomery_mul(limbs_, ONE_LIMBS, P_LIMBS, N0));
+  }
+
+  constexpr bool is_zero() const {
+    return (limbs_[0] | limbs_[1] | limbs_[2] | limbs_[3]) == 0;
+  }
+
+  constexpr ModField operator+(const ModField &other) const {
+    detail::Limbs4 sum = {};
+    uint64_t carry = detail::limbs_add(limbs_, other.limbs_, sum);
+    if (carry != 0 || !detail::limbs_less(sum, P_LIMBS)) {
+      detail::limbs_sub(sum, P_LIMBS, sum);
+    }
+    return from_montgomery_limbs(sum);
+  }
+
+  constexpr ModField operator-(const ModField &other) const {
+    detail::Limbs4 diff = {};
+    if (detail::limbs_sub(limbs_, other.limbs_, diff) != 0) {
+      detail::limbs_add(diff, P_LIMBS, diff);
+    }
+    return from_montgomery_limbs(diff);
+  }
+
+  constexpr ModField operator-() const { return ModField() - *this; }
+
+  constexpr ModField operator*(const ModField &other) const {
+    return from_montgomery_limbs(
+        detail::montgomery_mul(limbs_, other.limbs_, P_LIMBS, N0));
+  }
+
+  constexpr ModField &operator+=(const ModField &other) {
+    *this = *this + other;
+    return *this;
+  }
+
+  constexpr ModField &operator-=(const ModField &other) {
+    *this = *this - other;
+    return *this;
+  }
+
+  constexpr ModField &operator*=(const ModField &other) {
+    *this = *this * other;
+    return *this;
+  }
+
+  constexpr ModField square() const { return *this * *this; }
+
+  // Left to right with a fixed 4-bit window: 256 squarings and at most 64
+  // multiplications from a table of 16 powers
+  constexpr ModField pow(const uint256 &exponent) const {
+    ModField table[16] = {};
+    table[0] = one();
+    for (int i = 1; i < 16; i++) {
+      table[i] = table[i - 1] * *this;
+    }
+    const detail::Limbs4 &e = detail::to_limbs(exponent);
+    ModField result = one();
+    bool started = false;
+    for (int i = 63; i >= 0; i--) {
+      if (started) {
+        result = result.square().square().square().square();
+      }
+      uint64_t window = (e[i / 16] >> ((i % 16) * 4)) & 0xf;
+      if (window != 0) {
+        result = started ? result * table[window] : table[window];
+        started = true;
+      }
+    }
+    return result;
+  }
+
+  // a^(P - 2), P being prime. The inverse of zero reverts with Panic(0x12)
+  // like a division by zero.
+  constexpr ModField inverse() const {
+    if (is_zero()) {
+      panic(PANIC_DIVISION_BY_ZERO);
+      return ModField();
+    }
+    return pow(P - uint256(2));
+  }
+
+  constexpr ModField operator/(const ModField &other) const {
+    return *this * other.inverse();
+  }
+
+  constexpr bool operator==(const ModField &other) const {
+    return ((limbs_[0] ^ other.limbs_[0]) | (limbs_[1] ^ other.limbs_[1]) |
+            (limbs_[2] ^ other.limbs_[2]) | (limbs_[3] ^ other.limbs_[3])) ==
+           0;
+  }
+
+  constexpr bool operator!=(const ModField &other) const {
+    return !(*this == other);
+  }
+
+  // The raw Montgomery form, a * 2^256 mod P
+  constexpr const detail::Limbs4 &montgomery_limbs() const { return limbs_; }
+
+  static constexpr ModField from_montgomery_limbs(const detail::Limbs4 &x) {
+    ModField result;
+    result.limbs_ = x;
+    return result;
+  }
+
+private:
+  static constexpr detail::Limbs4 P_LIMBS = detail::to_limbs(P);
+  static constexpr uint64_t N0 = detail::montgomery_n0(P_LIMBS[0]);
+  // 2^256 mod P is the Montgomery form of one
+  static constexpr uint256 R_MOD = (uint256::max() % P + uint256(1)) % P;
+  static constexpr detail::Limbs4 R_MOD_LIMBS = detail::to_limbs(R_MOD);
+  static constexpr detail::Limbs4 R2_LIMBS =
+      detail::to_limbs(mulmod(R_MOD, R_MOD, P));
+  static constexpr detail::Limbs4 ONE_LIMBS = {1, 0, 0, 0};
+
+  detail::Limbs4 limbs_;
+};
+
+// Base field and group order of secp256k1
+struct Secp256k1FieldParams {
+  static constexpr uint256 P =
+      0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+};
+
+struct Secp256k1OrderParams {
+  static constexpr uint256 P =
+      0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141_u256;
+};
+
+// Base field and scalar field of alt_bn128 (bn254), the curve of the
+// ecAdd/ecMul/ecPairing precompiles
+struct Bn254FieldParams {
+  static constexpr uint256 P =
+      0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47_u256;
+};
+
+struct Bn254ScalarParams {
+  static constexpr uint256 P =
+      0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001_u256;
+};
+
+using secp256k1_fp = ModField<Secp256k1FieldParams>;
+using secp256k1_fn = ModField<Secp256k1OrderParams>;
+using bn254_fp = ModField<Bn254FieldParams>;
+using bn254_fr = ModField<Bn254ScalarParams>;
+
+} // namespace dtvm
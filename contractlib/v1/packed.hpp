@@ -0,0 +1,314 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "math.hpp"
+#include "types.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace dtvm {
+
+// Several small values packed into one 256-bit word, the way solidity packs
+// struct members into a storage slot:
+//
+//   using Expiry = BitField<0, 40, uint64_t>;
+//   using Paused = BitField<40, 1, bool>;
+//   using Amount = BitField<64, 96, __uint128_t>;
+//   PackedWord<Expiry, Paused, Amount> word;
+//   word.set<Amount>(amount);
+//
+// Offsets count bits from the least significant end. Offset and width are
+// template arguments, so get and set compile down to a constant shift and
+// mask of the half that holds the field instead of the generic uint256
+// shifts. The bytes32 overloads read and write only the bytes that cover
+// the field, so a storage word does not have to be converted as a whole.
+// Setting a value that does not fit in the field reverts with Panic(0x11).
+
+namespace detail {
+
+template <typename T>
+constexpr bool is_packed_integer_v = std::is_integral<T>::value ||
+                                     std::is_same<T, __int128_t>::value ||
+                                     std::is_same<T, __uint128_t>::value;
+
+template <typename T>
+constexpr bool is_packed_signed_v =
+    std::is_signed<T>::value || std::is_same<T, __int128_t>::value;
+
+// How a value type maps to the bits of a field: BITS is the widest field it
+// needs, fits() tells whether a value is representable in `width` bits
+template <typename T, typename Enable = void> struct PackedValue;
+
+template <> struct PackedValue<bool> {
+  static constexpr size_t BITS = 1;
+  static constexpr uint256 to_bits(bool value) {
+    return uint256(value ? 1 : 0);
+  }
+  static constexpr bool from_bits(const uint256 &bits, size_t) {
+    return bits != uint256(0);
+  }
+  static constexpr bool fits(bool, size_t) { return true; }
+};
+
+template <typename T>
+struct PackedValue<T, std::enable_if_t<is_packed_integer_v<T> &&
+                                       !is_packed_signed_v<T> &&
+                                       !std::is_same<T, bool>::value>> {
+  static constexpr size_t BITS = sizeof(T) * 8;
+  static constexpr uint256 to_bits(T value) {
+    return uint256(__uint128_t(value));
+  }
+  static constexpr T from_bits(const uint256 &bits, size_t) {
+    return T(bits.low);
+  }
+  static constexpr bool fits(T value, size_t width) {
+    return width >= BITS || (__uint128_t(value) >> width) == 0;
+  }
+};
+
+// Signed values are stored as width-bit two's complement
+template <typename T>
+struct PackedValue<T, std::enable_if_t<is_packed_integer_v<T> &&
+                                       is_packed_signed_v<T>>> {
+  static constexpr size_t BITS = sizeof(T) * 8;
+  static constexpr uint256 to_bits(T value) {
+    return int256(__int128_t(value)).to_bits();
+  }
+  static constexpr T from_bits(const uint256 &bits, size_t width) {
+    return T(int256::sign_extend(bits, width).to_int128());
+  }
+  static constexpr bool fits(T value, size_t width) {
+    // all bits from the sign bit of the field up must be equal
+    return width >= BITS || (__int128_t(value) >> (width - 1)) == 0 ||
+           (__int128_t(value) >> (width - 1)) == -1;
+  }
+};
+
+template <> struct PackedValue<uint256> {
+  static constexpr size_t BITS = 256;
+  static constexpr uint256 to_bits(const uint256 &value) { return value; }
+  static constexpr uint256 from_bits(const uint256 &bits, size_t) {
+    return bits;
+  }
+  static constexpr bool fits(const uint256 &value, size_t width) {
+    return width >= BITS || (value >> width) == uint256(0);
+  }
+};
+
+template <> struct PackedValue<int256> {
+  static constexpr size_t BITS = 256;
+  static constexpr uint256 to_bits(const int256 &value) {
+    return value.to_bits();
+  }
+  static constexpr int256 from_bits(const uint256 &bits, size_t width) {
+    return int256::sign_extend(bits, width);
+  }
+  static constexpr bool fits(const int256 &value, size_t width) {
+    return width >= BITS ||
+           int256::sign_extend(value.to_bits(), width) == value;
+  }
+};
+
+template <> struct PackedValue<Address> {
+  static constexpr size_t BITS = 160;
+  static uint256 to_bits(const Address &value) {
+    return uint256(value.to_bytes32());
+  }
+  static Address from_bits(const uint256 &bits, size_t) {
+    return Address(bits.bytes());
+  }
+  static bool fits(const Address &, size_t width) { return width >= BITS; }
+};
+
+// bytesN, as the big endian number its bytes spell
+template <size_t N>
+struct PackedValue<std::array<uint8_t, N>,
+                   std::enable_if_t<N >= 1 && N <= 32>> {
+  static constexpr size_t BITS = 8 * N;
+  static constexpr uint256 to_bits(const std::array<uint8_t, N> &value) {
+    bytes32 word{};
+    for (size_t i = 0; i < N; i++) {
+      word[32 - N + i] = value[i];
+    }
+    return uint256(word);
+  }
+  static constexpr std::array<uint8_t, N> from_bits(const uint256 &bits,
+                                                    size_t) {
+    const bytes32 &word = bits.bytes();
+    std::array<uint8_t, N> value{};
+    for (size_t i = 0; i < N; i++) {
+      value[i] = word[32 - N + i];
+    }
+    return value;
+  }
+  static constexpr bool fits(const std::array<uint8_t, N> &, size_t width) {
+    return width >= BITS;
+  }
+};
+
+constexpr __uint128_t low_bits_mask128(size_t width) {
+  return width >= 128 ? ~__uint128_t(0) : (__uint128_t(1) << width) - 1;
+}
+
+// Bits [Offset, Offset + Width) of word, shifted down. A field inside one
+// 128-bit half is a native shift and mask, only a field across the halves
+// goes through the uint256 shift.
+template <size_t Offset, size_t Width>
+constexpr uint256 extract_bits(const uint256 &word) {
+  constexpr __uint128_t mask = low_bits_mask128(Width);
+  if constexpr (Offset + Width <= 128) {
+    return uint256((word.low >> Offset) & mask);
+  } else if constexpr (Offset >= 128) {
+    return uint256((word.high >> (Offset - 128)) & mask);
+  } else {
+    return (word >> Offset) & (uint256::max() >> (256 - Width));
+  }
+}
+
+// word with bits [Offset, Offset + Width) replaced by the low Width bits of
+// value
+template <size_t Offset, size_t Width>
+constexpr uint256 insert_bits(const uint256 &word, const uint256 &value) {
+  constexpr __uint128_t mask = low_bits_mask128(Width);
+  if constexpr (Offset + Width <= 128) {
+    return uint256(word.high, (word.low & ~(mask << Offset)) |
+                                  ((value.low & mask) << Offset));
+  } else if constexpr (Offset >= 128) {
+    constexpr size_t shift = Offset - 128;
+    return uint256((word.high & ~(mask << shift)) |
+                       ((value.low & mask) << shift),
+                   word.low);
+  } else {
+    const uint256 &field_mask = (uint256::max() >> (256 - Width)) << Offset;
+    return (word & ~field_mask) | ((value << Offset) & field_mask);
+  }
+}
+
+} // namespace detail
+
+template <size_t Offset, size_t Width, typename T = uint256> struct BitField {
+  static_assert(Width > 0 && Offset + Width <= 256,
+                "BitField must lie within a 256-bit word");
+  static_assert(Width <= detail::PackedValue<T>::BITS,
+                "BitField is wider than its value type");
+
+  using value_type = T;
+  static constexpr size_t OFFSET = Offset;
+  static constexpr size_t WIDTH = Width;
+  // the bits of the field in place
+  static constexpr uint256 MASK = (uint256::max() >> (256 - Width)) << Offset;
+
+  static constexpr T get(const uint256 &word) {
+    return Value::from_bits(detail::extract_bits<Offset, Width>(word), Width);
+  }
+
+  static constexpr uint256 set(const uint256 &word, const T &value) {
+    if (!Value::fits(value, Width)) {
+      panic(PANIC_ARITHMETIC_OVERFLOW);
+    }
+    return detail::insert_bits<Offset, Width>(word, Value::to_bits(value));
+  }
+
+  // Reads only the 16 big endian bytes around the field
+  static T get(const bytes32 &word) {
+    if constexpr (SPAN_BYTES <= 16) {
+      const __uint128_t bits = load_window(word);
+      return Value::from_bits(
+          uint256((bits >> WINDOW_SHIFT) & detail::low_bits_mask128(Width)),
+          Width);
+    } else {
+      return get(uint256(word));
+    }
+  }
+
+  // Rewrites only the 16 big endian bytes around the field
+  static void set(bytes32 &word, const T &value) {
+    if constexpr (SPAN_BYTES <= 16) {
+      if (!Value::fits(value, Width)) {
+        panic(PANIC_ARITHMETIC_OVERFLOW);
+      }
+      constexpr __uint128_t mask = detail::low_bits_mask128(Width)
+                                   << WINDOW_SHIFT;
+      __uint128_t bits = load_window(word);
+      bits = (bits & ~mask) |
+             ((Value::to_bits(value).low << WINDOW_SHIFT) & mask);
+      detail::store_be64(word.data() + WINDOW_BYTE, uint64_t(bits >> 64));
+      detail::store_be64(word.data() + WINDOW_BYTE + 8, uint64_t(bits));
+    } else {
+      word = set(uint256(word), value).bytes();
+    }
+  }
+
+private:
+  using Value = detail::PackedValue<T>;
+  // byte 0 of a big endian word holds bits 248..255
+  static constexpr size_t FIRST_BYTE = 31 - (Offset + Width - 1) / 8;
+  static constexpr size_t LAST_BYTE = 31 - Offset / 8;
+  static constexpr size_t SPAN_BYTES = LAST_BYTE - FIRST_BYTE + 1;
+  // a field spanning at most 16 bytes is read as the 16 byte window ending
+  // at its last byte (or starting at byte 0), two 64-bit loads
+  static constexpr size_t WINDOW_BYTE = LAST_BYTE >= 15 ? LAST_BYTE - 15 : 0;
+  static constexpr size_t WINDOW_SHIFT =
+      Offset % 8 + 8 * (WINDOW_BYTE + 15 - LAST_BYTE);
+
+  static __uint128_t load_window(const bytes32 &word) {
+    return (__uint128_t(detail::load_be64(word.data() + WINDOW_BYTE)) << 64) |
+           detail::load_be64(word.data() + WINDOW_BYTE + 8);
+  }
+};
+
+namespace detail {
+
+template <typename... Fields> constexpr bool bit_fields_disjoint() {
+  uint256 used;
+  bool disjoint = true;
+  ((disjoint = disjoint && (used & Fields::MASK) == uint256(0),
+    used = used | Fields::MASK),
+   ...);
+  return disjoint;
+}
+
+} // namespace detail
+
+// A 256-bit word made of non overlapping BitFields, checked at compile time
+template <typename... Fields> class PackedWord {
+  static_assert(detail::bit_fields_disjoint<Fields...>(),
+                "PackedWord fields overlap");
+
+public:
+  constexpr PackedWord() : word_() {}
+  constexpr explicit PackedWord(const uint256 &word) : word_(word) {}
+  constexpr explicit PackedWord(const bytes32 &word) : word_(word) {}
+
+  template <typename Field> constexpr typename Field::value_type get() const {
+    static_assert((std::is_same<Field, Fields>::value || ...),
+                  "field is not part of this PackedWord");
+    return Field::get(word_);
+  }
+
+  template <typename Field>
+  constexpr PackedWord &set(const typename Field::value_type &value) {
+    static_assert((std::is_same<Field, Fields>::value || ...),
+                  "field is not part of this PackedWord");
+    word_ = Field::set(word_, value);
+    return *this;
+  }
+
+  constexpr const uint256 &word() const { return word_; }
+
+  constexpr bytes32 to_bytes32() const { return word_.bytes(); }
+
+  constexpr bool operator==(const PackedWord &other) const {
+    return word_ == other.word_;
+  }
+
+  constexpr bool operator!=(const PackedWord &other) const {
+    return word_ != other.word_;
+  }
+
+private:
+  uint256 word_;
+};
+
+} // namespace dtvm
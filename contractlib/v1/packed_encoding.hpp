@@ -0,0 +1,280 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "fixed.hpp"
+#include "hostio.hpp"
+#include "math.hpp"
+#include "types.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace dtvm {
+
+// The non standard packed mode of solidity, abi.encodePacked: every value
+// takes its own size without padding (uint16 two bytes, address 20 bytes,
+// bytes4 four bytes), strings and bytes are their content without a length,
+// and only the elements of arrays are padded to 32 bytes. Raw bytes are
+// packed as Bytes: a std::vector<uint8_t> would be a uint8[] and does not
+// compile, nor does a std::array<uint8_t, N> longer than bytes32.
+//
+//   bytes32 commitment = keccak256_packed(sender, amount, salt);
+//
+// When every argument has a fixed size the encoding is built in a
+// std::array sized at compile time; otherwise the size is summed first and
+// the encoding written once, on the stack when it is small.
+// https://docs.soliditylang.org/en/latest/abi-spec.html#non-standard-packed-mode
+
+namespace detail {
+
+// How a value is packed: SIZE bytes for a fixed size type, size() bytes for
+// any type, written by write() which returns that size. write_word() writes
+// the 32-byte form an array element takes.
+template <typename T, typename Enable = void> struct AbiPacked;
+
+template <size_t Size> struct AbiPackedFixed {
+  static constexpr bool DYNAMIC = false;
+  static constexpr size_t SIZE = Size;
+  template <typename T> static constexpr size_t size(const T &) {
+    return Size;
+  }
+};
+
+// string literals are packed through the pointer they decay to
+template <typename T> using abi_packed_type_t = AbiPacked<std::decay_t<T>>;
+
+// big endian, two's complement for signed values
+template <typename T>
+struct AbiPacked<T, std::enable_if_t<std::is_integral<T>::value>>
+    : AbiPackedFixed<sizeof(T)> {
+  static size_t write(uint8_t *out, T value) {
+    for (size_t i = 0; i < sizeof(T); i++) {
+      out[sizeof(T) - 1 - i] = uint8_t(value >> (8 * i));
+    }
+    return sizeof(T);
+  }
+  static void write_word(uint8_t *out, T value) {
+    bool negative = false;
+    if constexpr (std::is_signed<T>::value) {
+      negative = value < 0;
+    }
+    memset(out, negative ? 0xff : 0, 32 - sizeof(T));
+    write(out + 32 - sizeof(T), value);
+  }
+};
+
+template <> struct AbiPacked<uint256> : AbiPackedFixed<32> {
+  static size_t write(uint8_t *out, const uint256 &value) {
+    value.to_be_bytes(out);
+    return 32;
+  }
+  static void write_word(uint8_t *out, const uint256 &value) {
+    write(out, value);
+  }
+};
+
+template <> struct AbiPacked<int256> : AbiPackedFixed<32> {
+  static size_t write(uint8_t *out, const int256 &value) {
+    value.to_bits().to_be_bytes(out);
+    return 32;
+  }
+  static void write_word(uint8_t *out, const int256 &value) {
+    write(out, value);
+  }
+};
+
+template <> struct AbiPacked<ufixed18> : AbiPackedFixed<32> {
+  static size_t write(uint8_t *out, const ufixed18 &value) {
+    value.to_raw().to_be_bytes(out);
+    return 32;
+  }
+  static void write_word(uint8_t *out, const ufixed18 &value) {
+    write(out, value);
+  }
+};
+
+template <> struct AbiPacked<sfixed18> : AbiPackedFixed<32> {
+  static size_t write(uint8_t *out, const sfixed18 &value) {
+    value.to_raw().to_bits().to_be_bytes(out);
+    return 32;
+  }
+  static void write_word(uint8_t *out, const sfixed18 &value) {
+    write(out, value);
+  }
+};
+
+template <> struct AbiPacked<Address> : AbiPackedFixed<20> {
+  static size_t write(uint8_t *out, const Address &value) {
+    memcpy(out, value.data(), 20);
+    return 20;
+  }
+  static void write_word(uint8_t *out, const Address &value) {
+    memset(out, 0, 12);
+    write(out + 12, value);
+  }
+};
+
+// bytes1 to bytes32, padded on the right inside an array
+template <size_t N>
+struct AbiPacked<std::array<uint8_t, N>, std::enable_if_t<N >= 1 && N <= 32>>
+    : AbiPackedFixed<N> {
+  static size_t write(uint8_t *out, const std::array<uint8_t, N> &value) {
+    memcpy(out, value.data(), N);
+    return N;
+  }
+  static void write_word(uint8_t *out, const std::array<uint8_t, N> &value) {
+    write(out, value);
+    memset(out + N, 0, 32 - N);
+  }
+};
+
+// Any other std::array<uint8_t, N> is no bytesN, and packing it as uint8[N]
+// would not be what a caller with raw bytes means
+template <size_t N>
+struct AbiPacked<std::array<uint8_t, N>, std::enable_if_t<N == 0 || N >= 33>>
+    : AbiPackedFixed<N> {
+  static_assert(N >= 1 && N <= 32,
+                "abi_encode_packed: a std::array<uint8_t, N> is bytes1 to "
+                "bytes32, pack longer raw bytes as Bytes");
+};
+
+// bytes and string: the content only
+template <typename T> struct AbiPackedByteString {
+  static constexpr bool DYNAMIC = true;
+  static size_t size(const T &value) { return value.size(); }
+  static size_t write(uint8_t *out, const T &value) {
+    if (value.size() != 0) {
+      memcpy(out, value.data(), value.size());
+    }
+    return value.size();
+  }
+};
+
+template <> struct AbiPacked<std::string> : AbiPackedByteString<std::string> {};
+
+template <>
+struct AbiPacked<std::string_view> : AbiPackedByteString<std::string_view> {
+};
+
+template <> struct AbiPacked<BytesView> : AbiPackedByteString<BytesView> {};
+
+template <> struct AbiPacked<Bytes> : AbiPackedByteString<Bytes> {};
+
+template <typename Char>
+struct AbiPacked<Char *, std::enable_if_t<std::is_same<
+                             std::remove_const_t<Char>, char>::value>> {
+  static constexpr bool DYNAMIC = true;
+  static size_t size(const char *value) { return strlen(value); }
+  static size_t write(uint8_t *out, const char *value) {
+    const size_t size = strlen(value);
+    memcpy(out, value, size);
+    return size;
+  }
+};
+
+// Arrays of fixed size elements, each padded to 32 bytes
+template <typename Container>
+size_t write_abi_packed_words(uint8_t *out, const Container &values) {
+  using T = typename Container::value_type;
+  static_assert(!AbiPacked<T>::DYNAMIC,
+                "packed arrays of dynamic types are not supported");
+  for (const T &value : values) {
+    AbiPacked<T>::write_word(out, value);
+    out += 32;
+  }
+  return 32 * values.size();
+}
+
+template <typename T, size_t N>
+struct AbiPacked<std::array<T, N>, std::enable_if_t<!std::is_same<
+                                       T, uint8_t>::value>>
+    : AbiPackedFixed<32 * N> {
+  static size_t write(uint8_t *out, const std::array<T, N> &value) {
+    return write_abi_packed_words(out, value);
+  }
+};
+
+template <typename T> struct AbiPacked<std::vector<T>> {
+  // the rest of the SDK hashes and stores a std::vector<uint8_t> as raw
+  // bytes, packing it as uint8[] would silently hash something else
+  static_assert(!std::is_same<T, uint8_t>::value,
+                "abi_encode_packed: pack raw bytes as Bytes, a "
+                "std::vector<uint8_t> would be packed as uint8[]");
+  static constexpr bool DYNAMIC = true;
+  static size_t size(const std::vector<T> &value) {
+    return 32 * value.size();
+  }
+  static size_t write(uint8_t *out, const std::vector<T> &value) {
+    return write_abi_packed_words(out, value);
+  }
+};
+
+// Arguments with a dynamic size at most this long are packed on the stack
+constexpr size_t ABI_PACKED_STACK_BUFFER_SIZE = 256;
+
+} // namespace detail
+
+template <typename... Args>
+constexpr bool abi_packed_static_v =
+    (!detail::abi_packed_type_t<Args>::DYNAMIC && ...);
+
+// Exact size of the packed encoding of args
+template <typename... Args> size_t abi_packed_size(const Args &...args) {
+  return (size_t(0) + ... + detail::abi_packed_type_t<Args>::size(args));
+}
+
+// The same for fixed size types only, known at compile time
+template <typename... Args> constexpr size_t abi_static_packed_size() {
+  static_assert(abi_packed_static_v<Args...>,
+                "abi_static_packed_size of a dynamic type");
+  return (size_t(0) + ... + detail::abi_packed_type_t<Args>::SIZE);
+}
+
+// Writes the packed encoding of args to out, which holds at least
+// abi_packed_size(args...) bytes, and returns its size
+template <typename... Args>
+size_t write_abi_packed(uint8_t *out, const Args &...args) {
+  uint8_t *cursor = out;
+  ((cursor += detail::abi_packed_type_t<Args>::write(cursor, args)), ...);
+  return size_t(cursor - out);
+}
+
+// abi.encodePacked(args...): a std::array when every argument has a fixed
+// size, otherwise a std::vector
+template <typename... Args> auto abi_encode_packed(const Args &...args) {
+  if constexpr (abi_packed_static_v<Args...>) {
+    std::array<uint8_t, abi_static_packed_size<Args...>()> result;
+    write_abi_packed(result.data(), args...);
+    return result;
+  } else {
+    std::vector<uint8_t> result(abi_packed_size(args...));
+    write_abi_packed(result.data(), args...);
+    return result;
+  }
+}
+
+// keccak256(abi.encodePacked(args...)), hashed straight from a stack buffer
+// unless a dynamic argument makes the encoding long
+template <typename... Args> bytes32 keccak256_packed(const Args &...args) {
+  if constexpr (abi_packed_static_v<Args...>) {
+    const auto &packed = abi_encode_packed(args...);
+    return hostio::keccak256(packed.data(), packed.size());
+  } else {
+    const size_t size = abi_packed_size(args...);
+    if (size <= detail::ABI_PACKED_STACK_BUFFER_SIZE) {
+      uint8_t buffer[detail::ABI_PACKED_STACK_BUFFER_SIZE];
+      write_abi_packed(buffer, args...);
+      return hostio::keccak256(buffer, size);
+    }
+    std::vector<uint8_t> buffer(size);
+    write_abi_packed(buffer.data(), args...);
+    return hostio::keccak256(buffer.data(), size);
+  }
+}
+
+} // namespace dtvm
@@ -0,0 +1,287 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "hostio.hpp"
+#include "math.hpp"
+#include "modfield.hpp"
+#include "secp256k1_table.hpp"
+#include "types.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace dtvm {
+namespace crypto {
+
+// secp256k1 public key recovery, what the evm ecrecover precompile does,
+// computed in wasm since the host has no such call.
+//
+// Points are kept in Jacobian coordinates (x / z^2, y / z^3) so additions
+// and doublings need no inversion until the very end. The generator part
+// u1 * G walks a precomputed table of 1..8 * 16^i * G (secp256k1_table.hpp)
+// with signed 4-bit digits, 65 mixed additions and no doublings. The
+// recovered point part u2 * R uses the same digits over a table of 1..8 * R
+// built per call: at most 65 additions, and 4 doublings per window below
+// the leading digit, at most 256.
+
+// Uncompressed public key without the 0x04 prefix: x then y, big endian
+using PublicKey = std::array<uint8_t, 64>;
+
+namespace detail {
+
+using Fp = secp256k1_fp;
+using Fn = secp256k1_fn;
+
+struct AffinePoint {
+  Fp x;
+  Fp y;
+};
+
+// z == 0 is the point at infinity
+struct JacobianPoint {
+  Fp x;
+  Fp y;
+  Fp z;
+
+  bool is_infinity() const { return z.is_zero(); }
+
+  JacobianPoint negate() const { return {x, -y, z}; }
+};
+
+constexpr size_t SCALAR_WINDOWS = 65;
+
+// (p + 1) / 4, p = 3 mod 4 so a square root of a is a^((p + 1) / 4)
+constexpr uint256 FP_SQRT_EXPONENT = (Fp::P + uint256(1)) >> 2;
+
+inline JacobianPoint to_jacobian(const AffinePoint &p) {
+  return {p.x, p.y, Fp::one()};
+}
+
+// dbl-2009-l, a = 0
+inline JacobianPoint point_double(const JacobianPoint &p) {
+  if (p.is_infinity() || p.y.is_zero()) {
+    return JacobianPoint();
+  }
+  const Fp &a = p.x.square();
+  const Fp &b = p.y.square();
+  const Fp &c = b.square();
+  Fp d = (p.x + b).square() - a - c;
+  d = d + d;
+  const Fp &e = a + a + a;
+  const Fp &f = e.square();
+  const Fp &x3 = f - d - d;
+  Fp eight_c = c + c;
+  eight_c = eight_c + eight_c;
+  eight_c = eight_c + eight_c;
+  const Fp &y3 = e * (d - x3) - eight_c;
+  const Fp &yz = p.y * p.z;
+  return {x3, y3, yz + yz};
+}
+
+// add-2007-bl
+inline JacobianPoint point_add(const JacobianPoint &p,
+                               const JacobianPoint &q) {
+  if (p.is_infinity()) {
+    return q;
+  }
+  if (q.is_infinity()) {
+    return p;
+  }
+  const Fp &z1z1 = p.z.square();
+  const Fp &z2z2 = q.z.square();
+  const Fp &u1 = p.x * z2z2;
+  const Fp &u2 = q.x * z1z1;
+  const Fp &s1 = p.y * q.z * z2z2;
+  const Fp &s2 = q.y * p.z * z1z1;
+  const Fp &h = u2 - u1;
+  Fp r = s2 - s1;
+  if (h.is_zero()) {
+    // same x: either the same point or its negation
+    return r.is_zero() ? point_double(p) : JacobianPoint();
+  }
+  r = r + r;
+  const Fp &i = (h + h).square();
+  const Fp &j = h * i;
+  const Fp &v = u1 * i;
+  const Fp &x3 = r.square() - j - v - v;
+  const Fp &s1j = s1 * j;
+  const Fp &y3 = r * (v - x3) - s1j - s1j;
+  const Fp &z3 = ((p.z + q.z).square() - z1z1 - z2z2) * h;
+  return {x3, y3, z3};
+}
+
+// madd-2007-bl, q in affine coordinates (z = 1)
+inline JacobianPoint point_add_affine(const JacobianPoint &p,
+                                      const AffinePoint &q) {
+  if (p.is_infinity()) {
+    return to_jacobian(q);
+  }
+  const Fp &z1z1 = p.z.square();
+  const Fp &u2 = q.x * z1z1;
+  const Fp &s2 = q.y * p.z * z1z1;
+  const Fp &h = u2 - p.x;
+  Fp r = s2 - p.y;
+  if (h.is_zero()) {
+    return r.is_zero() ? point_double(p) : JacobianPoint();
+  }
+  r = r + r;
+  const Fp &hh = h.square();
+  Fp i = hh + hh;
+  i = i + i;
+  const Fp &j = h * i;
+  const Fp &v = p.x * i;
+  const Fp &x3 = r.square() - j - v - v;
+  const Fp &y1j = p.y * j;
+  const Fp &y3 = r * (v - x3) - y1j - y1j;
+  const Fp &z3 = (p.z + h).square() - z1z1 - hh;
+  return {x3, y3, z3};
+}
+
+// Signed base 16 digits in [-7, 8], least significant first. A digit above
+// 8 borrows 16 from the next window, which is why a 256-bit scalar needs a
+// 65th window.
+inline void recode_scalar(const uint256 &k,
+                          int8_t (&digits)[SCALAR_WINDOWS]) {
+  const dtvm::detail::Limbs4 &limbs = dtvm::detail::to_limbs(k);
+  int carry = 0;
+  for (size_t i = 0; i < SCALAR_WINDOWS; i++) {
+    int nibble = i < 64 ? int((limbs[i / 16] >> ((i % 16) * 4)) & 0xf) : 0;
+    int digit = nibble + carry;
+    carry = digit > 8 ? 1 : 0;
+    digits[i] = int8_t(digit - 16 * carry);
+  }
+}
+
+inline AffinePoint generator_multiple(size_t window, int multiple) {
+  const auto &entry = SECP256K1_G_TABLE[window][multiple - 1];
+  return {Fp::from_montgomery_limbs({entry[0][0], entry[0][1], entry[0][2],
+                                     entry[0][3]}),
+          Fp::from_montgomery_limbs({entry[1][0], entry[1][1], entry[1][2],
+                                     entry[1][3]})};
+}
+
+// k * G
+inline JacobianPoint mul_generator(const uint256 &k) {
+  int8_t digits[SCALAR_WINDOWS] = {};
+  recode_scalar(k, digits);
+  JacobianPoint result;
+  for (size_t i = 0; i < SCALAR_WINDOWS; i++) {
+    if (digits[i] == 0) {
+      continue;
+    }
+    AffinePoint point = generator_multiple(i, digits[i] > 0 ? digits[i]
+                                                            : -digits[i]);
+    if (digits[i] < 0) {
+      point.y = -point.y;
+    }
+    result = point_add_affine(result, point);
+  }
+  return result;
+}
+
+// k * p
+inline JacobianPoint mul_point(const AffinePoint &p, const uint256 &k) {
+  int8_t digits[SCALAR_WINDOWS] = {};
+  recode_scalar(k, digits);
+  JacobianPoint multiples[8];
+  multiples[0] = to_jacobian(p);
+  multiples[1] = point_double(multiples[0]);
+  for (int i = 2; i < 8; i++) {
+    multiples[i] = point_add_affine(multiples[i - 1], p);
+  }
+  JacobianPoint result;
+  for (size_t i = SCALAR_WINDOWS; i-- > 0;) {
+    // nothing to double above the leading digit
+    if (!result.is_infinity()) {
+      for (int j = 0; j < 4; j++) {
+        result = point_double(result);
+      }
+    }
+    if (digits[i] > 0) {
+      result = point_add(result, multiples[digits[i] - 1]);
+    } else if (digits[i] < 0) {
+      result = point_add(result, multiples[-digits[i] - 1].negate());
+    }
+  }
+  return result;
+}
+
+} // namespace detail
+
+// The public key that produced signature (v, r, s) over hash, with the
+// ecrecover precompile rules: v is 27 or 28, r and s are in [1, n). Returns
+// nullopt for a signature no key can have produced.
+inline std::optional<PublicKey> recover_public_key(const bytes32 &hash,
+                                                   uint8_t v, const uint256 &r,
+                                                   const uint256 &s) {
+  using detail::Fn;
+  using detail::Fp;
+  if ((v != 27 && v != 28) || r == uint256(0) || r >= Fn::P ||
+      s == uint256(0) || s >= Fn::P) {
+    return std::nullopt;
+  }
+  // R = (r, y) with y^2 = r^3 + 7 and the parity given by v
+  const Fp &x = Fp::from_uint256(r);
+  const Fp &y_squared = x.square() * x + Fp::from_uint256(uint256(7));
+  Fp y = y_squared.pow(detail::FP_SQRT_EXPONENT);
+  if (y.square() != y_squared) {
+    return std::nullopt;
+  }
+  if ((y.to_uint256().low & 1) != uint8_t(v - 27)) {
+    y = -y;
+  }
+
+  // Q = r^-1 * (s * R - e * G) = u1 * G + u2 * R
+  const Fn &r_inverse = Fn::from_uint256(r).inverse();
+  const Fn &u1 = -(Fn::from_uint256(uint256(hash)) * r_inverse);
+  const Fn &u2 = Fn::from_uint256(s) * r_inverse;
+  const detail::JacobianPoint &q =
+      detail::point_add(detail::mul_generator(u1.to_uint256()),
+                        detail::mul_point({x, y}, u2.to_uint256()));
+  if (q.is_infinity()) {
+    return std::nullopt;
+  }
+  const Fp &z_inverse = q.z.inverse();
+  const Fp &z_inverse_squared = z_inverse.square();
+  PublicKey key = {};
+  (q.x * z_inverse_squared).to_uint256().to_be_bytes(key.data());
+  (q.y * z_inverse_squared * z_inverse).to_uint256().to_be_bytes(
+      key.data() + 32);
+  return key;
+}
+
+// keccak256(public key)[12:32]
+inline Address public_key_to_address(const PublicKey &key) {
+  return Address(hostio::keccak256(key.data(), key.size()));
+}
+
+// Same as the ecrecover precompile: the signer address, or the zero address
+// when the signature is invalid
+inline Address ecrecover(const bytes32 &hash, uint8_t v, const uint256 &r,
+                         const uint256 &s) {
+  const auto &key = recover_public_key(hash, v, r, s);
+  if (!key) {
+    return Address::zero();
+  }
+  return public_key_to_address(*key);
+}
+
+// s in the lower half of the order, the EIP-2 rule against malleable
+// signatures
+constexpr uint256 SECP256K1_HALF_ORDER = detail::Fn::P >> 1;
+
+// Whether signer signed hash. Unlike ecrecover this rejects high s values,
+// so every message has exactly one valid signature per key, and never
+// accepts the zero address.
+inline bool verify_signature(const bytes32 &hash, uint8_t v,
+                             const uint256 &r, const uint256 &s,
+                             const Address &signer) {
+  if (s > SECP256K1_HALF_ORDER || signer == Address::zero()) {
+    return false;
+  }
+  return ecrecover(hash, v, r, s) == signer;
+}
+
+} // namespace crypto
+} // namespace dtvm
@@ -0,0 +1,2295 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Generated by tools/gen_secp256k1_table.py, do not edit.
+
+#pragma once
+#include <cstdint>
+
+namespace dtvm {
+namespace crypto {
+namespace detail {
+
+// [window i][multiple j - 1][x, y][limb]: j * 16^i * G in affine
+// coordinates, Montgomery form, little endian limbs
+inline constexpr uint64_t SECP256K1_G_TABLE[65][8][2][4] = {
+    // 16^0 * G
+    {
+        {{0xd7362e5a487e2097, 0x231e295329bc66db,
+          0x979f48c033fd129c, 0x9981e643e9089f48},
+         {0xb15ea6d2d3dbabe2, 0x8dfc5d5d1f1dc64d,
+          0x70b6b59aac19c136, 0xcf3f851fd4a582d6}},
+        {{0x4e0640c981048d2c, 0x71354afc88b285a0,
+          0xce0b62e1e0140404, 0xf918623ccba0ee23},
+         {0x7d12d622ffaccfbf, 0x84fd25167dc75ce1,
+          0x4b3a0f64bda2cc65, 0x3c7f7712157b9313}},
+        {{0x2379d4bbd5fea781, 0x066ceafb22eb7bc4,
+          0x5940d07385985972, 0x9497730fcdf4c0ad},
+         {0xaf18b0b0613f55a9, 0xac4964cdc5a1f91f,
+          0xcc6048bd84885650, 0x3ec28dcd9215ec76}},
+        {{0x3daa13e8af6a0bfd, 0x37571e4d3b9b132f,
+          0xde9fbe79f9b379e0, 0x1957e6951ca769b7},
+         {0x1372e87e5bf5eae9, 0x746dd1bf9400d136,
+          0xc3e5bac23d6a1839, 0x4c9a2dbb209e02b9}},
+        {{0x212347fcbea19bc6, 0x58d7334ddc284cda,
+          0x20ce358572dd41dd, 0x8ed284d3aae7f96f},
+         {0x9e5e784800dfd9e7, 0x59aaa8d8aad35cc5,
+          0x011d0b107f8dbfd2, 0x1fd437ae583630c0}},
+        {{0xd409e08fe568f5bc, 0x534e4de75355fe43,
+          0x5d84dcf301b5b366, 0x5c8088490f91fa73},
+         {0x5dee0bf9c6a6b4ca, 0x7ba780ad82ae93be,
+          0xb9a0411797c737a7, 0x0175b14f2060a9c3}},
+        {{0x07ece566caa4cb22, 0xca934f8716c087c4,
+          0x4da362224e1d6bd5, 0x5f402433d73866e0},
+         {0x4777d1124a77d752, 0x879d7639f1097263,
+          0xf2fd13d87291ab04, 0xc8043a670ba1a73b}},
+        {{0xf23162063e0b48a5, 0x7a060c0bfa606728,
+          0x376af358ab408c8b, 0xc3088630cfa83a8c},
+         {0xceb03c71452c2cfb, 0x7b292c94ece7dd34,
+          0x75193c47f1ea48b2, 0x85b43f9979490860}},
+    },
+    // 16^1 * G
+    {
+        {{0x41a38518efe247fb, 0x78d77162cf43dec5,
+          0x952ed69488f3f45a, 0xb7f2007d526d9948},
+         {0xb252bfb837528726, 0x35538b908855c928,
+          0xe6e1d02ce631ad75, 0xa46b9ec0f2e973c0}},
+        {{0x7c2cd2b54d6a3d31, 0xacc8229d708ed243,
+          0x93e19cc4fe000a29, 0x98d1c0e47be6cf23},
+         {0x7d04a29f553f37ee, 0x7674374a341f8cab,
+          0x408bc0f94e530eb0, 0xbd734a1a4359aeab}},
+        {{0x44e9157911b93177, 0x4f830ca098772e8e,
+          0xe27a77c09f7a0825, 0x67f338a8324f752b},
+         {0x8300d9846306576a, 0xae2754732a87a305,
+          0xd265a3edae4252b8, 0x63d34ea8c4e44cf4}},
+        {{0xd8c0c00badc5e138, 0xad6f0e400a1a959c,
+          0x317b23fa350f79dc, 0xa48bbcf71f86167c},
+         {0x8a4e4fb7038d6070, 0xdba32df911f6a91f,
+          0x9117a04bde169768, 0x8c5413fb65165458}},
+        {{0xb60595c235d5ce17, 0xe4a5fe5a9280f7f1,
+          0x4b3e3ac460642368, 0xa1a594a4a994892e},
+         {0xa4b899744fd8366a, 0xaacb39b44ee22d9a,
+          0x3a722da52edfdd0d, 0x8a77303602abface}},
+        {{0xa37e927a6e4c9409, 0xd6319c71881700b0,
+          0x84de75918f77ce38, 0x1a9f59404c9d6ee7},
+         {0x7a765936b90dba8e, 0x4fba6879ad8cc1ce,
+          0xadab7d4fbff4a396, 0x6cea78b7010744e2}},
+        {{0xead24668d54ea7af, 0x781c3762b14b8fc2,
+          0xa2b4919e0b751eb1, 0x5485450751ec1669},
+         {0x23d46eed8f211747, 0x28a1007c8d715faa,
+          0x8d49d1804e6d9864, 0x96f44616b752226e}},
+        {{0xeda00fa5ec3affbc, 0x24baa6dda27cf329,
+          0x4de65a27831fe184, 0x45530b36ceacef82},
+         {0xbee2fc9a32b46bb1, 0xa15e982da1c18ac5,
+          0x8cdaad292cd58757, 0x7e92c43520968b2f}},
+    },
+    // 16^2 * G
+    {
+        {{0x4cfcb4bd9f1074ec, 0x1835086b7c2024c9,
+          0xc31c9d2f4edff79f, 0x2579cef38ff606e4},
+         {0xb48c82cecc1b198d, 0x627c2be007e10df3,
+          0xe023b6f049955153, 0x1b512c3a42dfcd74}},
+        {{0x0bfe04a84c547dfb, 0x4aad02f81775f100,
+          0x867081c61d838e77, 0xec18b94b4713f604},
+         {0xe154230eaa749885, 0x0be67ab5ef0dd49e,
+          0x7fe3818474c34d95, 0x331b6e9b27763e71}},
+        {{0xe5cdf281731bf60b, 0xe7736e570acfb943,
+          0x961e71aafc924055, 0x8b925240cdb7af38},
+         {0xde5e8553370ffeb3, 0xec3404bfa011c79e,
+          0xd87083b4d90833f5, 0xc3d9a1f2ff6b0b65}},
+        {{0xadb47b9d5bb2a131, 0x18668fe168ddbbea,
+          0x9cb9f68786a0679a, 0xc00f5a0f4033b7e8},
+         {0xc215ebe6edce153c, 0x4f227ec0293549dd,
+          0xb6190f9094db5f97, 0xe50530cc3e4dc133}},
+        {{0xe8486f409825134b, 0x29c1817fb3565685,
+          0x2f5059ff04327ce7, 0x78240cc1296f9fed},
+         {0x40ed9b4c92b4e0c2, 0xe4bf2e4cafdd2fc1,
+          0x700cdd31694f5d7c, 0x44dbc200f313bb4a}},
+        {{0x0fe439c71e2e0e15, 0x8bc9648752e9093b,
+          0x0629be5fee097557, 0xc272bf6c8b81090b},
+         {0xce4b3357a661a982, 0x54cd9970a42ebead,
+          0x155d69406af0d229, 0x7f041ba0cdc01d62}},
+        {{0x8535f0e3a605868f, 0xe4e8eac15fdbec4d,
+          0x6d4045636c51d587, 0xf84c0d829385abc5},
+         {0xc8ed7566b4db1764, 0xfe5ee68c50dc9c90,
+          0x8a43ae933cf20ad3, 0x97e50af19f57e898}},
+        {{0x7de2cebd0f9832c2, 0x6d395846aaadd62f,
+          0xa908234a2b3f4371, 0xf8c2f19024b2b7b7},
+         {0x52b723950f9a0344, 0xe11536a3d7adab7e,
+          0x22a165029cbf6ea0, 0x22dc4b14168e68f1}},
+    },
+    // 16^3 * G
+    {
+        {{0x116c7687bbc21801, 0xa001a156834431ed,
+          0x919bd70b4a6e9f8a, 0xa09c0bde99755bf7},
+         {0x4714b6ca7b90f619, 0xfe233422662644c3,
+          0x9658dc8daad44dab, 0x14307be489bce3f5}},
+        {{0x80ffeb19b3f0aae1, 0xc03325d7b4b720bd,
+          0x663940c4be7b2361, 0xc35df455e6f0c5c9},
+         {0x6ca7dfd92d3f13e6, 0x980cd80bf0a4cc8a,
+          0x861e5afbf991aaed, 0x5172f60db0067652}},
+        {{0xd2965cc49dd74772, 0xaadc7538cfc88200,
+          0xa20229b9925becda, 0xdb3983e0b4c6696a},
+         {0x65a740eb134f8de3, 0xac2363e8469ca3d6,
+          0xa5f569990b4f669c, 0x574e83f1845c5e5e}},
+        {{0x749f73b06b2ac5d0, 0x28d321824861c6c0,
+          0x6c39f5e0f89a609f, 0xfd624ceaeda196b0},
+         {0x875485b037a47e15, 0x324cd765629f2067,
+          0x3ab968eb37aae611, 0x6c2e7ce8d09ae889}},
+        {{0xfe19c066362fd421, 0xa6e4f62754d3f89e,
+          0x1957d786832b3fce, 0x1ccacfeb34d49328},
+         {0xbf010c37d54ca3e6, 0x47f2fe70dd752bd4,
+          0xa56a150fbc280c5a, 0x7f3ff6f939d33a53}},
+        {{0x8a68b090d49ad892, 0x0b4a9c4e4c81e66e,
+          0xc74a426bc437aaad, 0x6206eceda6e13178},
+         {0x0dd2eb6459b72466, 0x0d2baab12022e7a3,
+          0x19d578e637442fc5, 0x3453ab80532d7fcb}},
+        {{0x45052713a24ab7dc, 0x53e10dc0c0014470,
+          0x395f135e59003e6a, 0xa1fdd1999fe6bff3},
+         {0x0984ed314a931687, 0x128e93ad5e573574,
+          0x17944ece879e143d, 0x009b476325df68ce}},
+        {{0x6b260bbfa6757d7a, 0x993ff46b1930d6a4,
+          0xc8e8a1edb3e5216e, 0x00d4c6a641ee668c},
+         {0x273938faae8088d8, 0x68b15374a4b5047f,
+          0xfe18ecda874d8d54, 0x508f9f7804862d3e}},
+    },
+    // 16^4 * G
+    {
+        {{0x472e3968c233e953, 0x1c45ee21fc87d728,
+          0xb3e4b0ac7afd029c, 0x48a5c6c230aecdac},
+         {0x43b7f34f5de465f9, 0x21a5ec7a4bc742b0,
+          0x1f22f9382ceb7a9b, 0xa0ae9d2208a0867e}},
+        {{0x1d910ba68477c0ea, 0xa39fa521b63549ad,
+          0x097ddc650598761b, 0x62eb1f6c1fd6a297},
+         {0x8a2ea43e0cf8b987, 0xc6b0f39b86090af1,
+          0x4d8e8d733ff90728, 0x6295e1cf76e99c7a}},
+        {{0x8134a9bb81551783, 0x416d384f588330c0,
+          0x94876f60637f2c44, 0xd0bc50d23e297d5a},
+         {0xb0c308c846755d74, 0xb9d36414b95404bd,
+          0xfe21d7cfdc18beb9, 0xfee4f74a02e57fc2}},
+        {{0x4198dc4fadd553da, 0xb2573c15b709812c,
+          0x45eef966d467dd29, 0xbde3321a23315592},
+         {0x57f5392e557d2333, 0x9615d43ea05e9a82,
+          0xa647d9ca97e16953, 0xbbd3daf8a9add060}},
+        {{0x978b53855b298d61, 0x7cd10a2a10acbfde,
+          0xe225eb45328d5f02, 0x09fa229a17114557},
+         {0x1ee45919c753e8be, 0x6cf8504518337823,
+          0xb63b8bfa6da4b3cd, 0x0e08994c46dd396b}},
+        {{0x6d4aeea4056d818d, 0xda936f4529e743c1,
+          0x6ad0fce13a3b0275, 0x2253dc6329b4e7da},
+         {0xc4d5301622c8e826, 0x569c4620865f6313,
+          0x6e4f8d02c5e341d9, 0x8170c527f14f776d}},
+        {{0x7f7dcb2989b86cac, 0x26856130cf34fe91,
+          0x22065842d82cb82c, 0x71992d80b4adceb6},
+         {0xfece4806f9d88870, 0x7a0a1c353e7065a8,
+          0x513318471f77bc2a, 0xdb49c8ea5e8ab62f}},
+        {{0x95cdc2c6faa8508d, 0x46e632ebddc4127d,
+          0xb3f1ca5e1840794d, 0x0cc561e9c579b1bd},
+         {0xca6f7ed0867f4afa, 0x70d106284f4631f6,
+          0x13a5eeac1b63f977, 0xa74227aa0ec7c8ff}},
+    },
+    // 16^5 * G
+    {
+        {{0xd53d5d0472ed7345, 0xbcff12d439515ff5,
+          0x7a4d9d08b3b5828c, 0xf899a71b1bac7deb},
+         {0x6137eef2ba436c62, 0x0d85465e5e7f89ab,
+          0x1ed24e35f6d34352, 0x6737dbe3c1601124}},
+        {{0xd063ff04eb09f91b, 0x1fdccac2a7c4e3d6,
+          0x70c880eaa01dd4b0, 0x8d6116f0fede8ed9},
+         {0x4f9b552ca0ac9df8, 0x4c40f2a9a609996d,
+          0x34e1c988a732a8bf, 0xe3bf0f02c1dad6a6}},
+        {{0x723b7c7964727d73, 0x273acebab21a366a,
+          0x52bb492250cd2cfb, 0xa24b55fa0b64b761},
+         {0x4aed6807266f7bb5, 0x7e232c20cf67241b,
+          0x21fe3578b3b76cc0, 0x3df4119582ec9a9d}},
+        {{0xd0c2419f6d86153c, 0x231930a8b707ee22,
+          0x4bd3094f73b0e729, 0x6598e204dd2d59c1},
+         {0x3fc65a239d72d2d3, 0xd5d9825428f01f75,
+          0x57c84a68fe361ea7, 0xbfae09c8c8340d90}},
+        {{0x06908e0dd7025992, 0x5a83405c2c613728,
+          0x30f4abf4c704b367, 0x6070e00379c4a4f5},
+         {0x126ce1f0f02ba458, 0x4cd496dd5cb90f5f,
+          0xfb4884dc6ee31cc4, 0x2df0bffb185e0f36}},
+        {{0x8484bd224d510690, 0x7e9df071ed07d3e9,
+          0xee65b114e46df4e5, 0xd0a82236612542cb},
+         {0xe0c848c21c024c5e, 0xf781cd2fdf509289,
+          0x6da514062f137399, 0xa62e8b007042ee56}},
+        {{0x84f73c281235ff02, 0x82ad64d428e0d879,
+          0x0695cf5441feb6fc, 0x0d1b80f501b30f63},
+         {0x14823ec46200c5fa, 0x55f3a7c79489b1db,
+          0x26dc42caf32a660e, 0x9a8f9a716b59093a}},
+        {{0x078f84b0ff02af5f, 0x1cc32b8e0f98986b,
+          0x37122fcda4748fbd, 0x5284c6248b822a9a},
+         {0x4477515f51bb2de8, 0x768b4d3857450169,
+          0x9f1b455c8ea94210, 0xe1e3dfab25acf4eb}},
+    },
+    // 16^6 * G
+    {
+        {{0xf1f30e53ae61cf74, 0x1108822731948505,
+          0x172e66b4dffb9e31, 0xdf9ff060a70bfc59},
+         {0x4e514b1e987f9994, 0xae3d6b90b7bcb26d,
+          0xffbd8d2b1faa21c5, 0x46508fb2b42b5e11}},
+        {{0xdac9fedfc8fdb1ca, 0x4e2372d71c023806,
+          0xb6209e17ed781195, 0xdd19cbb4be645868},
+         {0xd00d02b22367ec3e, 0x1f15380220f5184e,
+          0xd08bdaa15fe86666, 0xa0aa7d33db261a6c}},
+        {{0xafb219d24955d9f7, 0xc8cd02e1f8b61ab0,
+          0x0653b5e2656b7953, 0x663fc69153963a49},
+         {0x4cdd8ec89698c7f7, 0xf8bf910554d0e85d,
+          0x09358777b91448ed, 0x12d14331d1b78395}},
+        {{0x807c4992441083ca, 0x2c48e9c9271f3aa8,
+          0x6c14a14278e145c6, 0x91360a8ac855f8ec},
+         {0x5aca2af76bc35034, 0x3e4db0f1fe99621f,
+          0x103d39c73b8a239a, 0x81c6b8dadc0b1203}},
+        {{0xcf94d8d4b16672e6, 0xf5a613b6fee90949,
+          0x00174a1e081078e0, 0x47d2d003ae9b8e33},
+         {0x136df2a0056210c6, 0x0ff481c0d39bf6d1,
+          0x282a83010dbbd8cc, 0x52a2d3558533b8d6}},
+        {{0xe6e6cc85515be081, 0x815d6368837404be,
+          0x7c65f6afaf5874e7, 0x5ebadcd57b41e998},
+         {0x281acd43ee87df45, 0xbc2e5f49a7104d2a,
+          0xccecd64135af9348, 0xeda934800d76730a}},
+        {{0x8d2db8dd3cf5c5d7, 0xb69668614a1868ea,
+          0xcedc1996643a45f9, 0xdbf0258715d60e5e},
+         {0x1935ec86f0fdbd28, 0x56e2e4d29d928044,
+          0x65f6b107837f5585, 0xf2315214f6c91fd5}},
+        {{0xac9e378ee1d4cd32, 0x422d0c1be5c66fad,
+          0x58ddd8297a2176cc, 0xd9ced3f21f2c9af3},
+         {0x6a271698017fac80, 0xe2b707f1c785fadf,
+          0x604ac7f2998a199c, 0xd292efdae73a0fdc}},
+    },
+    // 16^7 * G
+    {
+        {{0xf4f0250d77b6e2ed, 0xa1dcd50a06ad9e0a,
+          0x5ae11d44a2d18bfa, 0xbd22cee0955924a7},
+         {0x7336db5e3d232d71, 0xca473ec3798d3edc,
+          0x38aa2a3125fdaf3f, 0xd1e1ad45e9f40c01}},
+        {{0xae863d1a3eb2dbca, 0x119280b9c05e6183,
+          0xb3636741b29a523f, 0xcba31d0483ee9338},
+         {0xa782e9dabfc6a5d2, 0xd3266e189203414c,
+          0xb69c6b48740fdc53, 0xbec0d59743bc15ed}},
+        {{0x0e9b3d080e61e1cc, 0xe3adfcfd3ffb2a93,
+          0x555be66fb800d5a0, 0xc910b56dde7ffe34},
+         {0xc1f653583e7d150e, 0x958defcb3364f59d,
+          0x14d6aee093d82602, 0x64e6859087abe6a9}},
+        {{0xb097726a22376827, 0xe6b946d4af1ba09a,
+          0xc023d28604cc2dad, 0x4991ddae7912926a},
+         {0x564db45ec7f90d00, 0xf810acca720ddc70,
+          0xff8ef73cb4f4f9e3, 0x4e72ab52a6474b56}},
+        {{0xb441a838cb76d5ee, 0x08b557fa448db7e9,
+          0x95d983ead7644ed9, 0x6e22a4a079bd26ae},
+         {0xe8e925afcb50cc6f, 0xf127bd3b8ad75730,
+          0x837e036bf06da637, 0x4bb795a7f414f78f}},
+        {{0xfad5aa9ad43b07a9, 0x84fc5084f7c2d583,
+          0x1018af0120f4c9e8, 0xf628df2a3ff473ac},
+         {0x7a4c4c246d5cee38, 0xa568ff06751e2f4d,
+          0x3cbee46e4a906a53, 0xf40507eefc9f0fb3}},
+        {{0x40c42c0bf4ee70c8, 0x531c6c04d3bf850c,
+          0xdafa10595fbdd774, 0x6c89465c12b24339},
+         {0xa98c6b4259d4b3d5, 0x91e58b84379c9f4e,
+          0x2140a3549fc6e446, 0x6d557c9c66dfbdee}},
+        {{0xb4028f921e7b0132, 0x15c3ebada129b871,
+          0x00e771b626da4ac2, 0xc4ba5efd9a10d361},
+         {0x93982e79e44b597c, 0x2cd7fec6334b9d0e,
+          0xa9030fc62e29b81b, 0xa51325161d621df1}},
+    },
+    // 16^8 * G
+    {
+        {{0x9f30222b47476977, 0xaf4095525fe1d2dd,
+          0x9ef9133702cd5d56, 0xb3b436f386109b4e},
+         {0x0b4f8ebaac8dc00c, 0x349b5f127619927f,
+          0x98f120c4a670b81d, 0x2f2479a7c394b509}},
+        {{0xf9065b1817fb2c3f, 0xbaa506d8bb30cff5,
+          0x4cc3fc6e16e0251d, 0x3f1d3f188bff86c2},
+         {0xd33d0391b78b064b, 0xc63f14011a233126,
+          0x0aa7081db3b87f92, 0x62f17da77f000171}},
+        {{0xc7155e11fc3ee5c2, 0x36e8efe11ae69f50,
+          0x498e34dbf80108da, 0xdb5dcc909d6ace8d},
+         {0x177d4c2716e08e66, 0x867cbd65a22d77dc,
+          0x42383b71d75a980c, 0x3651d4a0fd9485cf}},
+        {{0xc7829ea4baf20e49, 0x53842d74695921e6,
+          0xaa34cc99e731d4c3, 0x6b3672681533aaa6},
+         {0xc620d219da5709a1, 0xa8dcb67db62f9483,
+          0x651aed2de269adbe, 0x5df6563844506fc9}},
+        {{0x1d2efd2e8575f04b, 0xe0d550b82c63fb78,
+          0x8792b2790492c198, 0x7dea745b805e85cc},
+         {0x34a03e6d0c5a24f5, 0x5131b06cbcf27dc5,
+          0x74b716f934562966, 0x0ff2cc3cbd33346b}},
+        {{0xe85f02743fe87d71, 0x1a9310410f31c2b7,
+          0x5cbef65b047a83b3, 0xe0eed60786dda041},
+         {0xe1154e9dabd857e5, 0xb02f7430eeb28618,
+          0xce95e9043de0541c, 0x5f4393a66c622d33}},
+        {{0x7ae64bdd58931210, 0x11c83d9116bb3c63,
+          0x9a59df143feff2a8, 0xedb4899e63846539},
+         {0x568f71ca6bdebcb5, 0x301608c3e16a0a89,
+          0x74412ac455c86cb8, 0x99dec8fa9584483c}},
+        {{0x257cbb5a8a920b0c, 0x4f80e557b4613386,
+          0x51f71ff256f595a0, 0x7e17e81a4530aacd},
+         {0x4750d6def98a3685, 0xabd27708d3065a36,
+          0x791e48de6b1e9af8, 0x76af6ee9bca94409}},
+    },
+    // 16^9 * G
+    {
+        {{0xc3f3edf57c24708a, 0xa2bdd58a729aed26,
+          0xf6a154cc23a0a78a, 0x1fa558161ac906f6},
+         {0x43a53c18f8862578, 0x609b54e610b5662f,
+          0x799f90a5a917fb59, 0x6324a09c39ec4c70}},
+        {{0xc27978605119187e, 0x90d6557dfaf02439,
+          0xcfd8ae5fe0adbbe8, 0x437a7bd0b087b69c},
+         {0x02c7ad93784da25a, 0x608be925a7ee1047,
+          0xc1b14459e07b67ae, 0x5ff419a334d84e59}},
+        {{0xdaecb8e704543248, 0x26480e25ed25202e,
+          0xfa2edfa8d76790ad, 0xbf541c55b6d0d99b},
+         {0x66f006521b13a756, 0xb223a80ee52f23d2,
+          0xae65cadebd112873, 0xd5493e1122a5f935}},
+        {{0xd65476fd3861e021, 0x52f846d64c46858a,
+          0xc05647c3d28aaff0, 0x7619286cd8c4e5a5},
+         {0x5a07a707bde4c525, 0xada62460ae488084,
+          0xc8a026c48b282577, 0x6f22abba66be4dc0}},
+        {{0xb7802c7ad055c424, 0x16d2f41d8f65ad90,
+          0x67950df3c768af4d, 0x77830c6fe0ad0bcd},
+         {0x2336e106bf8d2412, 0xb98e8dfc85ca88ac,
+          0x0e7e9545e95e2f7c, 0xb5e79cf57b53597f}},
+        {{0xea5525c767da8c11, 0x22b0b25454055c34,
+          0x615376d8709cb9f2, 0x1249adf4f5dde98b},
+         {0xdc249fa134ee5d1c, 0xb28e9180e1fe0af2,
+          0xa7c011009f7a7eb0, 0x021b8666585e14bb}},
+        {{0x7c035129bc6e166f, 0x15ed999ddb0b7458,
+          0xa6cf86ebbd5bbeb3, 0xad43e5029ff12f47},
+         {0x4327f71455132772, 0x3a2092de532bffb0,
+          0xe504269c17e79a40, 0xa7fa7a66fe6212c8}},
+        {{0x5410fd7d904f8ff3, 0xf41e2341c2ea9b82,
+          0x3cf9d9868a8e0a61, 0x88cee032905523d5},
+         {0x99e18cbf90500e56, 0xc8f503a954b36dc8,
+          0x3e47846c9acbd7c3, 0x3d12d02d59044ba5}},
+    },
+    // 16^10 * G
+    {
+        {{0xb4cbe1f9a31d9e68, 0x753e44ad81a39a40,
+          0x24942a08955bbf75, 0x237e206f5f040b8b},
+         {0x463c8a168a3e0d60, 0x51296c3fb66b0f39,
+          0x1436c2e876ca47b8, 0x67b2db2a4267c78e}},
+        {{0xd768a66cea5908bf, 0x7cb5e512eb0d786a,
+          0x32f9b0b1ebcd49f6, 0xf806f94a4503f651},
+         {0x054b98043cdbdb9d, 0xb57ec65d9f86dc68,
+          0xdfc7db252b5d1585, 0xd5db3f73bd703bc2}},
+        {{0x82dc87c968b5d6e5, 0x767ad90fc0d5b00e,
+          0xa22fc4a2f430d85f, 0xf767ae2a44eddded},
+         {0x6534930e6aa4ae2c, 0x0fd06a4f83835e85,
+          0xd45fa9d45fc5dcbd, 0x180b43dc52e5003d}},
+        {{0x7ab495bc4129572c, 0x4289b0a50d5137d9,
+          0x53ccf567db487d1a, 0x09f113c2e1db2c41},
+         {0xb690faa57ed1e6db, 0x5a1d2e66fa691934,
+          0x137b2a603dbac5ba, 0x6db7f694c0f893f4}},
+        {{0x8aaa5564147e2901, 0xf35d4745ac0ba42f,
+          0x5369599784d90619, 0xd47482a0390da26a},
+         {0xce0c2719a551b4fe, 0xe7a7ed5003889a62,
+          0x28e6b681e6f268d3, 0x75843cc225af46d8}},
+        {{0x03835c3aa7bd271b, 0x25e569eafe290d5f,
+          0x1174b814836289ab, 0xecc76c1c932bd1cf},
+         {0xd491daef26ecccb2, 0x87b565cdfbfcbdb9,
+          0x491913215146a17a, 0xa7e1c1f260b28130}},
+        {{0xc415db9e2cf3f659, 0xb199014d8992a840,
+          0xc0000d26f4b0b18a, 0xc964b8c966e954d3},
+         {0x2794cb2cec7da8f2, 0xcb22251cdc3377dc,
+          0xf82a51c46ff18f63, 0x57b660ec9020be85}},
+        {{0x5c205af8814121a8, 0x9d4309f36eca3cf1,
+          0x4c8277be19c46f7f, 0x9e8f6db65f603436},
+         {0x852871efd2402997, 0x322f8a8b8eaf049d,
+          0x83eb828b2aee808e, 0x879cff57869396af}},
+    },
+    // 16^11 * G
+    {
+        {{0xfbb078b09cf3a610, 0x6885d7d5b186da90,
+          0x95ed09e995203846, 0x16a106b326026494},
+         {0x5197f54b47bbfbe4, 0x41056d98b63c5137,
+          0xa2490613ccfa9b0c, 0x660bd8145ee9146f}},
+        {{0x91018dec677fa8a8, 0x1b96f6d669473bdf,
+          0x18fe61276df7a88c, 0x058b1bdb750e7dac},
+         {0x7fb0ce1ba31a3108, 0x55ed7c610dbc3ff8,
+          0xe29b0dbc4b1a54fe, 0x69c554ac610987cf}},
+        {{0x29665eafd74adf62, 0xabf7ebd2b5e65a35,
+          0xfa7349729b28897c, 0x1fb7be6494cc53de},
+         {0x2c965c9aa046f0cd, 0x30d20759b7825d93,
+          0x9ad6fab17f202308, 0xac4e7e7d6687e64f}},
+        {{0x8ab509c1f753150a, 0xb5738e4c08453c11,
+          0xe75bc57f39433bd4, 0x25c1b8e06b323296},
+         {0x5fe6c386aa3bb357, 0xe59d1de93c447acf,
+          0xe8a4304ae166ace1, 0x28f397f3f3697af9}},
+        {{0x772e609d9d13cd7c, 0x0078c6ee692b094c,
+          0xa65bebccf636431a, 0xc3f33c627a004bc8},
+         {0xc8f7d02ebb2873ba, 0xf94713c3decdae1b,
+          0x0788445a9365469d, 0x5bb3af6b49976891}},
+        {{0xdb82a8b4517bb70d, 0x0adffb8ca3f57688,
+          0x8b2132ee3083273e, 0x2cd8715b9e916271},
+         {0xa55491d0624769dd, 0xa9d03db69fea3ea5,
+          0xaa784140ccf844b5, 0x10fb3e5aaae950d4}},
+        {{0xc170b473322b782f, 0xd6702d75bb4963fc,
+          0x045b497d9cae193d, 0x401505f604bf304e},
+         {0x1c381826089992c9, 0x07658a7cff88b6d0,
+          0x3450ca8762377637, 0xd762c36dde142ea4}},
+        {{0x29a703acfe9879e5, 0xcc7f5c07e0fbd943,
+          0xf2531ea132b77e29, 0x312735ee32f4295f},
+         {0xdc2a8357a2e525a9, 0xf720f228ecbc8ab4,
+          0x381526cbcbd8796d, 0x7c76ac3d75e0e134}},
+    },
+    // 16^12 * G
+    {
+        {{0xb6be30d6f8690928, 0x88b68810434ea2e8,
+          0x3bd453bf4619fa9d, 0xf4f354d265a85a7d},
+         {0x91c6edb76254c4d6, 0xae770d165317107e,
+          0xccadedeaa81c00a8, 0xe646640ced889ed1}},
+        {{0x4fe0a88b7435f8be, 0x9e51a80bd00a39ab,
+          0x17895b4053ae3439, 0xe5b769ac63177687},
+         {0xb24d8149b4419d5a, 0xaf3cdff35e863840,
+          0xb5e37ee83a65e949, 0x9404d7901ddc8491}},
+        {{0x8244d9921bcf53a5, 0xc895dce20f4b77c7,
+          0xa04260ba53778ceb, 0x0e309d31c9eaaaa3},
+         {0x240597499194ea30, 0xfc23cf5034d6dd6e,
+          0x82ef6c7b810daad0, 0xc55aba338ed9675b}},
+        {{0x51950cbb40c47099, 0x90ad3d8a0a9b4a87,
+          0x544c3e23ae1eb361, 0x1269b5afa18ce64f},
+         {0x584bed44da9ac0af, 0xce3beee93d717c65,
+          0x63f33d45f1a3d771, 0x79542c046baf45dc}},
+        {{0x2f836f4bae9711a4, 0x4827e23c946948d4,
+          0x731a8af3a2f3bfb2, 0xaeb7decb048b4fef},
+         {0xa80f051deda16508, 0x9f0473b70732396e,
+          0x00c30d117f6d74fc, 0x2d2c25ffae9bed5f}},
+        {{0xce7206d4c2eacdc5, 0xb5d6b7a46e04b447,
+          0x4a93a8b89334c66d, 0xbb1eb0ecef6cc8f6},
+         {0x05a64f57f126dfce, 0x523f2dd704e0a471,
+          0x2d0d6a542efecb7d, 0xe24a7ab958f33498}},
+        {{0x577e5ced3e899cbb, 0x3d6888b5a8588455,
+          0x83de9e9fec08f299, 0x1a56e5f18cac68fb},
+         {0x61651b669fb95ffe, 0x8859922459bb331b,
+          0x033488c0785fd724, 0xa06ea37368415cfe}},
+        {{0xb30d3154c5c27031, 0x46dd0e3f756cd6c6,
+          0x1f04aa20bf0d1086, 0x5e033931af490e76},
+         {0x133ef88978b15ef9, 0x23e9249eaf1407a4,
+          0xae3d0578336fc35b, 0xb2036a029abea7bc}},
+    },
+    // 16^13 * G
+    {
+        {{0x9ff47ea65a491212, 0xb73df5ee9b99db72,
+          0xfc2b420f22c654eb, 0x99d30dc90a3c3c7f},
+         {0xdc38d58aff60c8b4, 0x88840754a82c9b1e,
+          0xec5a5d57cc17b854, 0xf66af64fc944a199}},
+        {{0x6f4ef69900ff6bc0, 0x49f1efed5253ccec,
+          0x01591591b6aeff80, 0x68df46c894c45f30},
+         {0x7bfafb219a914825, 0x096f8e5eb11e3ae4,
+          0x79a8615e29be22f6, 0x27ba8d9ac64b3624}},
+        {{0x6a5541d8a7653ea3, 0x852c403e2001defc,
+          0xc00a872a1f9919f8, 0x7ad62f633597fa24},
+         {0xf17c9c39036b7112, 0x2b286a2f9fcbc34a,
+          0x798f8b80f0371dd4, 0xb15fd6ac8468d228}},
+        {{0x7409cadfe38d8467, 0xaf089305f874c06d,
+          0xe237f9af86274217, 0x333526281ec3e3d8},
+         {0x5e1d7ec5c3fd78d8, 0x54bf72f7e36af166,
+          0xfa21fdc1cabe1ab2, 0x59327c5fa48ff343}},
+        {{0x63519941e1e8d2b2, 0xfef2e524a670a757,
+          0xa02b171049240195, 0x5094d956ed9fd86c},
+         {0x30604e4fffdc3267, 0x848862b462251341,
+          0xdc91bee3b4ac8dd3, 0x87c719672d86d787}},
+        {{0xfd16541251f4ac49, 0x8de303977f3d4d43,
+          0x15dc38680c2ca7c6, 0x4babcd3a13eced29},
+         {0x2de9b7325dff92cc, 0xa1b5dec8a941985d,
+          0x04a117a2db3553f4, 0x0940b4a5e44549d6}},
+        {{0x542160568a23e947, 0xcd8e9278c6410a9e,
+          0xb699eeace97ef6e6, 0xc550df2c63752ed0},
+         {0x26ff4f36c3d5c820, 0x3b65ce72c2370faf,
+          0x86097526c50931b7, 0xaddfa2f22a05c84d}},
+        {{0x5c92d1957d292089, 0xb2d11755973362e2,
+          0xe02d49fad3feb4c4, 0xfd9a00270c215642},
+         {0xd06976a21eccfa9c, 0x3090e7cdb8e81d80,
+          0xebc4ede69daa9002, 0xf3525b9be537c812}},
+    },
+    // 16^14 * G
+    {
+        {{0xf459f7b3f825a5fd, 0x4595b420413a74f6,
+          0x6b766e52094a50e1, 0xe415457989fb31e8},
+         {0x45e46b7fd180dfb0, 0x33e40fb4e2f5450f,
+          0x080c953d28afd08c, 0x7598eaa14c9519a8}},
+        {{0x02479b1e16e9e6d2, 0xb1d6219dbcade03d,
+          0xdc6acf7b90e35bf5, 0xbf0735f36e783aa3},
+         {0x393fc398c5baa77d, 0x5d3dc1be5897d9aa,
+          0x3ba028b995846d7a, 0x986fd6412ea0ecf1}},
+        {{0xf68bb6adcf253d88, 0x7232fc8ff8a6b0fe,
+          0x40000163e2d39fb4, 0x6f29fb8d9ca0725f},
+         {0x59d669a40614d077, 0xe115da8d4b6d578a,
+          0x3313523283a272b5, 0x9a6f2b25155c59ec}},
+        {{0xa519bf551b42ef1d, 0x06d8b643c27da179,
+          0x3897633b13c66d44, 0x0f05909eb601f991},
+         {0x2c6a65365dc3f8f6, 0xd33124163ed0a6ea,
+          0x6845bb2299fc2341, 0xce5e37dbb00980d7}},
+        {{0x75ccac9015cfcddc, 0x8d4cf698f1d0b218,
+          0x13d8056d70bef9e8, 0x657278197f4701be},
+         {0x7a91f372eaedc832, 0xebb63c41a0784147,
+          0x96f1754c919dbd15, 0x6a19841df72a4718}},
+        {{0x4e112715aeb6af41, 0x7d3ed2fb6c5205fd,
+          0xed2c26850511a84e, 0x4d8f50fc6d870d63},
+         {0xd563122f5e7f3eee, 0x305bbec20de61125,
+          0x6bd9ff85bec29080, 0x76e821fa069e573f}},
+        {{0xe2630698563e5ef7, 0xc39a5d58372aaa98,
+          0xedba16a107476b7b, 0x4f76607822dde27b},
+         {0x9a40f350e70b447d, 0x1932fa393ae1a820,
+          0x098fa4853043b4c6, 0x85ad1d78b0c2a84e}},
+        {{0x6dd33d862efaa7c4, 0xc6a9cff570e0b486,
+          0xc8385ff71007fe8c, 0x149d2919cc47f615},
+         {0x9c32c8ef1da795bb, 0x52baf59e82d6827f,
+          0xf0ac589583e96d6f, 0x8a6ccf8f65643257}},
+    },
+    // 16^15 * G
+    {
+        {{0x8b651ce58f8cfac9, 0xe7688f8881beda93,
+          0xef334ff50d656e1e, 0xa374d8d85ec25f80},
+         {0x9e13eae379c03819, 0xaf5831c18d4dab3c,
+          0x88deb51df6e90c26, 0x87a61f17823f5310}},
+        {{0x6db7491f33e3eb81, 0xfab69b8d1d01759d,
+          0xa8b52594b17c9bae, 0x36210cb3f6efb30c},
+         {0xc5545b121f950168, 0x5ee71cdb2df60ba8,
+          0xe7642e69c7f87caa, 0x54e006bf8999648f}},
+        {{0x0426236497239c58, 0x124db7c09181765b,
+          0xa7b5d21a8bdc8297, 0x1998f669684f23c3},
+         {0xf27a606339fd52b8, 0xb234c77af77c78a1,
+          0x768c0fb078f05350, 0xfdd391801b5e5d18}},
+        {{0x866ea46d69f216fb, 0x64a5d28a4ac99446,
+          0x8c3ea2e0055dbf41, 0xe38acecbbddaa65f},
+         {0xf1802eee26632b9a, 0x626bb951bc3f0465,
+          0x82e6ac2da26eadf6, 0x5c6d543ce3874052}},
+        {{0xf15adfe1951ab7ad, 0xd760a27091f8be57,
+          0x974f7ecbe2da421e, 0x6b41a29883e7bbe0},
+         {0xaaf40bb40467e682, 0x735ed4b61bf34e2d,
+          0x8d7cec0f40689777, 0xf8ef58a59a20cfb3}},
+        {{0x6e9dad0056971658, 0x819335e2bede65eb,
+          0xf4eb7d2714a1fb14, 0x5d41fb1941c61598},
+         {0x60e4f57eed7181ca, 0x539f5dd22420d5a6,
+          0xdf3b3e2f9051939c, 0x8f27e6ceab63b01c}},
+        {{0x33be69093a134039, 0x84255b1df04dd006,
+          0xbe2da53dfb23fde9, 0xaa9227621d7272b0},
+         {0x4512e3ba9d836751, 0xb204522cea4d6dad,
+          0x87df6050aa016939, 0xb90072212f7d3b93}},
+        {{0x5752669cfec4f694, 0x350bc0e9d6931168,
+          0x2439a6d5c8ddb9cf, 0xf63a69558ae0bb1d},
+         {0xcbe2cbc340d3e479, 0x96658df6eb98b4ee,
+          0xdd94fc99243a2f9f, 0xef71178186192cb2}},
+    },
+    // 16^16 * G
+    {
+        {{0xb6b50eda272e9751, 0x3fe27c6a195edbf5,
+          0x9cdd9c462ef8a9cf, 0x4c276680ccc851a3},
+         {0xc8e079a46f0a9ef3, 0x614800006b0ba84c,
+          0xdced315c48b8fa3e, 0x911a49b77f23719c}},
+        {{0x9c2dc74a062cc6de, 0xad363af24d4b0c6f,
+          0xefd5d6f24cc5d6e0, 0xff4ee6847710d86d},
+         {0xac77740b35836984, 0x3d90a19d760b044f,
+          0x7ee58462dd69d798, 0xd5bccfdc730e783a}},
+        {{0x58a746cc23eb95d8, 0xb295913233a5c0b2,
+          0x33af25d495c8c842, 0xc1d584228d5372f1},
+         {0x035f6c6815b3cace, 0x68986e01cb068d90,
+          0xd1672698fea468a7, 0x398ca3be948fe35e}},
+        {{0x0772382206fc124e, 0x2072d143f676d4e4,
+          0x19642255cbc34659, 0xf94542a637260eae},
+         {0x78312ef5520a49b3, 0x3127e5f14c89f1e7,
+          0x88ae06b995c11918, 0xbef471e116ea53bf}},
+        {{0x24d6f33af48c02a0, 0x38fa7d939a6b055d,
+          0xd71eb4495b7699f8, 0xef56b91d50db0390},
+         {0x8925a9d4de66789c, 0x0466f30a7cf94e94,
+          0x229a97c5309b9776, 0xd18fded84d0efc80}},
+        {{0x083723ac6a132af9, 0xd20d67b749464656,
+          0xd2da033f4cbd8c79, 0x115354034e39bdbc},
+         {0x374ca955d2493265, 0x5596dbf65baa52a1,
+          0x1f9ec6e2d7134f01, 0x57e391327aad335f}},
+        {{0xff9ba069f3c5a5ae, 0x477a8745983ef82f,
+          0x2c76ffbefc6dff89, 0xa46d7ac0bc0581c9},
+         {0x330b695a3812e747, 0x1127b1201ef269ea,
+          0x671abdc3268fc9ee, 0xb79b5cd6292c037d}},
+        {{0xa8ad36555ecbbda2, 0xd2dfe2626d02cbaa,
+          0xcc3adc4f0caa7d42, 0xb7d4037b60c19a0e},
+         {0xf348a376940f5e53, 0x36af5ad4db28bfda,
+          0xbccfa0820e1184f3, 0x01b52933cd943161}},
+    },
+    // 16^17 * G
+    {
+        {{0x8906b35938caee8d, 0x1361f201978659cd,
+          0xc3cdb311d3b2a63e, 0x4ca18196426f1eae},
+         {0x9fc1bb4223f6680b, 0x41341af13c7eced2,
+          0x88285a2c7a68e765, 0xaa750ed2b0d1d8f2}},
+        {{0x70082bfe92b19e2e, 0x1885861059bbcc7c,
+          0x0e5951245e4be779, 0x5c3337d6265e61a3},
+         {0x991c276b0bbc7265, 0x4f5363e112257611,
+          0xfc84e2840ac9ca06, 0x322debe0b554e5b3}},
+        {{0x5296fb6cfe7fc97b, 0x70129ca0769d949a,
+          0x54ca864591146f57, 0x436846db3244b026},
+         {0x678472122e1e9467, 0x6eef627d8566bc1c,
+          0x456264301f261530, 0x57907f1da9b23161}},
+        {{0x60c5ef28a8c46e18, 0xbdd078523400758e,
+          0x13c3796cc6066192, 0x56ac699d5c131aa2},
+         {0x9eb3fa4aec5d028c, 0xdbd7486c1b30f5e0,
+          0x0929ab49a82244a3, 0xa6498df131a1d3d3}},
+        {{0xee1d6321d13174b7, 0x5b0279697cd42b53,
+          0xc23ae92a96937683, 0xe4680034f364fb47},
+         {0x621a5fd5e1fea17a, 0x52a8c1df0bb943a5,
+          0xdf0b7316b1bd7ad1, 0x6159dd8b1d2fbb52}},
+        {{0x18aa5d1f871875ca, 0x1ea0c3517b3fe97e,
+          0xf7fb4fa3a1e5587a, 0xcad10d661de0eea8},
+         {0x0150c180dbdf364b, 0x81fafdd1cda347e7,
+          0xd8c7d93d916538a7, 0x85176b6cf32c03f6}},
+        {{0x54679b5540c29d6f, 0x59a270ebe729423b,
+          0x31f68f4b8aabaae9, 0x639fafc0339757e9},
+         {0x76a34f6705268c54, 0x329d7cbe5d13f3f4,
+          0x5e693a26e590dca7, 0xb1f63479362aa355}},
+        {{0x4886cbe596198bc9, 0x42d4373e7366aabf,
+          0xde65db0ab3204b5d, 0xcb3f63051a8cd005},
+         {0xdd738b59376af5de, 0x2265e993b4a71f08,
+          0x73a4816f3785c519, 0xc98eef27aa50fe89}},
+    },
+    // 16^18 * G
+    {
+        {{0xd6903021ca8bd10e, 0x7c2c8213c6272451,
+          0x067cc69da5b14d82, 0x09bc62745779456e},
+         {0x491003cf90e5bedd, 0xf0272347ca2bc9d3,
+          0x07dbe881f77b27f5, 0xa7f8657ee1acc935}},
+        {{0xd48ee6e72fcc27dc, 0x9459b268a8f8a441,
+          0x621709d51e0e6b59, 0x767d2ab7a53f5c0f},
+         {0x30c51859f7dae3dd, 0x79371372eb941438,
+          0xfef0469d2a9e82a3, 0xa901d3e43d3817bd}},
+        {{0x57fb2f5c28e31933, 0x4f941a25488f0307,
+          0xce6521c1cffbd305, 0xd6823f0bf98c249e},
+         {0x5bc9ae16852bb3c2, 0x4c0bf11d27e55cfb,
+          0x3ae61532af6b40c2, 0x7cb8966dd556097d}},
+        {{0x06359300f69f4a41, 0xf6289d15365b855b,
+          0xcf892307f20caebf, 0x53050f46037867b0},
+         {0xcd9f8831bc01018d, 0x9f5a7cff0c764963,
+          0x896bc119ccc8c6db, 0x3aeaa17e87266395}},
+        {{0xae4db078d7f02d26, 0xc65f85baac26d942,
+          0x70877b6f6f87f2a5, 0x267d15bc94e6606f},
+         {0xb15671344a99bbd5, 0x6e1378ce1fb1dab6,
+          0xb1bdca31f7bdc295, 0x8ccec147d557a617}},
+        {{0x545cc067a023701f, 0x73c0795b5db8696a,
+          0xb6782e7463513fb1, 0xb803a3d1ced829da},
+         {0xe41f645262ad7df8, 0x28f7c9bb4820b510,
+          0x53fb148e51bb26ed, 0x060a3a0f7379da10}},
+        {{0x7e398389f773e8ab, 0x16f66b2cdc861bf6,
+          0xe790a84f0f4896d0, 0xb622b3e7bfc0d884},
+         {0x45b873ed68b5a0db, 0xf1489f00568e591e,
+          0x56c1ccc729ead459, 0x413c29c3a9e27e80}},
+        {{0x34a74e3424d59b3b, 0xaaefcbd5dc8f7797,
+          0x5c1a421b7ee6678e, 0xdb0ff59f0a9009a4},
+         {0xd34b5f90ec8032b4, 0xa18f977731f0fcc3,
+          0xa261f6f3284db8df, 0xa2424c986e792bb2}},
+    },
+    // 16^19 * G
+    {
+        {{0x69d5655ffb74773e, 0x6080c2cb1b650072,
+          0x87eb0a1d7c124c10, 0xb98c157dd0a53741},
+         {0x8236452d2dd5e610, 0x4ff17b1579ac2691,
+          0x6480c758a8d2c252, 0x99e48336bf5a070b}},
+        {{0x0122b6faae718ee3, 0xfbd125de0953c76a,
+          0x228dad14acc8df2b, 0x194624803b6a34d1},
+         {0x101d6700a6dada25, 0xa9d7f08bb2ace072,
+          0xa3890cf028c9e6d3, 0x75441fd9ff0ec046}},
+        {{0xa052f7a3b0467630, 0xb34aec57b3e85c7a,
+          0xd453e9c08e4983ed, 0x59b94f7c747d8153},
+         {0x574b89e34935f9f5, 0x29f53fdb168605ad,
+          0xc687eb4e417b773d, 0x5e136b3d13f2ebd9}},
+        {{0xf441a4d5e7e99abe, 0x613b633ccffebd31,
+          0x38f79232c9225e84, 0x77e71551a8d50c76},
+         {0x4eaaa476adb6dbc9, 0x0c05d4d6e874dfff,
+          0xe90b60842a79f78c, 0xfc2440eae5b044ef}},
+        {{0x0ca7d2dbac33b4dc, 0x2275c7cd66970a62,
+          0x5eeb53b6ed3e1570, 0xd42cea4362b6c1b0},
+         {0x28c35398b6293d0f, 0xe82c76d315f4621f,
+          0x9ba32c86a901b3e0, 0xc4fd1666d4d4a581}},
+        {{0x0bfe00991f7791b2, 0x824319b6ec7118c0,
+          0x5488021a26ff0e91, 0x4b99be59e519662c},
+         {0x5664279861454f0e, 0xe3d52fc5f8964409,
+          0x803474b5cfa269e8, 0x440988329dca4b46}},
+        {{0xa755fa8f67b53abc, 0x3170e3aadd5efe0e,
+          0xbb57ef60bcebfbc1, 0x0ae27966af119f1b},
+         {0x7367d50ee3442fff, 0x5b00d0efbd1428c0,
+          0x368f7f3fa6ef1590, 0xbf7239cc15b0ca61}},
+        {{0x0d8d30149d5489fa, 0x7e6ea0c173075ec5,
+          0x690b57339915c0c5, 0xeb43bd659b1b8d24},
+         {0x0f314caadb8c3a67, 0xf4b15edb0c43866c,
+          0x8a449724da747467, 0x1db819879b6aa0a7}},
+    },
+    // 16^20 * G
+    {
+        {{0xbe0b2578f8023127, 0xa95ccd098a8b68de,
+          0x0dc602351925e578, 0xb2153f53004fca40},
+         {0xb025456b72665f8e, 0xa5327909a0246bee,
+          0xfcfc4ef6f075a443, 0xb013b77bfbf58688}},
+        {{0x0cee8957f3b482cc, 0x3944f9e5f65ccbab,
+          0x3270f90a66c91c05, 0x74116505d1db396f},
+         {0xb862a96db20c1646, 0x35b467d8a3b158f9,
+          0xd41b157b1e52b2cd, 0x638d24c5a774015f}},
+        {{0x7dc23489e31d4659, 0xa9e52e03cb43db1c,
+          0xc0ea0d9fefff5157, 0x39049ef851c0fc54},
+         {0xce36f42f87926762, 0x9592667aba4686f9,
+          0xc10ac0af2e18e003, 0xd8331f211d5b8020}},
+        {{0xffe0dfed77805fff, 0x5fa794be31e71c1a,
+          0xc4aaf9dc9c96d5d3, 0x1d61fad6321904c5},
+         {0x219a652405a93813, 0x7e1fd96e570ba1d3,
+          0x9010f1829c1da550, 0xedc0e2f1b7e78a0f}},
+        {{0x9da2838d27ab3b85, 0x28cb26b3a5619978,
+          0x83856b951c50fc16, 0xfbaefd9066b521a6},
+         {0xea3368d4b120ca34, 0x035416c27a2fd88d,
+          0xc5138982682644b8, 0xfcab1a3b402255f2}},
+        {{0xece9fe9c8ad2d673, 0x415e5d82f6bb7e34,
+          0x60f58fe475890270, 0x45ce114b75167d2b},
+         {0xf8b2d5e0d0aef54b, 0xdd88e616a7f615b2,
+          0x8ae85e4971dcb6de, 0x05bf0c2e6058688f}},
+        {{0x84e0dcd6aeabbaf7, 0x50d114cd7cfd0130,
+          0x08d645a7160841fc, 0x0b3484d484787649},
+         {0x887546e0b36d4cd3, 0x3ea2dcbfe57d6c61,
+          0x5ac69355ccf12537, 0x2c0738718d9ea7e8}},
+        {{0x654b904b38a2f85b, 0x29c45d0695d9900d,
+          0xc735fc201b8c060c, 0x0c1ae127ac2f427b},
+         {0xc8ef4afaed135b93, 0xe67e9e310eb1664f,
+          0x7b37a5ef62585591, 0x749f646a59ea850c}},
+    },
+    // 16^21 * G
+    {
+        {{0xfb5b141a44c39c8e, 0xd655b14e47fefa01,
+          0x13486a950061cf3a, 0x502abd039449df46},
+         {0xc7b8ea6efcafda35, 0x21f47a9b2794ab12,
+          0xcb745d746cd72bf9, 0x7e7e2382eb6d9157}},
+        {{0xd073880dc1f69662, 0xfc612134a33914a9,
+          0xc89c449c188d13e7, 0xa0ba1305ef6c3c44},
+         {0x2aad7b739e20febe, 0x870828aae44e4ed3,
+          0x20de0c62e1f50810, 0x8c3d0f2edb549828}},
+        {{0xf64eaef7ddaa15da, 0x0f51c82117ca284a,
+          0xa5e39406e921b63a, 0xc8d46bc5b0033a00},
+         {0x2776e63581595010, 0xbaf9990bec850f7f,
+          0xb9d9b6ad00d52ffe, 0xc0ee70c21618b2ae}},
+        {{0x3669804a6c6617fe, 0x40accf21880aaabd,
+          0x9b50ee21d60ef870, 0xf515a660e05e7cfc},
+         {0xa8a0f63356fc218a, 0xfa4a50cf38f949ac,
+          0xdf340f723f2dff04, 0xc4de8964f3dbb6ff}},
+        {{0xb5f066a6ce20f6fa, 0x1d3412fc4519386c,
+          0xc7a567a4be777e31, 0xe50763bd6bb8c48a},
+         {0xfc5f123fe9ec4225, 0xe3d4fa836fbc674f,
+          0xbe82bc9b12f046bd, 0x3fa463754540d099}},
+        {{0x71cb19f16bdb6cb9, 0xc4dc2bfd4d3bbc75,
+          0x1e6189714dff7a52, 0x50418b1a4dcfc02e},
+         {0x87c1b9603f450b5c, 0xb98290c2d6b40b2b,
+          0x09c471d193cac03c, 0x237866687b893f24}},
+        {{0x7ea2cea246ce0310, 0x63f33c18e0f2b29a,
+          0xaaa381ca49e533f3, 0x626bfea285f9675f},
+         {0xeb24e2c7dbe236ee, 0x52b928571cbce751,
+          0x5fdec6b66eba8b03, 0xaa502258bdd16591}},
+        {{0x2204dc49bd72b510, 0x7294b18121ff1030,
+          0x562447d234887455, 0x4d950690d755a273},
+         {0x5ae7245c22123177, 0x793b9c068739e6b3,
+          0x3c546f47ac40622e, 0x72834781f22f4e26}},
+    },
+    // 16^22 * G
+    {
+        {{0xc75fed65ee77b584, 0xca523f5334696a94,
+          0xd0aa44b2d1d46db1, 0x34a51ef6a4e00e0f},
+         {0x2d9a298b01dd25ad, 0xb2677993d9612c49,
+          0xdf72f6017cfbea50, 0x3875caa651aee201}},
+        {{0x373614fbaf315be9, 0x652c421b3cfe5b5b,
+          0x6393a17f86c0b714, 0x76b51b91e9f04024},
+         {0x7983229abafa3f5f, 0x8bd01fbc257b708f,
+          0xfbac8e5d738e1e9f, 0xc7e657c40475a25f}},
+        {{0xc77a9c6b624659ce, 0x4cfa45ddc11c66ed,
+          0x6cd2f0abf721fa98, 0xc319d2a105773a00},
+         {0x7b529c2b03780ee8, 0x39d800dc53fcd20a,
+          0x95cbe5b727bb1801, 0x7cf7b69bfd2baff9}},
+        {{0xd8c2b1740daf895d, 0x73d108a66ff59370,
+          0xfd0bfceffc35a5c0, 0xbf3c7a7e72534cb1},
+         {0x87848d09214c9cfc, 0xadf4bb553c07f690,
+          0x5e0ab41c85b373fd, 0x7d70b14681f666da}},
+        {{0xa550a0a2fc87d410, 0x48019c7d5acbf6d3,
+          0xaf32aa39c93622b0, 0xab6589ed59d6edca},
+         {0xe86eedc88727b261, 0xc3cb4218aa9a2ae1,
+          0x57dbb2f52c522a86, 0x4f56615cd3c40d35}},
+        {{0x9bfb8f5a320336dc, 0xe1fbfc73921df07d,
+          0xa9995b8cd8620a99, 0x39b7ce65398fe11a},
+         {0x3272bb2aadc4739d, 0x27f5075b4771092c,
+          0xaf03aedb8380e6e5, 0xa62264c761f85788}},
+        {{0x90ca72ea4e7eb613, 0xa068b04e98bd5c24,
+          0x1779efc7898da088, 0x9e8f97d8408a4fd2},
+         {0xe3b7965ecbd997d0, 0x94bae95406d9755a,
+          0xa536f68ce8d351c2, 0x4484bc1814e695af}},
+        {{0xc2fdd8ed4307832d, 0xf9224c4eca47906f,
+          0x4f27eac0017cbd0d, 0x4541317b21d17bcb},
+         {0x4917023b3ad282d7, 0x22428dedddf12ac2,
+          0xeda22a3ea8a0aacd, 0x26a134d357d24e9b}},
+    },
+    // 16^23 * G
+    {
+        {{0x52e23a0ad0eeba32, 0x25d126e5221d753f,
+          0x8e1ed8f091e24d08, 0x02c62c6dcd9be21d},
+         {0xbca978019532a9c5, 0xaf2fa26481a6c714,
+          0xc9aa988de1b7e65c, 0xf0a62b0d64c72a93}},
+        {{0x78945abfdf286b2a, 0xeb6d71757fa67e5f,
+          0x6375c396202f3505, 0x2580efd26b0950f1},
+         {0x6b00f83cf29e4788, 0x87919d890b14828f,
+          0xea5a49bcc7405444, 0x016c63a02c32843d}},
+        {{0xd3dc474e2b9273e7, 0x61c1874fb1b23abd,
+          0xd5f8a93bf4d5e153, 0xc6bbaacc86060309},
+         {0x8b2695aa0e88984b, 0x7ac50027de72f96f,
+          0x677e0f8c7465f84f, 0x82a918365ae1aff7}},
+        {{0x572866930d221223, 0xf86063c3c4e1ac66,
+          0x300bb0767ed8dac6, 0x316d94219df22d27},
+         {0xf057605d1e931ca3, 0xeb8fc052a44243a9,
+          0x0052ca94258bdee7, 0x641a364a3b41de91}},
+        {{0x7a39f2907a3dcb16, 0x839da77ae47879d3,
+          0x56b02f74e1fc739b, 0xa9383776a82334a6},
+         {0x4d21266657987dd1, 0x29adcc7195fce842,
+          0x14267589595782c6, 0x510e9d3b85e654e6}},
+        {{0x3ae6c701bf34e8b0, 0x0bf3a93422847064,
+          0xe1e0e74c8ea2de26, 0x86c2f8bbfeaac5a4},
+         {0x2a480d20e3bef03c, 0x52cb289d5e46b6dd,
+          0xde8249787fc4e6ce, 0x5efd6cc3efe0e9e4}},
+        {{0xde285cf64e6d130f, 0x167651d4ed016125,
+          0x2ed14ab9844b0dd4, 0x0828637701af3bcc},
+         {0x3452c1a99a1249c4, 0xe2dca2b51988564a,
+          0xc39b0bc45ea96643, 0x9263c877c77a9547}},
+        {{0x08288caff10e80bf, 0x4a8b3c0600eadbeb,
+          0x9b6f29e51c980713, 0x4c18fab47f841d75},
+         {0x2a00bcabff139676, 0xc1b37d3acdcdb20e,
+          0x5793df5594ff5b39, 0x2e7903dd0d803ccd}},
+    },
+    // 16^24 * G
+    {
+        {{0x0f65f52adb12a1ef, 0xd9fc7c9e500a563f,
+          0x0dd2b85686ed4060, 0x9af924bef72c1af9},
+         {0x3fdab0955c6b1f4e, 0xe2efbf13a963708b,
+          0xb54ab5de579f69b4, 0x7db04144323a9634}},
+        {{0x0a3018af436f2a16, 0xd5770b8da078c184,
+          0x1e65799b83cda41e, 0xe3118dff45dc5163},
+         {0xe18d705df3b464b8, 0xf3b38f0a86665941,
+          0xd2472de2cf9f0b18, 0xa30756e323d6f219}},
+        {{0x5a75dcaf2ef3ab9c, 0xe3eb3970c9f8fea2,
+          0x888298f4275ef099, 0x39b5629a3919b926},
+         {0xd1a85310132a7427, 0x67db8173e961db2f,
+          0x21ae8020a5f83d89, 0x65d14eac095ad814}},
+        {{0xeceaf1b70a3259f7, 0xda8fd3b8227c64b6,
+          0x0a3b75b370092b54, 0x9d36569d63730368},
+         {0xf9985c2d63101412, 0x2138ce37bfc61362,
+          0xadd1bc16975e576e, 0x47414e463067353f}},
+        {{0x9e8d5543464bbe95, 0xc99b0f4186c44436,
+          0x73460bd9d3806666, 0x0af5b4800db32b4d},
+         {0xd99f0a3f1fbf96d0, 0x6f2e66dffdac684f,
+          0xf8e795df0d9b9303, 0xecf4204fb6ccf56c}},
+        {{0x5c7969b5ad27043d, 0xc783c146b0820d0c,
+          0x312e489a5db6a8a9, 0xce74dd3ef328cd18},
+         {0x612c839a9634cf4e, 0x34e1d9417d616f90,
+          0xe39c32412d00bbc4, 0xf2f9e6e3593b7803}},
+        {{0xa07c36c55dc2426c, 0x6f3615ed5263a34d,
+          0x1c63d414f7633eb5, 0x4950a79dd19ae4cb},
+         {0x96a299ae672ae1f3, 0xcc6482be5aeace07,
+          0xa3b5b0fc8d1550ad, 0x76e77f688d9feace}},
+        {{0x91ee3f95f718b957, 0x1b48c768c393de8f,
+          0xc5844342f0442712, 0x9bbdb56f09f55c62},
+         {0xacd5821fb04eff9a, 0xd28455a84c3833af,
+          0xe434d5f8fd2accce, 0x17b5475d1f338db2}},
+    },
+    // 16^25 * G
+    {
+        {{0x5e0570b6606235b2, 0xe340c4ae29207af9,
+          0xd527a2c607bdef0d, 0xbb362c3dafdf8bba},
+         {0x7b4fc2a9bd5f0bee, 0x147ce7591a2956b1,
+          0xba7a6b7334124a7d, 0x3c40c279d15a2323}},
+        {{0x3f2f49141cd40e31, 0x90642c13a80c38d0,
+          0xd59b1b55c689dc73, 0x1e39c20628722591},
+         {0x3044180f75b5c993, 0x1c107c2720d89f98,
+          0x132eb88f8aa0f8d4, 0x7514b4d76462c2e0}},
+        {{0x033f132c7ccee136, 0xd7d54ca5101e7655,
+          0xae7ede54697b4bd0, 0x74da46f914b44112},
+         {0x2fc256607e4cbb3a, 0x3672acd242e4cc85,
+          0xa6660e0279c09849, 0x9185150c485fb022}},
+        {{0xdd15e68a45daf470, 0x28b9929d3e223774,
+          0xd1b0fcfeabd465cc, 0x4396df4f311cee67},
+         {0xecb3aff369325ad4, 0x8a90bd15b33b5d1f,
+          0x8fe2c6bce68a4d52, 0xac51e8b48edf3a99}},
+        {{0x0fa5c09e956ce121, 0x833695baa6e78e8b,
+          0xce82270fde600687, 0x6e390c25ad9331c3},
+         {0xb05d89da246a3d4f, 0xae711914838c1eef,
+          0xd8cae58cf1d67085, 0x325a0777fdade743}},
+        {{0x5696e8c7523ef0cf, 0xa4430e1205a39fcc,
+          0x8bcef6a8fa2f40a3, 0x79f892540dda969b},
+         {0xac525965de97dd75, 0x9d0344ccd23737e3,
+          0x1d7b9481cdb0dbab, 0x572e9e094afd6e49}},
+        {{0x5854321e4fa3e53a, 0x2763474348595cfe,
+          0x86ad6ff764ee4cbe, 0xa1ba68170a265250},
+         {0xd2b611926bcae29d, 0x6c25bfd44e251346,
+          0x9c3684cb2e7169ab, 0xd32f1f6e44563d91}},
+        {{0x6368c53afa1ab835, 0xcdbe7bae9c37e6d8,
+          0x712d06cc258387e7, 0xf4fd477a7c975ea7},
+         {0xee2e034badd2c656, 0xf75a9d1b5a77b165,
+          0x78677aec9096a77e, 0x97454f467baa67e3}},
+    },
+    // 16^26 * G
+    {
+        {{0xf1b75df774302334, 0x7a5774f4ddc19852,
+          0x75512520360fd321, 0x535c194b050a14d1},
+         {0x2c3ec10ed2e00af7, 0x56af0fd3fb80ae6e,
+          0x0d232cdcc9ecc58b, 0x613e63848ace3fd8}},
+        {{0x9446ad09cf8508ef, 0x9f3d8f0837e532ea,
+          0x83ac877e0a93983d, 0xfe6d31426bfc58ea},
+         {0x8ce87afbf24093f6, 0x7f9f78281fdb0cee,
+          0xc7cc8678449327e3, 0xc037dc1eed053dec}},
+        {{0x7c9cdfddd1e14785, 0x1734ff74eda6d15c,
+          0xd2598eda4ec17f82, 0xa7b6290e24847d08},
+         {0x20029789888b8374, 0x8ba68bba60793982,
+          0x5f2b4a1f28c7ed7f, 0x6eaca9dfe4788952}},
+        {{0x648a1ff57f556fb4, 0x572b70b9b594c351,
+          0x626ccdb80144de37, 0x1fdcf48dc2535365},
+         {0x27b7119979e3898b, 0xebbd6857df5f36b0,
+          0xfac3bee45d6a2534, 0xdc3afd8d641e93ad}},
+        {{0x6d3ba179f587a2d1, 0xf8271d796751654e,
+          0x45eb84409e7e469d, 0x278da075eda5bbaa},
+         {0xdfe234132f838e96, 0x1b8c3a067d48204d,
+          0xa256ffcbe44a15b5, 0xadf9ca81957539c6}},
+        {{0x16c1b01fc60f3afb, 0xbb27fdd3831def7f,
+          0x9486213acbdd9bde, 0x7476902c02e3d553},
+         {0x753b903efec8f10d, 0x2dd38f3525630cca,
+          0xdae709e3de02aa03, 0x086fe69b8b105ef7}},
+        {{0x775d5a99b815e649, 0x2731a85463d814f8,
+          0xeba3db5762b86a4f, 0xbc4f225f0c54b865},
+         {0x8ab6f7eec121c635, 0x8fd78ae4ff0b7903,
+          0x3b9d5c6ab9664272, 0x80bef78a7a38b38d}},
+        {{0x5397bda4808ebc1f, 0xf9729be33ce8a2f9,
+          0x729dcc0533db00fc, 0x4b78d0dced390630},
+         {0xa136eeef2cf2137f, 0x9c502dd58b4d49cb,
+          0xaf4a7dbfcf029110, 0xdaa35ce16cbe8a02}},
+    },
+    // 16^27 * G
+    {
+        {{0xfa7a7ca447e0830a, 0x10ca4982bf923c8c,
+          0x7f341b264eb89fa7, 0xdad2e00c62580214},
+         {0xf4431edc05dc8064, 0x9cadff5b3572b257,
+          0x4ba505d1846d4e4a, 0x2c352204d3ee3dcb}},
+        {{0xaabac3a01ae81229, 0x090dbd12148e1882,
+          0xa85ecbe331cb7aa0, 0x609b647a128bb31f},
+         {0xbac0683a6630df86, 0x6464115f1b018227,
+          0x3656bcbc355a4889, 0x016544e2bf83cfa9}},
+        {{0x1695386addaf95d7, 0x1c987ab7809ae02f,
+          0x891cf742c451d3e7, 0x86849e365768b696},
+         {0x0696cd51cbbfd204, 0xbb53a371fed897b8,
+          0xe0fe223d8aa620e3, 0x1b5ee8d952a8f25b}},
+        {{0x66f8ab1f49b34898, 0x8abcdb14639542c2,
+          0x2bb1c7d369f1d26f, 0x5f81d57eb38a33df},
+         {0x09ac2fe3b93b7f35, 0x04fb8aa50495e23a,
+          0x1eee24aa827c7e3f, 0x7abea15264764e0f}},
+        {{0xcb0aaa027fb566cb, 0x1a6619850a7ce78f,
+          0x4da4e27ff37c5adf, 0x7681e6730cc939f3},
+         {0xc7f2e4f0c454574e, 0x9de8a32aa8537580,
+          0xe6a9c10210def8ae, 0xae78232c464719e0}},
+        {{0xbb1be472ca60070b, 0xda7cb863e8528806,
+          0x1db15b4c118e6553, 0xa025fdbb65c5d88c},
+         {0xa39d8ef43a386e61, 0x6d3ec0acdfcfdddf,
+          0x2796b244b71d31e6, 0x2573307ccf115f67}},
+        {{0xa11cf832253844a2, 0xdf87f03b693d4fd2,
+          0xb61f06996b0eb704, 0x080a5bd3ac59d2a2},
+         {0x73f596981643cbbe, 0x10a57d7f4b7ba290,
+          0xe4b82c9bd0447972, 0x404dd6842f43f859}},
+        {{0xdc0933f40f154082, 0x827e9dc538f58e69,
+          0x2a0d7f9268dec2a0, 0xd63fb894bd1ad785},
+         {0x98514af51f28a56a, 0x2da1b2527bc9a0dc,
+          0xa9ac1d6954e93581, 0xc88393292baaaa7a}},
+    },
+    // 16^28 * G
+    {
+        {{0xf18e7aed83f43b77, 0x920f9627c2aa04da,
+          0x6cdbef514a82737d, 0xa4c4552e6f73484c},
+         {0xd5746e8131d71064, 0xd3dc3b6a879a4556,
+          0xfe97658c8195822d, 0x029f23dbb5487724}},
+        {{0x930cc9f740cd9210, 0x2503f6ab850d3b04,
+          0xec506ec3a7ae15b3, 0xbbc07d6dea31b3d7},
+         {0x7a3b5c0928537f3a, 0x422e43faf88fc051,
+          0xe3124491719b38fa, 0xceb14c768d876920}},
+        {{0x38d4bbc00e9a20f3, 0x894e9aacfd2e38f0,
+          0x2da01f5ecd9b4b2a, 0x16a3865f318c4485},
+         {0xaf5b433bbfa19d23, 0x25a7b72f4364d1fb,
+          0xc95fb6617560aff9, 0x45f88a2f46c4ad73}},
+        {{0xa6e7de7cbff4117a, 0x76f3b8206a0a77d1,
+          0xc5d05f86c7a61f94, 0x203e53eec43c20e1},
+         {0xa0cfb1f92b3123e3, 0xb9df4a57cd1e0306,
+          0xe16f372a0ecfc4e5, 0x7a4890e1fe4b90f2}},
+        {{0x06215553f63ab511, 0x33aa9936bf0024f2,
+          0xa6976aa3fe9443de, 0xbb3a3f6b9cfd96c8},
+         {0x07685d1a5a01db04, 0x719b19431aff9ee0,
+          0x78b18d3336b9d144, 0xe053504883314c11}},
+        {{0x7ac6f818ab46baa1, 0x1a7e6e33612e7294,
+          0xe75d4bd784f7970a, 0x01f7477d109b6bc8},
+         {0x6eaa6485f4f82041, 0x15bcf8e47253a748,
+          0xbdf0ff850e25199f, 0x7c04d155d38a3a51}},
+        {{0x4d42e7cade493b9e, 0x20d44d8bd50a2e6f,
+          0x776744dda136cacf, 0x7076da71b7c9a92b},
+         {0xabbf894e623f74a4, 0x97a82645198a20d0,
+          0xe7cf94a93afc2cbc, 0x321d0eaeaf78625c}},
+        {{0x087707925c3cc91d, 0x046988d7a90cc9ca,
+          0xeffafc6704b7b23c, 0x40bd30de5442d455},
+         {0x0fb45dd1894fa50f, 0x21d1d9d41d94ffa0,
+          0xe173942e9b86eaa8, 0xce014737fd5c7b97}},
+    },
+    // 16^29 * G
+    {
+        {{0xf39b64b8d7ddf9c6, 0xd45385b45d569f45,
+          0x664a3cc47bee2c10, 0xe8dc0a927a85dcf2},
+         {0xc52cb3b7fb9f2d66, 0xbdbfd7c69b383fd9,
+          0x2e68030445354223, 0xd28024a20f793d28}},
+        {{0xb3b41b05ea3c920c, 0xd89b5c9779d9852f,
+          0x9d28072a5b5e3864, 0x42da1975f844faa6},
+         {0xe79c488fcb8fddba, 0x1f657cd648a7736b,
+          0x886b0cf6f97fb64f, 0x5149b5a476a28a3c}},
+        {{0x2d5227d97ae039d4, 0x568b6907cf8809fe,
+          0x8aad94e4c236afe2, 0x6425f1df73349590},
+         {0x651576fa705c1877, 0xbd33cd65a5863955,
+          0xad74a1422da96aa8, 0xf6b257b859cfe828}},
+        {{0xdb79ed3709e7162c, 0x44616839210d92c6,
+          0x5b031f2263dcb460, 0x3973c3a21f0a91f9},
+         {0xe3a171c34fd105a2, 0x90e8b6d77415e7ba,
+          0x85b1245085cb608f, 0x1c34558c6cef3a42}},
+        {{0x0b3517a5c0818eb0, 0xb2542758494eacb4,
+          0x29e41540cfe65976, 0xef748f19e9e754e0},
+         {0x408c7c005404417d, 0xe9e1e58324a02cfb,
+          0xdf4d2a8c389b9621, 0xb0567d0c5aedafdb}},
+        {{0xa51a11b8209724ed, 0x00a8bff0e207e04e,
+          0x638f380782fa05aa, 0x9b4c5fc6d78566da},
+         {0x0cc03a3846eeca00, 0x9fa888d2fbb8afd2,
+          0xeb5fb433c79f1b26, 0x6d14808f9e129651}},
+        {{0x4094addea105287b, 0x9e6c509d8357e768,
+          0x1aca32cf66b37f54, 0xe9d461b68101b4bb},
+         {0xf7872c9e5c20b957, 0x9c3b467f7c9a4e10,
+          0xff264216a2f3f3b2, 0x543fb55a685cb72e}},
+        {{0xba072db16bfb7d2b, 0x47d37598cd530741,
+          0x436511603c42d1f7, 0x56246f5ddf7ad0f0},
+         {0x8fb015ac61e482bc, 0x0d85d7a7349deadc,
+          0xd1c9cb04dbe87257, 0x7fafce4d991f4753}},
+    },
+    // 16^30 * G
+    {
+        {{0xb37b0a32788ddfa9, 0x195e96ff22de8830,
+          0x6746a7a8e9970a54, 0xf831020432c3b8e3},
+         {0x8f88c4e569d78b56, 0x552d969932e19cb5,
+          0x0992234575856adb, 0x8d8e9c907f98d51e}},
+        {{0xf71b570de7d2dd53, 0x1b3f2bfae66c00b0,
+          0x79966be0e0035164, 0x34973c74f446dc7d},
+         {0xf5d6eb2511f54954, 0xbf2b50ccfa3d438f,
+          0xb2ec85c56c64c70f, 0xf393648b48be0622}},
+        {{0x9d6900342e08da84, 0xf5b19b0f5910338b,
+          0x3fc4466e1fa0bc39, 0xca53dc42f1112f63},
+         {0x92aca6d663a3dc0a, 0x8dcedb909419064c,
+          0xf9fa275d3a91d432, 0x7e0a58c7eaa0d1d8}},
+        {{0xddd3edb4b676803b, 0xdb1c89891f133225,
+          0xd126568de0d8bab5, 0xb5ac5b4fecdc8566},
+         {0x722ff7a08f3d8f23, 0x36c915e9f10be28c,
+          0x2fbb05c2aafa221f, 0x68ff90a1023ccb2a}},
+        {{0x0ad176718b8e24e8, 0xe32d77d002b1cea8,
+          0xe0d299e160bd4d38, 0x1bfba2ba6c91ec2e},
+         {0xc088dd8b70d20a36, 0xfdbf6f481229f50b,
+          0x92c76498be6c6296, 0xe683842b9dc37f91}},
+        {{0x8afc20fc4d476783, 0x9d537b0c4f4a4105,
+          0x2777c5b3d4909288, 0x4c171ecbd86b966d},
+         {0x78434d758aecd3b1, 0x42ff5d513c3c750f,
+          0x694d185fd09948b7, 0xf04ac838f3b49dae}},
+        {{0xd22f6193557c6f06, 0x1e63aab135632c35,
+          0xe29bf3051937f1c0, 0x0b4663637a50026a},
+         {0x366f11b217981c5a, 0xd6ee7b2f519754dc,
+          0x5a97284a307d0e67, 0xa557ad4464b277a0}},
+        {{0x5eb45bc6bd99aa45, 0xa6d3f368897f9d2f,
+          0xb0d510790ef0a6d5, 0x61824a1596060347},
+         {0xca274dc3f4aafaad, 0x18f0d11430c72081,
+          0xc5655c7887c9b89c, 0x1aa6ec7c35cd57c7}},
+    },
+    // 16^31 * G
+    {
+        {{0x3fec6c68362051df, 0xa47f4d3c459344fc,
+          0x2b2dce3d4600aeae, 0xb011fb6752b87527},
+         {0x32935ec3038a287c, 0x3a4d78bdb04b4e6e,
+          0xea091adecf457bd2, 0xc1c5eaf4400262a9}},
+        {{0x2c44142027bd7f11, 0x6a81357ffb60b0c4,
+          0x9aec5c76435c0494, 0x81de8d9b6c5a26e0},
+         {0x4ee94721c0994fd6, 0x0a064d0834a8f772,
+          0xce0a4697d0d19c37, 0x17e69edf17fee1a0}},
+        {{0x8cef90eaaa0712c8, 0x63f22ec88a21e8a1,
+          0xf91ecb5e6d353500, 0x71ca73c87c42683d},
+         {0x75137bac9f32ee95, 0x41ffd6176513060f,
+          0x7262be928ede1944, 0x828d85ece00a0f74}},
+        {{0x607d9ff50d97e720, 0xb2f45187d58ded63,
+          0xc3c9a473cebddda5, 0x158c5ffa9f2a826a},
+         {0xb013c632c9926a4c, 0xb77ff183fd9cdcdf,
+          0x10522cf960f2a870, 0xec9cb27b8b785dd2}},
+        {{0xd2b1abd0725375f2, 0x1fa635f446c867b1,
+          0xb3304871863a1cea, 0xa265d18509b7d3ab},
+         {0x0fa39fb356664e8d, 0x43d06fec9e0f7724,
+          0x1b37713b04fe4f51, 0x50577d0658b84388}},
+        {{0x31acbe45d6454f35, 0x1960fc7c612f9278,
+          0xbc92c2e18787406f, 0xb7a68eefbb7fd664},
+         {0x0310bf1eccd10dad, 0x9cbbaeaa8dcfcd2d,
+          0xf0a24cc778d1cb8f, 0x52d8544bb29ae8dc}},
+        {{0x734b6f6dca73317b, 0x12cb5e5ba4babd91,
+          0xa91030a54a88b5ed, 0x72cc58e9f88e727e},
+         {0x2c7212c27360895a, 0x0d9342f2dc9680f5,
+          0x666f125b8d92b570, 0x7ed1dcb3c8b4cced}},
+        {{0xb61c560c093e7b88, 0x1a071d2c7836b6af,
+          0xefff0cb78744e2ba, 0x64e682411d98c1b4},
+         {0xcd6960eb255b2058, 0x49ab8da44fbea5d6,
+          0x187e10633be9fc79, 0x8a1b1e05608c2ed2}},
+    },
+    // 16^32 * G
+    {
+        {{0x0f9d275d3b9955d0, 0xf1d4a4e11c8821fb,
+          0xa68b3db0772fff7d, 0x44e88d514ad0157e},
+         {0x30215fb5b2cd6a45, 0xbe06c395cc8b83a3,
+          0x65939879278783b8, 0xa2afb709cfdf1c78}},
+        {{0x59e0e25e9f786bba, 0x84ccee5ef569f776,
+          0xdb3cfdd8c65e8e91, 0x6e8356b1204b9083},
+         {0x542586a51d352666, 0x85dffa611efe1b23,
+          0x55cb76cd08e848ae, 0xc0a2e3458cdf60c7}},
+        {{0x03b3ed03d60ac5ee, 0xd7ff1d19774f226b,
+          0xf3023f78974fce02, 0xbc7a21f14d58863a},
+         {0x11f20287afa49904, 0x38eeb5cacb652fc9,
+          0x36f83dba60968927, 0xa277fb42b1f816e3}},
+        {{0x4ded7eea33fa7cc4, 0x46d343384878a57e,
+          0x3886e71d3ca03752, 0x89b88f81fb64fd08},
+         {0x63b59d57d01cfcc7, 0x59b5489f92395b98,
+          0xfac7723385f9b49c, 0xfafc41aa5278f731}},
+        {{0xf15ee76e586fdd0c, 0x0312aad9c3e7e467,
+          0xade1974dc8f701b0, 0x0ed28eb1ed1cd6f5},
+         {0x38294a8eae84c01d, 0xf92455fed18640de,
+          0xbcbb94b2012248dd, 0x1501fcac56144cf7}},
+        {{0x3b5f167b0998809f, 0xc3e839432a2f571d,
+          0x8549ba82e7b0d324, 0x7b06a63a696a7f38},
+         {0xced578da35449b93, 0x4ea9415e3cc159fa,
+          0xc3ddbda557b90f18, 0x24fdf0788700badc}},
+        {{0x2f290b5f6b36ad4f, 0xe6f761905cb095e2,
+          0x293954833b554ff7, 0x8554594099764874},
+         {0xff1214b87450a88f, 0xbc9cb6de59e88b1a,
+          0xa9e067ad8bfdd7a8, 0x78aa457fb28f7d79}},
+        {{0xbca63e99d1b71f70, 0xc32ead3445b80826,
+          0x40cdb35ef22ca374, 0xf3345d52e3eca583},
+         {0xb7ac8953eec9a46e, 0xa53937d5f9e6d29e,
+          0x6f368183e1f8a6fb, 0x9d8c3243806a8abf}},
+    },
+    // 16^33 * G
+    {
+        {{0x8143df731033b53c, 0x68a707c066e26976,
+          0x6137bbb39f632135, 0x3dd0766c53d7671d},
+         {0x5911dd901ae41b8a, 0xf03b9577d36dda61,
+          0x54b05a758124e895, 0xca3d029377ae9102}},
+        {{0x7ebb859b31374f15, 0xa0c99e14ef252dad,
+          0x1e7986cf67ece5e9, 0x5da0ead591977b66},
+         {0xa649c74409327227, 0x872a712d54749258,
+          0x726afe793200c5f4, 0x0e2bb0c1afc17f8c}},
+        {{0x0a7aadacaee278cd, 0x0bd37337e72ce5b4,
+          0x35c08cbd8d21921d, 0x7d701cd28d87ed78},
+         {0xd5c6546c0d2a3e10, 0x37a50ed407beebb1,
+          0x00da46ca081d9414, 0xd36cb2d608750cc1}},
+        {{0x9cd93b4fa7c105f2, 0x3f726d9dda99164a,
+          0xc712c46bbf4a949c, 0xe59e6eacc37256b6},
+         {0x15cd9bb1690f6301, 0x4651e3ee12731855,
+          0x1b89ff18afef0287, 0x828f05f38cf8ef33}},
+        {{0x6d751750a19f5ecc, 0xf746551a2ffb4cd5,
+          0x5575864fdb08923f, 0x3f2f7c398665e82f},
+         {0x65043ac6442974f8, 0x0391f9f5bcb68cad,
+          0xda680e7fba87e2b8, 0x2afd930342e930ba}},
+        {{0x99581231d6a50dfd, 0x04685a7ce0417fb3,
+          0xa008475d208b5fe3, 0x2c4c429b6410c058},
+         {0x79e4fd13310092c3, 0x7427d01f6d1a521e,
+          0x147eccdc3df97d1a, 0x47855f0183dfbd77}},
+        {{0x1152001b9e88441b, 0x30591910c44d3b26,
+          0xcfc94cb496a352e1, 0x2cc7dec2bd6c3797},
+         {0x54a07dc35e2ff1c4, 0x49a8ee2dc85cca42,
+          0x697ef96d7193b71d, 0x9d45f02afe87cd2a}},
+        {{0xe94fe04233a02c72, 0xdae4fcc28fae1141,
+          0xe72a038a3f2e6273, 0x9a1ce36d6a25d515},
+         {0x8153e8a1fd073863, 0xf2211bd25172d501,
+          0xc124656ac53b5a95, 0xc8053ff736f92d75}},
+    },
+    // 16^34 * G
+    {
+        {{0x627d47f0f02f3c7f, 0x90ef4f98de1836bd,
+          0xbc213bc1037ab96c, 0x68a85d1c081136bb},
+         {0x118d9406b2416e55, 0xa141225e9cc314d0,
+          0x789a1ba17b11b196, 0x913dc0847e118e33}},
+        {{0x72b4f8211fc992a2, 0x978e8dffa6b4a84a,
+          0x5675e4b46c376e65, 0xea7ecdd912adfa1c},
+         {0x2716fbfa015c63ca, 0x5cf2d9d8ffc2525d,
+          0x0486116b65982e03, 0xb1efea6ea4391e19}},
+        {{0x0cc5027987732723, 0xb9c6bb3e558feefa,
+          0x1bcc46caff0b193a, 0xcdc0a8c8cbd69b3e},
+         {0x41eed8caea79f2da, 0xe8ace5f3255e53b7,
+          0x395a8fe488ccf86b, 0xd216328b20ed30ef}},
+        {{0x6182edd77bb8f7eb, 0x0c8ff597fd42abaa,
+          0x5a70613f2509587d, 0xf1021c86c3065d12},
+         {0xc2f6f6f1a4400c71, 0xc223cd9bb1534643,
+          0xeb80c17347a2a271, 0x819f5c66085c5509}},
+        {{0xbcc615ec0f9ab359, 0x1aa2882db2c6164b,
+          0xfb149a32f655391c, 0x7ca3089ff65236d5},
+         {0x7c4cfe2716c28f40, 0xf79da06c0fa0b7c2,
+          0x94f42fa6034e0a16, 0x7ab3f95fe38de64b}},
+        {{0xe12cd1411ae39054, 0xfa03dec7ec48169b,
+          0x9a7e5f54ffd4e32f, 0x9fca095195d1e91d},
+         {0x4926b7f3e9d89d35, 0x8482378f78d87706,
+          0x01fbb845037c6654, 0xdf0a2f7c23e2f8e9}},
+        {{0xd78c87b6eb8cbf0a, 0x58159265f83dab15,
+          0x9514e9e33151f64a, 0x1c88c3f00f1b5bb6},
+         {0xdc4aca8597b858c7, 0x10ae8cd30edd4865,
+          0x1936de9d1bc6cc91, 0x00e1ce30e20418f8}},
+        {{0xe389017f4f09f267, 0x486a41c6685428b5,
+          0x41b004a9df51c763, 0xf870a9d5d14d921d},
+         {0xca0b73a41a697050, 0xdc946697782140cd,
+          0x9d1b51dd70307904, 0x6a63bc331d479e44}},
+    },
+    // 16^35 * G
+    {
+        {{0x196be23c6a975d8b, 0x6d7848f8de2aef07,
+          0x880e9c1b88971bdf, 0xa0b61ebf9617507c},
+         {0x7881e1ccb558d193, 0x8e3eb39e27efe5db,
+          0x78bc5008a94fbc74, 0x1a4b3db705b737b4}},
+        {{0x7c5160a69495b5d5, 0xdcacde01f28742c9,
+          0xecb43151c36ab664, 0x0f12d8b71c4951b8},
+         {0x074e467a6cf69608, 0xc1fca494e511db0c,
+          0x9e7f32d75e9d0611, 0xe175a733bfeb842e}},
+        {{0xf131a5b1fa650f2e, 0x3caa49a520da5a45,
+          0x24fed3b9c2438f2b, 0x2cc1dd26da6b04ef},
+         {0x2a127b3bf4e712ba, 0x0b70938a68312cb3,
+          0x6ad2ea017b0fbdee, 0x3acad928be454e4d}},
+        {{0x311570c20073091f, 0x647e3c94424de0f4,
+          0xde2d71b08c1a63a2, 0xdf945b97f86636ed},
+         {0x0baf127b03e3fe9b, 0x92f831226b52aae3,
+          0xd9ee0e78153e74ab, 0x9dc9515440be2c16}},
+        {{0x439ee637ff55ee27, 0x4582af544197b103,
+          0x9eb0314aa4f51df0, 0xc36d22488ea0aff9},
+         {0xced232862fb634db, 0x7e6dc894717de21d,
+          0x26790435bddeaa23, 0x85e9b4c1c60f5f3d}},
+        {{0x682cbf3ccdde20bb, 0xa47c3fba6a732b9c,
+          0xacec43170ce1c418, 0x01918f433590c160},
+         {0x75b33494c9a8e4b8, 0x2eeeb35e768b6247,
+          0x7cd0c3cd4bc33c58, 0x3bcf455ba7072e53}},
+        {{0xa711ef88d5636ab2, 0xffb5a3a829744971,
+          0x771631a07367f41d, 0xbfb67bfa6406b576},
+         {0x131d115927651342, 0xac7e214a46e3f66a,
+          0x0aac82c63eb4550e, 0x8559e605223b5174}},
+        {{0x4edab17198a9bc05, 0x595ab16187f2da64,
+          0x979ec870a2f9ed58, 0x86d5088e821939e4},
+         {0x3ef8e783a7e275ed, 0xd3ee8fa2597b7d0e,
+          0xfa9feacae37c7a09, 0x5c99fe2a1bf492b4}},
+    },
+    // 16^36 * G
+    {
+        {{0x2ea0d0e07801a3c5, 0xc83d3ba418b8af1c,
+          0x60f8e2afd51c0a1d, 0x8316659aab2dcd2c},
+         {0xb17fe8ddad4913ea, 0xfaa00a431ebaf2b4,
+          0xd9b384153f6b097e, 0xc834b7856a966271}},
+        {{0x0e56c67b932f4e0d, 0x5f679c3e13ec96e5,
+          0x4ce06b7e2b0f5e32, 0x0a533bb6fedc75e4},
+         {0xa0dd19b0b380df09, 0xf4929faf3a6ddb00,
+          0x1915c83409f7c1a0, 0x472b336b851c1a2b}},
+        {{0x5b22d4d6bf331b58, 0x06be0082db31aff6,
+          0x045ed6353d46956c, 0xb2d277ea2295f501},
+         {0x782075e70fb9bba2, 0xa9b510b085282daa,
+          0x047c7ccce55149a5, 0xc4c8909dfce1fc7b}},
+        {{0x1b28f46c8d196a53, 0xcbbf4f19cdbd9fe4,
+          0x8f50d741659aec4a, 0x7a3f13c4a1fe4731},
+         {0x8b08f67d9c48ea03, 0xb6b1f23a30bfbbc2,
+          0x506bcd04be1922ca, 0x776a01d887d25258}},
+        {{0x3b849b79b3d4a304, 0xdc5f46bbdac38135,
+          0xad6202bba079ffa2, 0xe64eff16bbf8a18f},
+         {0x62fee364edc489a5, 0x7b03a27ec8dc8966,
+          0x7532af3af2a6bb96, 0xa3ab2011e2367625}},
+        {{0x14a5ff03eb8df1e9, 0x874ca421bb0729d6,
+          0x21056f6e031a01f9, 0x56b6f8f7851b754d},
+         {0x739ec41beb81b5fb, 0x86d5f3687ed84d45,
+          0x3a38b5b3af1f7071, 0xb04778c01ae4348f}},
+        {{0xeadb25c68f9cd24e, 0x3624fcb55d2510f7,
+          0x7b5eb00b73a7f8f9, 0x9c9b025297c891e2},
+         {0x24f93b39ccd9c707, 0x040c35615c2dd795,
+          0xc03216bb232b47cb, 0xb83559bdc1248bdc}},
+        {{0x5e18dec9ea7b5d4c, 0xdf68b68a54824cab,
+          0x95e83fd319b979a4, 0xae23018b47583451},
+         {0x6d542ccee4b1ada0, 0xda343eaaea7dd7f3,
+          0xeb3f361051c6410f, 0x07b1d023c31d99f5}},
+    },
+    // 16^37 * G
+    {
+        {{0x9e286677f15dd582, 0xd38c0a2e76af5d63,
+          0x9a2a033020458bc9, 0xeea134214dec62b8},
+         {0xe3a33849844ebf75, 0xfa8ab7e4293f553e,
+          0x62645cb5251f1165, 0xd4b950a4f5129f90}},
+        {{0x50f96b2981faa9d2, 0x64012727d6f02f65,
+          0x2cd2e3facdb1d3cc, 0xbdfad5a529c0a50e},
+         {0x39985ce152aaf132, 0x5b4af6d8e85b9cef,
+          0x77e7be862cdd9e5c, 0x571f80ae6900c97a}},
+        {{0xf94e72a6013d56f2, 0x773009fbdd7b9d90,
+          0xa91e3a3b4bf59897, 0x6e933bcfe142e1ac},
+         {0xda3d9e96b87e1ab1, 0xe11afcf988f9e836,
+          0x5e6a5f0e0375c534, 0x51e6f8e1b6ffb25d}},
+        {{0xf3282b6ac9740c53, 0x03eacc2d41dbe39f,
+          0xe8b03a5067a8efcd, 0xffbd4db75ae21e0c},
+         {0x54cf603d44d0d734, 0x0f18661e6cb67a47,
+          0x2c0fab457b5ee4a9, 0x6b1e81db39e2058d}},
+        {{0x43829b93c83f6068, 0xbff91371af0dde53,
+          0xa32c2616b855c3b4, 0x02d833da93d815cf},
+         {0x1572834608c13120, 0x7f3066d09585e921,
+          0x75bb92674a82ab0a, 0x9e2a57bda49befd9}},
+        {{0x146c53c684b84724, 0x3a2c632f31e1ed23,
+          0x81b05b752945924b, 0x467d88eef18e1eb1},
+         {0x48b2094135217d7a, 0x44c0d0e6889300e1,
+          0xfe5ac61d6ddf17e2, 0x7463b946bc48c8c1}},
+        {{0x9b34abbc1bf71499, 0x54ad175d396a8d2f,
+          0xd24c5d09c21e26e3, 0xac40d8502459a577},
+         {0xc39c86d9c44333c6, 0xa8611e31fd90ecc9,
+          0x0b0b75b48c4c4c53, 0xe7cb9387e63d2143}},
+        {{0x3a5c3e5ba14022a8, 0x767f663bbd4408d9,
+          0xbb9e99f2e3dd2388, 0xb74aa12bcdd212fc},
+         {0x0fa6c246f1a3e558, 0x3438d0006ab750b0,
+          0x3ecbcddfa8878152, 0xb7cfd45e4a0c9ae0}},
+    },
+    // 16^38 * G
+    {
+        {{0x6fc1807f6cfe66ba, 0x30916eab29707210,
+          0xca1f8047f86680a6, 0xe650ddfb89e17f8e},
+         {0x24d3b7f8b7f54f4b, 0x660582f137aecea1,
+          0xd5fbc8dd1844b7eb, 0x282f82f45c3dc6ba}},
+        {{0xaeb3ade54f815779, 0xd9e995a72017c755,
+          0x55e3665c327b5f6c, 0x744b60ec1388c7bf},
+         {0x121ecdca5044e755, 0xc400e8ef4d345685,
+          0xc82145145f33d488, 0xca13189759d03f59}},
+        {{0x54cb632ea4c7c464, 0x85d2e1139a1d5930,
+          0xa00f9f106c28c7e9, 0xb1589cdbcf5c0853},
+         {0x915b865ee8098217, 0x2f0bc5b4cccc11d2,
+          0x4750d394a41ec418, 0xa973399f58fdf73e}},
+        {{0x501fc8eb25bdaaa0, 0x7c8a5680c87a9bb4,
+          0x853bbeb02f062926, 0xb3c57893b9eeda56},
+         {0x68cd4a7e9bca1c9f, 0x59048816f5cc222c,
+          0x2536745e215d6d0c, 0xe5877a3a1bbb6a21}},
+        {{0x5ed591d9f6eecd8b, 0x4c097a281e41f37b,
+          0x7e265be21a42797d, 0x8e25d3c9d71325a6},
+         {0x40b64461415c693e, 0x7cb31dd96bf67744,
+          0x31fb79264659ecd4, 0xdb2e3702cc9455d9}},
+        {{0x5e774c72a34d501f, 0x71fe9ad757d141a3,
+          0x36504add9ea8ab37, 0x5b2b9fdb40107294},
+         {0x2eb43994d4d62ae5, 0x6f28b3714e6dd33e,
+          0x8b0934312382bfd8, 0x27bede11a1b95fd8}},
+        {{0x6aecc846ab7406cf, 0x52fadb5899fd9d5f,
+          0x187b3be746d9c5f3, 0x79011cc53c1f4a64},
+         {0x055fc1c290e3ad74, 0x8d1fc64508aa819e,
+          0xfd7137ebdfb275a7, 0xad980bf3bf5dd11b}},
+        {{0xadf5f9e66f848fa9, 0xa71c274738cde737,
+          0x4393cae367cb8c57, 0xbd92c017d7b63131},
+         {0xa0a5af5dfb22fe46, 0xb583899cf50a93ba,
+          0x6d0c15bc9faccd59, 0xf6523175538403ee}},
+    },
+    // 16^39 * G
+    {
+        {{0x4ea10dda37685d88, 0xe3230237d731c69c,
+          0x1b763c15b08f5466, 0xaff88e1ae81d1dcc},
+         {0x80727f9ad59ee10e, 0xb4874044fd0a4b08,
+          0x73341f148080c797, 0xd6f8686c0bca447d}},
+        {{0xc120e21c6024b146, 0x6ec12670897c7c4c,
+          0x93d66405cdc3bfd9, 0x11a4bf0951291a43},
+         {0xe03be947c1d3f866, 0xe8fb0d9b0b8e9b95,
+          0x086e8f4381a53ce3, 0x31638c025dbc7df2}},
+        {{0xd35b1e984b309591, 0x42b1807b5ee94c5f,
+          0x83956e4ce0047093, 0x8085ee1554694578},
+         {0x3c90c78881783d8c, 0x8a90901de0237c6f,
+          0x0c99ffffbaff3de1, 0x2137ceaf02fe131e}},
+        {{0x46b86f3e48333fcd, 0xf599454e879bafd4,
+          0xb66f9bbbb1032834, 0x35e2b02ad88eddbb},
+         {0xae5260e67577639f, 0x717980e5c6833313,
+          0x8810257b76486e82, 0x341eabd8e2be33f0}},
+        {{0xf45195a635acc43e, 0x98f0e92a278df575,
+          0xac58e78cf9c913c9, 0x87f366413c2f5603},
+         {0x4cbfca59fdc7ba99, 0x38cea97bb414b408,
+          0x8866af438e9a95c8, 0x002826f26e89f54c}},
+        {{0x49f11dd054e913c5, 0x7ffa161d20a72d19,
+          0x95ffbf1d009c1e3b, 0x4b1b21d7629d0ead},
+         {0x13c8ce43fe044400, 0xbc674bb97a2aa524,
+          0x4b24e77b05ee2f53, 0x932c88e00b0e6b0b}},
+        {{0x247c0c4baedd8467, 0xa5461b8d13cbeddc,
+          0x5534be46769c62a9, 0x233a8a3fe48d8c1f},
+         {0xc36b4212ec479241, 0x05d56e03032c47cc,
+          0x550734e93535933e, 0xd15e49f8d72acafc}},
+        {{0xacd537a1907a0923, 0x5d02cd7db0d1bce9,
+          0x36039ed5e9be2652, 0x87c4e3514fb0ff86},
+         {0x9a081ba8a7751b13, 0x3458a46204f13df9,
+          0x46766072b55e569a, 0x13aff2f4ef1d851d}},
+    },
+    // 16^40 * G
+    {
+        {{0xc75f9df61a89f319, 0x07fdf0458db72e5b,
+          0xc1545deb23496830, 0x803233b474f901c9},
+         {0xb2f97be80384551a, 0x39bc7f2b6b2116a1,
+          0xf7f04c199421e72f, 0x76b396b1eb78bea3}},
+        {{0xb503d27b46a2512e, 0x305bb293ddc1d56c,
+          0xff6e7a8cf18ee2ba, 0xd565ad5853e08dcf},
+         {0x865c7f6a7a3b543f, 0x65ba01fa6c260230,
+          0x48893aaace8ac62f, 0xdf701299d0b136da}},
+        {{0xdbeed2ee54a54506, 0x1cc37b4aed654872,
+          0xcabde41c05725001, 0x07998d888e15ff9d},
+         {0x4a7ee1b54c8ea30f, 0x35b50e88c81206a0,
+          0xc8d752c148d21bb4, 0xe2dd8ebb054153bf}},
+        {{0x1f6ffbf4b9334e9b, 0xf3dd5292b8fab993,
+          0xa009aa6f5e22e2be, 0x98917cac1f4c264d},
+         {0xfe34e303fdbcead8, 0xa9894e9c5df57243,
+          0xe471e05925d35b50, 0x337f6278c1b1805a}},
+        {{0x3fda8bf81a6e9ecb, 0xe8b7627b8c8afeb4,
+          0x4f3738bd352045ab, 0xba146059883837af},
+         {0xcca601548a65c868, 0x98aa1b1c5c236043,
+          0xe86b595e1753be75, 0x17860787df64426a}},
+        {{0x5daf6d7097b49209, 0xdd2d9b9281974bde,
+          0xe91e4a38ab548f82, 0x53c3424251121eee},
+         {0x115fbb265e963f61, 0xe988b4ca0520ca29,
+          0xe16ec5e1254ad17b, 0xa3651c70003b6214}},
+        {{0x5da07c157bb4c52f, 0x1f3c67520970789b,
+          0x18e074bf99d8f959, 0x93c81fa3fccaac3e},
+         {0xf9a197da9503412a, 0x62455a7601155a83,
+          0x9392808b994227b2, 0x1e9928db8301d617}},
+        {{0xaf9463c23e10d4ac, 0x7d476867fd36f051,
+          0xff605874da6dec1b, 0xf767bf939d3f6d97},
+         {0x9996d4bae0a9bcc9, 0xda0189436ca4de3b,
+          0xbc7ed87e251d0394, 0xb50387503bbfd259}},
+    },
+    // 16^41 * G
+    {
+        {{0x79c7aa3c52b47c8f, 0x485a4d3b01ae5805,
+          0x92d92ed45ce8fb12, 0xca30214c59381354},
+         {0x7060e77cb1db1e86, 0x9b3f0cd1e63f4f80,
+          0x72b4780b5f9b5bca, 0x8b3ae0efcd768829}},
+        {{0xcd5ea3b9ba7eecae, 0x5a181aae98fb3e01,
+          0xeef18e17ebae2976, 0x4dfcf8557bde6ebb},
+         {0x3bd9233a67efcb7b, 0xe239f907508636c5,
+          0x55fa5bd0fc7d80d0, 0x7dff3697add84e62}},
+        {{0xce4c98cf764e7cfa, 0xe092319c737681ad,
+          0xcad0dfab076aa02d, 0x9b3fef504aba2cab},
+         {0x0e5be68ec335cc06, 0xe9b4a0be2df69968,
+          0x99a6281d9b6aac31, 0x8ad6fcbf9fbea2d5}},
+        {{0xb9ef2df192216e10, 0x41617a46544c138e,
+          0x3c18dc9e6146ffa7, 0x65971a58a123f0a7},
+         {0x8742256cb7236fbc, 0xb6b01d5d89e7d9fa,
+          0xb89fc499591520f9, 0x8b7e518e868d093a}},
+        {{0x24406c10569acd7e, 0x848f9239a43a1a15,
+          0x0ed7507ab59cb0f7, 0xb1cae5e3db5d2780},
+         {0x8498b35de36b3d8a, 0xa70017acb0e03087,
+          0xa30085ce5dd40f22, 0x9cabbb995e9f036e}},
+        {{0x1059d04edc26e82e, 0x555d746358883851,
+          0x587d2fa7bcc8c9b8, 0xccd249e9a70f9438},
+         {0xecd1410f3f042899, 0xab2197cbd7b60032,
+          0x7a882b686e13fcc8, 0x2b254e906069d3c6}},
+        {{0x3a0a5e80744273a9, 0xb90f0618f8aebce0,
+          0x26097e15719925fd, 0x1dec5b447a3558f4},
+         {0xdf2b0d02fa7716f5, 0x694c2162135ffdfe,
+          0x4c4326d0924109b5, 0x015ed4fbb70e0343}},
+        {{0x0b3b54a2c8de583d, 0xab82996e18eb3ab1,
+          0xb3c54da2ab894b9a, 0x8461043c282f693e},
+         {0x76fdff0a2144fe99, 0xdcd2cf19ee262747,
+          0x7d5d465450aa1526, 0xd51f0acb18a7ec6a}},
+    },
+    // 16^42 * G
+    {
+        {{0x8ef75e07e9bafc5b, 0x3d9a8f7e350ded97,
+          0x80bd9f33be5a617f, 0x9e4bb18739ac3f81},
+         {0x862f676d16d6010f, 0x57e26af2431fad0c,
+          0xa4eabe7751b31194, 0xa3c5ad45e6688201}},
+        {{0x98578a3e0a870b65, 0x4c3c18627bf17a8e,
+          0x91d83ced4c3c451a, 0x53345fce55e87cf3},
+         {0x9fc74ceb07bfc06e, 0x98f43f1963c9c166,
+          0xd0323a57064a11a9, 0x062daf419f9ab838}},
+        {{0x78f3382ec79e075a, 0x513fa60d18a421c7,
+          0xcc3072f29c5819af, 0xd7e13b43fa1bb510},
+         {0x9fcde704fa5a4c87, 0x8abcd0ea1b99a2a3,
+          0x475f27a99bd447bd, 0xd76a8d293e59c3d9}},
+        {{0x816a7516053928d8, 0x7e94f13642ae7264,
+          0x23232c2fce07ce23, 0x01e4a0f24817d6ec},
+         {0x441a9b63cc20ad14, 0xfb48322f0d21ecee,
+          0x3731da85e18282f9, 0xc8b9bce3bebac026}},
+        {{0xaf8cc1eafb40f6eb, 0x6323b09e46da720b,
+          0x88ffe8de1d38f39c, 0xe83c64778130b24a},
+         {0x742c9a22eb2d34f5, 0x1e6d6cedb5a748cc,
+          0xd404e103fd9beb10, 0x2961fe889afe95be}},
+        {{0xeaebea1b715ec3d8, 0x041b6a8f0a12419c,
+          0x62dc7c817c938a34, 0x82487751cdc5fff7},
+         {0xa6b66a49e1af59ec, 0xc3a4bcd39477d26e,
+          0xf1a11d023814db8c, 0x54eee4f868db15d3}},
+        {{0x6bf7ca4cbd1e9747, 0xb1b6ad5443ccc4bc,
+          0xc69f28848da84a61, 0x0091c7f7f9711542},
+         {0xc4e6f225453047f6, 0xc596da1b97c7e3e9,
+          0xfb13d165a8f52b67, 0x196372851a9c488f}},
+        {{0xbc71da828f55569f, 0x994f22aafcfa8eac,
+          0x7898ca3ed125a428, 0x515a1546d0b7b7a6},
+         {0x5a2683b5b69bf491, 0x6ba81619a42a807f,
+          0xc0fd26c3c94d5215, 0x62a45aa718530846}},
+    },
+    // 16^43 * G
+    {
+        {{0xb7ff1e3c63ec25d5, 0x34eb853ddb0e0ecd,
+          0x6abf274e8585f678, 0x1c5631cb042f940f},
+         {0x9316062ed878876e, 0xe33fb504f646f4da,
+          0xbe768e51e8325e17, 0xa149fd9f34669720}},
+        {{0xcca2d240253fc4d8, 0x665bd37c6bbce9fd,
+          0x068259351894ef09, 0xb778698de1e94d49},
+         {0xf7375453d000ae5b, 0xff480ab33cf25ac5,
+          0x7e9c73cd5bd55565, 0x8b94ccdb9e93c4dd}},
+        {{0x9d14350691113dde, 0x96cf601ffaa36cd3,
+          0x5c3e3e3484c9ad57, 0x23bfe8fa40d2a664},
+         {0x6aa979c80b0e3449, 0xd6826281512709f7,
+          0x0b325140dddcf6f8, 0xfe84573c3b96457c}},
+        {{0xc41f39152bc3aae2, 0x647c4281b3e50c95,
+          0xad4c2ad6f96fb010, 0x7226aecf177625fc},
+         {0x37ba555d84607f8c, 0xa03071cbb543a91d,
+          0x3d211ac9053d0710, 0x164fa46a5c2a1d89}},
+        {{0x6ba16f01aab60c4a, 0x6a49482b30fc6d9e,
+          0xdb8b259e2c53529e, 0x8b7c86ff2d84e640},
+         {0xe00db5ab172d799b, 0x757c12d8515f7b43,
+          0xb4cb0db24f670d61, 0xd3d0ce6cdb7851ef}},
+        {{0x901148b82601a0f9, 0xd159b7b51c2f6728,
+          0x5e68fc11cc954a0a, 0x41ae292b39fb7506},
+         {0x22cd6ac6d3f431e6, 0xbffb87b485600b52,
+          0xdccd3777df10ecaf, 0xbf2802da49156937}},
+        {{0xad138ad6ac56a0ec, 0x91c0ff9d3e323ab2,
+          0x1bf49907010cd90e, 0x06c2f2da79984b29},
+         {0x853bbd616f121efb, 0x9de9a724af023e33,
+          0x2d68acbee264e3f7, 0x5bcea7a453567079}},
+        {{0xc04700aa4e52ea93, 0xfabef0f2045fc580,
+          0x5dc7a6697576a121, 0xc9fb39cb4199b106},
+         {0xd32e50b582a264e5, 0x74602584bfb73909,
+          0x302beabc5a6d6668, 0x36a212c71d9d4cb8}},
+    },
+    // 16^44 * G
+    {
+        {{0x1e41e6c6161994bd, 0x826e3e7d3bbe1a5a,
+          0x96eef1a91959a233, 0xda19b770fddbccd2},
+         {0x4ef2d04b043ecc44, 0xfe0a70e2717959f3,
+          0x9cb08894e4d35ace, 0xe7f33491e624edd2}},
+        {{0x30050eab22a925ab, 0x04ca1b18c17fa9c3,
+          0x65cefeab2e78c658, 0xc41fad727438db43},
+         {0x325ed5fdd4e767c2, 0xf8f234322f231c8c,
+          0x4113b363461be3ba, 0xdb7f3ed1f05d9065}},
+        {{0x48f3da8261a84855, 0xaba0fd9e0f833d73,
+          0xb394fc65ca2a4697, 0x6d1396d7235b671b},
+         {0xd0e4f469d30eadfc, 0x7793c845bbba35d9,
+          0x8a1df169e6720c17, 0x61a6ad6c692513d6}},
+        {{0x11a6c189db30b8e4, 0x05c8c37f86e86078,
+          0x49e7b2a2c1d86e41, 0xe2d5caf25b7ec203},
+         {0x9b2d14c86e0bc3f6, 0xbccfc175fb1996c3,
+          0x656d73419146034d, 0x1b52695f4ee15b9e}},
+        {{0xb5f6d463806b9289, 0x3ea598cc3a6b0c34,
+          0x15f45b42584f7281, 0xe1d5c601bc7ae6a1},
+         {0x54e77c12c047baf7, 0x8a28dacd8d094856,
+          0xf97a4708c966a377, 0xab6d968d1194bcb1}},
+        {{0xa1a419c0dd66df72, 0x3d6163e1220d437b,
+          0x66f4ab9648f65b65, 0x7bf2e16624c1b07a},
+         {0xa5f752daf7d59ed7, 0x822a36a7397002b2,
+          0x2217d8ba95a0eef2, 0xc638e2ff112130cf}},
+        {{0xf54e8f53fee7400a, 0xcbf23a535440ecb8,
+          0x671454fee144a499, 0xe4271d4cc2f2417b},
+         {0x9959256a1192e312, 0xb6047a30f136183b,
+          0xdab5ac051401c327, 0x6e6be56ef2165db9}},
+        {{0x129991cc8d50f5e5, 0x8bd33e4c9bb3eb63,
+          0x265d11e855237dc7, 0x1b18a622097c7dd8},
+         {0xa70c971bdc82b2f0, 0x8a327174b46475dd,
+          0xc691c628a02937bf, 0xe0116a1ab25bf0c1}},
+    },
+    // 16^45 * G
+    {
+        {{0x4ce5f7dfbe92a7b3, 0x47b3ae5b73b3343e,
+          0x50f4f84e5b420387, 0x9f0ab1f288310928},
+         {0x74ebb140b12d1d1c, 0x0ae6cedd31ac2cba,
+          0x32723384c21bdd1e, 0x6f96281ad5c6c2ca}},
+        {{0x8abe2721439eb333, 0xa25898fb5ef06c04,
+          0xc0457e1209e8a2b3, 0x42a82291d3db51ae},
+         {0xfa5694d6bb8b6574, 0x96c9d0d7821a7c54,
+          0x6ca9c8709c7307f1, 0xdf986b010b61315b}},
+        {{0x6803bfa3dcd19554, 0x4234c6c0bf57cdb0,
+          0xc945ec0c997d12fe, 0xa17edb0e9c54da30},
+         {0x5cc6ef69fc237636, 0xe62ba95836b02a53,
+          0x4432e65a132e449a, 0xecff6fe025c1d9fc}},
+        {{0x00956ae72414cc1f, 0xddcca61c9269a256,
+          0xb6b0b7a898debc25, 0x8d22f26d6219098c},
+         {0xe6886816155b0f5a, 0x98bf1dcaa6bbf8ab,
+          0xad753cfba7a5125c, 0x2776abcbd035cdd4}},
+        {{0xe810f115a340af20, 0x43bfba7d89260e53,
+          0x0476496ee1e0f019, 0xa348f9d5d2180fd0},
+         {0x0dd877a0aaa7d4ac, 0xd423cc00f2fdff1b,
+          0xe389d8f487fa9ca9, 0xb7632e789b779eeb}},
+        {{0xc0035bff51e4cf6f, 0xe0d8236c65a85cff,
+          0x63c065c989908d00, 0xb0c43bcef6e3d3fa},
+         {0xf341bec461495900, 0x8f433c32addd4456,
+          0x2c72bc13b2438297, 0xd87de714a2792ad3}},
+        {{0xfa966958c2beeeaa, 0x0c86aebb7dca9eab,
+          0xf9fe0d01dec1e2ed, 0x52b056f464a2c031},
+         {0xef9c4fca3265fef6, 0x2b72b0cd399397bb,
+          0xaebab534bdf4f8da, 0xfe2ff212d912b515}},
+        {{0x7ca7b84653dec3c7, 0x687e1823f496bdba,
+          0xc80b3eb2c3dcb9e2, 0xacc353e384225ce8},
+         {0xe05e65dc0d095866, 0xf0e672bbad3cabcb,
+          0xd41d56846418c792, 0xbf3a93c17e054eae}},
+    },
+    // 16^46 * G
+    {
+        {{0x43f65311b9849d3a, 0xcf67262bf1c8ddd6,
+          0xaa685dfc0bd30c3e, 0x6b3e8009982c272e},
+         {0x5f17349c58c77cad, 0xedff544c6bae8b87,
+          0xa4f3c6167756877f, 0x773e0a1e1c1efc86}},
+        {{0xad976b8287b9fb99, 0x3573fd74da3bee6b,
+          0x45918654903689fd, 0xcb9f0686d7972b58},
+         {0x650da92bde558c9b, 0xd1952ba06ec49cc0,
+          0x8c0d5c2035f28ce4, 0x9dcfe8e11ec23e29}},
+        {{0x3cf0e50a7dcf8453, 0x04f6ec5156d291c0,
+          0xa661543cf0f18428, 0xf97d4d621accb2b7},
+         {0xf1761c6be61d301d, 0x596e5601e448c129,
+          0xcb03c52272a0f666, 0xa7e1472725e7a1f3}},
+        {{0x6db16b9f52976cf3, 0xe529ce99619d4735,
+          0xca300a12e78d3b8b, 0x0102c5de950758de},
+         {0xf5c942ad2d07d024, 0x39845b0864391219,
+          0x903010b3a3a15fea, 0xc43a27b3e4a6ee10}},
+        {{0xb1d944fe97c20835, 0x491c326683dcc0a5,
+          0x05844f68ffcbae26, 0xed986ff4df3dddf1},
+         {0xf43354536e99c870, 0x1bdac226504d4bd8,
+          0x83d0daac0c6f81f5, 0x38a38b11e8bc390a}},
+        {{0xe0ea95e93707a48e, 0x92dce89f25b9ce83,
+          0x50f98c4598fddec9, 0xf855c25e9611499c},
+         {0xa2ac4b6e6bc5c7e1, 0x1d785c06eac603dc,
+          0xf1ea511dbcd0f392, 0xe65e53d0a3d9c63b}},
+        {{0x278d5506694b252b, 0xcf1f2fa2a19b908b,
+          0xd7017566593f6309, 0xb59db87a94446be7},
+         {0xefb133555dabd5a1, 0xdb181ec13ad29b54,
+          0x9c922273493660a1, 0x6417e2ddaee2937d}},
+        {{0x8cfefdef55aad0c0, 0x7333fdd0abd08b50,
+          0xf7a4cba66cc6cbbe, 0x33d19dd74b6cab8f},
+         {0xa68ae7fb251a53d9, 0x899359f8cb4027a0,
+          0xebb3b4fa51545d57, 0xaf9911070c22d827}},
+    },
+    // 16^47 * G
+    {
+        {{0xa9ac0ba8cd18f7c7, 0x2f247995f810659f,
+          0x5237e1a8ef7b847f, 0xbb6494b59726b24e},
+         {0x409fe17bd6365612, 0xe6b1746962524003,
+          0x96d999ebfbeae701, 0x1e07052422a68973}},
+        {{0x8804d814bd6f5691, 0x87d7cbf247626e7a,
+          0xa306c2a10cae3517, 0x28db9e3945bd18c1},
+         {0xa5fea55121ef3e76, 0x25be281aab15c554,
+          0x142afa423a800191, 0x3423e674c00648a8}},
+        {{0x1c928fa4c0ddffc6, 0x919ca89dd9d3114e,
+          0xb325bd1ff9b68b1a, 0x3a728dc4b541c336},
+         {0x91106d3900a2090b, 0xb436f896ee24897d,
+          0x875f54e5cc998753, 0x12c516e344100fed}},
+        {{0xb924c20953187aa5, 0xf48b71be71fef056,
+          0x6dbe2bb164d96d4e, 0x39431f9dd6243d76},
+         {0xa16ad31970b0fb54, 0xe0dbfa7e24947691,
+          0x79f5e35026fa488c, 0x1d4bef31cb7bbfc3}},
+        {{0x51eaa60284884068, 0x0f131d01ccbe805a,
+          0xc59453570eaf545d, 0x8a956a593e013664},
+         {0xb988b97eebc31ec2, 0x0c605e1b663721b0,
+          0x61ceedc7fd67f2e0, 0xa492935643185618}},
+        {{0x6b48dad85ce13b46, 0xccf1d742b24cf98c,
+          0xd23cb1e2cb13352a, 0xcf631d5fd6afe639},
+         {0x4efc3e7f3eaff993, 0x6d964ec95b696cba,
+          0xcd83e6d8c084c309, 0x6dd4d00f83222c44}},
+        {{0xe877b9cf36a6cfc8, 0x550b377a0e2c810a,
+          0x6002de3991c3d04c, 0x846fcbfa2cbdac05},
+         {0x53bd87abdaad1910, 0x33b0d12eb2f1e5f3,
+          0x838b0f7b9747569a, 0x9b222ecad49fcc87}},
+        {{0xb578242b66dd92a2, 0x1dc43436f7c1d9cc,
+          0x19de13396209be19, 0x8345aaab0f752c70},
+         {0x321363554bef76eb, 0x14d1bf6f5027b622,
+          0x6e02958c49589ecf, 0xaa815119e8204c6d}},
+    },
+    // 16^48 * G
+    {
+        {{0x9d45c63bf32eb964, 0x6ce89abe40eb2caa,
+          0xba22b299f7897292, 0xa3f1f2c46eb36131},
+         {0x5f6431b213653600, 0x3e890c6787cb87da,
+          0x8c1fdf17e9f9dae6, 0x3a5f0315dde61148}},
+        {{0x6453ec21f0e363fc, 0x32d9097d2f563f00,
+          0xd9138da021c6c3c2, 0x5ede72e9a4af14d8},
+         {0xf28778075f7e0f3a, 0x902a6718a1d8cb76,
+          0x3f5995b00aa1055b, 0xc042ae09bd39ac08}},
+        {{0x875a1a800f385e25, 0xc9af3f656c64cefb,
+          0xf04533d4940d0d3d, 0xf4ba7908ed037857},
+         {0x87c8d282e0a65f64, 0x330d4fce8d36e063,
+          0x63be53d3e7d8a190, 0x21d8b8eda50f4421}},
+        {{0xe4560927384f7eac, 0xbd99f62269c875ff,
+          0x7410097328964fdc, 0x50cbf1258054bcea},
+         {0x353f31b706a058ac, 0xd3b877ff26a946c9,
+          0x498a5c1f5eb0be15, 0x05b58fe0eb747a39}},
+        {{0x4114da9c2ff08571, 0x9e6efc68f77f1ec6,
+          0xc743c435626d49b7, 0x222a8f20d72e683e},
+         {0xf864ad6f986cfcb9, 0x52eeb7d21fbe2e80,
+          0xb337c8e52f6e6e3b, 0xe3b1fae9194b512f}},
+        {{0x8803a02945bd053b, 0x74ac8dbed710ab22,
+          0x85ec80192decdf50, 0x5dbd78f27cfcaff8},
+         {0xe1cf9cfe9cd975f5, 0x877f64f7f3c8cb17,
+          0x7f4a8e85e2af3650, 0xa9f64e73db0df0b4}},
+        {{0xd97a96f108daebe5, 0xd922cf879d8999dd,
+          0x897c7d847936f3f9, 0x27b549ab4e7b7181},
+         {0xed0ee3614e5b0ad7, 0xbdff6d60da8f8e55,
+          0xe956c0944c048c02, 0xd24779a03143822a}},
+        {{0xfd2ee3a75c85a96d, 0xd2522a65500a7de4,
+          0xf8fd6e88302acaab, 0x7650501b5091d4db},
+         {0xed696481bece48fc, 0xed0f758f7c607061,
+          0xa50c5f12777a784e, 0x277930ac644bb580}},
+    },
+    // 16^49 * G
+    {
+        {{0xc3e688615a345feb, 0x947326319e673ee1,
+          0x1ca9e16a919dd1e0, 0x5c5fd6437ee72ece},
+         {0x6cb9289e44132d93, 0x13ce88849e412dd2,
+          0xc591ca98e5575763, 0x54d16b233d95dba6}},
+        {{0x5d14b945cd23150d, 0x4c629bdd7073aca6,
+          0x8b490f102ae90a54, 0x90ac92731b954905},
+         {0x60d66e57cc859916, 0x8efc0c934623ec12,
+          0x7cf43e52ee6446d9, 0x52f0ed703b876c0e}},
+        {{0x8e2f513b408b21aa, 0xc032914949c93f2b,
+          0x3fa20bb801763c25, 0x79a4e37244f03ae8},
+         {0x62c001669e656f07, 0xf60e4ef8d4f7d001,
+          0x53f418362fb833e1, 0xebd0505344306f46}},
+        {{0x7e129f0cbabc0ced, 0xdc3779d2387a00e5,
+          0x565b9104fd877781, 0xbd0a82a0b9b0b6cd},
+         {0x8d3441c17100e5f6, 0xacb6ff06ac644c87,
+          0x3c225d8b53338b8e, 0xceb3d5a18c1af351}},
+        {{0xc1d3bb339a5a0468, 0xc03b516e61982d21,
+          0xa9048cd2b291fef9, 0x980ad516a8804afd},
+         {0x70f6be8cd0e79a72, 0xb6d54735f4732024,
+          0x806a101883e1ab7b, 0x9778043e3990d8c7}},
+        {{0x077699bf93866048, 0x65f55949ff9227d9,
+          0x16fb1b59cfcda703, 0x2e6c84dd21900a7d},
+         {0x64e516ee135d0e83, 0x0b23f59a3468b0c5,
+          0x82c7503f28ab03cf, 0x996c402c16e205fc}},
+        {{0x50df5a9a419e91be, 0xe87107c6de5e495a,
+          0xe97947445d5e19e0, 0x4dafa96a72da213e},
+         {0x0e6e8b4fc3fa8e86, 0x1b8f7cd1b6d77ca7,
+          0xf8d828b3706df6a6, 0xcdf6af0e53d87715}},
+        {{0x6cf10c241a9c897e, 0x0dd8e724916a1205,
+          0xcc7064c5fa0d3140, 0x6c86ed3684dfd5aa},
+         {0x76dce975577c7929, 0x52f906bc5bd6ed9d,
+          0xf3ea668d7c6192a4, 0xe17f070a6029320a}},
+    },
+    // 16^50 * G
+    {
+        {{0xb173531f2f5fdc0d, 0x8e20f42294545d45,
+          0x93670135f89feb01, 0xaf918dc69ab69a17},
+         {0xf51bc727506fefff, 0x422f1da2a4265311,
+          0xe51daab5e7bc3d42, 0xf84e403f18c5efa9}},
+        {{0xd42fcabc0252bb27, 0xd31640b0232d58c7,
+          0x8ed36735d668bec1, 0xda05206ec9ffdbb3},
+         {0x74a5690dc2cc7511, 0xd9f700b79307e6c6,
+          0x4314cbbfddd1f6c5, 0x684e5fe3f6a56335}},
+        {{0x8fabb8b58d74d480, 0x5d5e811fa79780e4,
+          0xab5d60561a913e41, 0x25752259c20fe5f7},
+         {0x90e0ae01cc886df1, 0x6ae21693a9b62a8c,
+          0x8b0916178eb63740, 0xf606d236fa4582e1}},
+        {{0xb8f9172790e060dc, 0x851f6196af6c0a26,
+          0x6d263d0a41f539ad, 0xdce679ec6f4d2c1a},
+         {0x7fc664e2e2b72cc9, 0x615b7e94d3b330cf,
+          0x2b34720a203bea7f, 0xa8b5b403b60243e3}},
+        {{0x7685371112a7274d, 0x5dd7d95c7d831725,
+          0xdbc498e2f83f65da, 0xe323328632c7c02c},
+         {0x9de9f6df663c0e96, 0x1add83b5090a516e,
+          0xa5e6f88227746833, 0x97eb65ef35c40f7e}},
+        {{0x2db9a12ebb9f4c25, 0x009bff073203989b,
+          0xf5d1a8e76515cf07, 0x078b67184158ebce},
+         {0x399b1ca68d9d196b, 0xedb679ec6ba0e82e,
+          0xaf937a447aff2e61, 0xa090a90d76bc5ac9}},
+        {{0xb86cfbfcd8c7aca5, 0xccba70366f3aca13,
+          0x09270e7b773eded2, 0x9c43b38f9a23bc52},
+         {0x3e17e2578521005c, 0xa42903e290627f29,
+          0x507af91ed9399bcc, 0x017720184e4c7b9c}},
+        {{0x73e4881f43948fd9, 0x59a9232030366891,
+          0x4bbabbc84ba4834a, 0x1c497968c82c07ab},
+         {0xd0cd7131071532ef, 0x98cc656baf7707f8,
+          0x215b5613e243b3b6, 0x934a9326e6768fb1}},
+    },
+    // 16^51 * G
+    {
+        {{0xbceffd5c86981a47, 0x73f3fba7fd7b3c8a,
+          0x68e7c94ceb8dbfff, 0xeeb9498c5ef58c7f},
+         {0x6a3030c54682cc17, 0xe489153411fa7606,
+          0xee5f63177f67ec7c, 0xb54667fac1044c1e}},
+        {{0x5a4eac4a4de9a577, 0x90cc24f8f6fe9c02,
+          0x8a0f6f18f8a905cb, 0xbe9e8262e4f1762b},
+         {0x35576bfdecdf087a, 0xba3e03880a6bc78c,
+          0xb4e8192fa17c0a34, 0x4570ba905a880efb}},
+        {{0x83a1d51ae1a62a2a, 0xe87e402c7e853d0b,
+          0xfe9a6035c4e90530, 0x54b5cebc4abefaca},
+         {0x156199491d5169b5, 0xc0f00556d73c1c4a,
+          0x18e43a453cbecf5f, 0xeb01b421166de9cd}},
+        {{0x90dc63e2aaf92685, 0x3e04d9725dbb9cb4,
+          0xce4fc96831e8c6ee, 0x1e97a81aa0c59074},
+         {0xb01552343c304572, 0xebb53fa6f8eb4b73,
+          0x7215aa0e9805090a, 0xda3638f689850a7c}},
+        {{0x19a86a03234e22ae, 0xf68ea83728df8a46,
+          0x084906506963bccf, 0x6456066c7b0290d9},
+         {0xe88db82346499926, 0x89286a637f1dee4b,
+          0xc7c89dc492056fe8, 0xf2199a1559305ba7}},
+        {{0x9abdd2e0ed296c83, 0xfd1b5fb505520143,
+          0x41fdc147081b3399, 0x1857f5435f1513b7},
+         {0x3c8336ed9660f655, 0xfce431ac0f10bfdb,
+          0x0ea84745ca805a94, 0x6b90c9a51028dc9e}},
+        {{0xc2b356691e8dfc9c, 0x6821eccd0c63dd17,
+          0x04ac5aa75d08af0e, 0x205d4f2ff22bb6d8},
+         {0x410f9432150b9f08, 0x030a14aa438ba36c,
+          0x877bdbd322d085c4, 0x73fca18fe57bdbc0}},
+        {{0x4036f60a99436a93, 0xb8345c33d6fc4c47,
+          0xd92e66ad6bf5efa3, 0x93ff4e742f182c67},
+         {0x99ff20f6a2cafa21, 0xd3fd11ac27c3cc55,
+          0x2db290d6495f26f8, 0x6f5230bd7308f762}},
+    },
+    // 16^52 * G
+    {
+        {{0xedaaadeb3b4eabca, 0xb76de7e3c2e27942,
+          0xd90f73232b75c3ec, 0x6b535135b06a598c},
+         {0x734cecd5f2d7d8cd, 0xf12326b5bfe66081,
+          0x34911c450f34c8a5, 0x7951bf638df7353b}},
+        {{0x17c0461e8e8a4752, 0x61b2514bd3bb4e8e,
+          0xffb211a0027b825a, 0x7233b0a2d04f4da7},
+         {0x5a916ae05d790a25, 0x6ae299b066164ce8,
+          0x38d3eb339253f696, 0x367499360c8ff333}},
+        {{0x56aec67d7b6f885e, 0x0297e9bc9cdf6760,
+          0x05cfd2dd710f055e, 0x1c7a571951cee715},
+         {0x7a6db1593df0b3ef, 0x64b1c4f9b19599ad,
+          0xad40d544e0eff64a, 0x222e8bacec90ea28}},
+        {{0xdc325eb780cdc998, 0xeaeb3ea4451072d2,
+          0xfbe4a77a63f4814e, 0xaf7196535cf7300b},
+         {0xa5961c0caf79157b, 0xd6bd64fac1b1eff8,
+          0xd53c7278209c1192, 0xd49a6edf11867896}},
+        {{0x009c08d04ab178f7, 0xcd2fb91260452e7c,
+          0xd6c4a2e06a857014, 0x00da08a2300446d4},
+         {0x267da3453782dcde, 0x0bfa97618a01163d,
+          0x2b5cae32874c63ff, 0xd272ece363f28714}},
+        {{0x5c7a2d5aec53361d, 0x1bf3cb4ebf7ef20c,
+          0x04796bc056f2c73b, 0x8f6a2541f81cf5c4},
+         {0xbf5e88bb42e45f66, 0x7cc17bed95498b23,
+          0xfce87f10ce9ae644, 0xea9eddb50c643b92}},
+        {{0x6be140a00ee83c6d, 0xa9628d8a0cd734be,
+          0xeed633c30fb50b9d, 0x2991c3d2a3e39c2f},
+         {0x2bea88ef0e53351e, 0x81a0b9e78ecb4b51,
+          0x5de33066262b937c, 0x72875741a9ba3577}},
+        {{0x1ba0afe653b69982, 0x457c5a6154894dcc,
+          0xe9c42a0ac615ab9c, 0x22d4f20138499dbf},
+         {0xb1ec2a6d58d094a6, 0x25d12924866be1ba,
+          0x1417e1e6a5513025, 0x46a7be0eab039206}},
+    },
+    // 16^53 * G
+    {
+        {{0xe70ccf9911f87843, 0xaa750516bf750a24,
+          0x7718717c31a6eefb, 0x349467e64f1b3cf2},
+         {0x7e8543cc13e06789, 0x96a8b796a7d9be3c,
+          0x094ce7cf9733549a, 0x1d488ec1fe62445e}},
+        {{0xd0f1da3b48f7b419, 0xe49b74861ab412f4,
+          0x2b86b881b18ada64, 0x83b6cf6d33a6e0cf},
+         {0x3a954c94b21355f1, 0x6fc89f6ce49a6dd9,
+          0xbac706ffc059f9ef, 0x23b21e1bae2685a0}},
+        {{0x3d9da6d921a372f5, 0x6f1ae40b64d7385d,
+          0x7cda6a9208a21016, 0x2f70ed61fba7e2ed},
+         {0x7e00445192f2ed9a, 0x5eabaf90e155958a,
+          0xb2ccd9f27dc71ee2, 0x5b451f60619586ab}},
+        {{0xb23f24e47b8ff683, 0x04c77af98427bfe0,
+          0x478310bc3a5735c6, 0x7779bd08eb1d4e91},
+         {0x549b94f484d65c69, 0x061b9beb214867a7,
+          0xbfdbf8ae6b043b58, 0x43a4a64dcf6e237c}},
+        {{0x040ff0809441342b, 0x2f0905c1edff16ff,
+          0xb58b665b3cc77b3e, 0x332f2daee03f98e8},
+         {0xf6533e4878f9bb87, 0xb4ea475837255bba,
+          0xd8360086e594b600, 0x5b4c0c9c808b7682}},
+        {{0x5eee3ca4f4b0761c, 0x90622c9b49c05683,
+          0x1d767ea57b96cab1, 0x29c2c08fb0283e92},
+         {0x496d62603c2764c5, 0x3d1f37e2c11ee301,
+          0x9b1f652deb3f2c9c, 0xbba690976c171bec}},
+        {{0x93045d9eee5f9472, 0x34b36e9dfd721f98,
+          0x51ea1d879dc0f7ec, 0x6bd8f9770c11edda},
+         {0xfe8c621c94c4b895, 0x0eb93181d53b731e,
+          0x378fa7d410d82811, 0x6e82fdb28e39bcb2}},
+        {{0xe18c97feec5dd4f1, 0xe7db08e9728cdf90,
+          0x49e3bdd1313b1e13, 0x1bd415283339d502},
+         {0x7da926deb1e8de3a, 0x9e0e414d05d4cd42,
+          0x171040895828d725, 0xa81d3b0adcee4df2}},
+    },
+    // 16^54 * G
+    {
+        {{0xb96cf87d3d8f7f76, 0x24e222eb568545e9,
+          0x4ef1b7f743b7b477, 0x950cf5ef7e760cdc},
+         {0x712b377a77589cae, 0x574113a96c0055fd,
+          0xb5f5aae063eec85a, 0x7dcabe71879e8025}},
+        {{0x44c0d48453e5b6ee, 0x6bb8f04b30b7b45e,
+          0x1e86f74d28e9ea10, 0xc3c4b5c334d18744},
+         {0xbf544b3b21b9b77d, 0x2fc9c9243d1fe201,
+          0xf579e7ec06f9e225, 0xb315d26f594d6567}},
+        {{0x9317122245430c83, 0x5b4a5f2acb721733,
+          0x972be7c19e8331a4, 0x5d8d8c491c907b76},
+         {0xf955e3fd3044ac6f, 0x76d4416b7cbc51d0,
+          0x84e7aa3e25925da1, 0x433332c09664131b}},
+        {{0x58eff1160bd15805, 0x68297f87875e499f,
+          0xd35eae635ea5a87b, 0x0a971eba12c4e5ab},
+         {0x42881be9e74578d6, 0xebc94b224f2f393b,
+          0x2c050b87970992eb, 0x8d161987d76aeab3}},
+        {{0x3bfa418b0aeef189, 0x9f6e61f76d827a91,
+          0xe845258a17d815da, 0x86185a478f922c5b},
+         {0x7ad8d7b15b3466c5, 0xd249bc4b999c8380,
+          0x81cb0c5edba2c922, 0x8cc4ac4242d870ec}},
+        {{0xf70303cdf5aa086b, 0xd08a96b9eace7f47,
+          0xc2d80ba5a3d9fbe8, 0x92ae00b4dd0d65ab},
+         {0x47343b4e92720eb7, 0x7d02d6cbb11bb102,
+          0x108463dfdff8e215, 0x337ed8ee34932c5e}},
+        {{0x04244873d5a1af63, 0xfbb26c61edc20d5e,
+          0xda370b0eaa8c09a8, 0x2ba84cf24c9fc539},
+         {0x686b19a7866aba73, 0x6d2f5b97457e7fde,
+          0x11bbab786b1a1324, 0x1048ba5a85bfb04d}},
+        {{0x9019c6cc38c91c7b, 0x53a4b37ea8b7191b,
+          0x32def0137cda3696, 0xff7560d80b1b1951},
+         {0xda8812672fca0e94, 0x4fa496b7f3de6f3a,
+          0x55d3bb737df69264, 0x13a3375cac528da8}},
+    },
+    // 16^55 * G
+    {
+        {{0xfdba1119362c4aee, 0x9475450fd149e823,
+          0x0308651061e240df, 0xac4c0d91b2797e52},
+         {0x07a9f04e94e2e738, 0xc9f2500993dfaa57,
+          0xe28d8a1e631bf262, 0x3a5e0c8db6c3c6a3}},
+        {{0x995172ec89e9fd58, 0xdcaadeb5d4b6b6bc,
+          0x194b5bbc58f8274e, 0x27bc618bdd36196f},
+         {0x2bf616d091f96509, 0x042750f110369df1,
+          0x2deb4dd4cc6235cb, 0x2827be701a87b1ec}},
+        {{0x1f89310dbad34d69, 0x90164c592d46c9a7,
+          0x9da649c290bea726, 0xf9e3c93f712b3c99},
+         {0x567997209595fcbd, 0x9df889af7ff73c8a,
+          0xb84ab58821d4b858, 0xc4d8d79275f8d5ed}},
+        {{0xf307596774d0d696, 0x4b5d7ec5f93bccb7,
+          0xaffebff2c634df50, 0xf5f106769e4de7ec},
+         {0x0d7283b839e65a52, 0x7cdeb6b7340b7891,
+          0xc0f088fd430f523a, 0x230d7f4ce56c557e}},
+        {{0x9eec2896172273dd, 0xd9884cba970c1d17,
+          0xe5c167dc18301645, 0xe5dda586530e5772},
+         {0xdeeaf7092dd0f27b, 0xc601f20a41dfb251,
+          0x5f480c1d42217e9b, 0x0d75797db337bfb1}},
+        {{0xbd1f51166037a8ad, 0xd9fc3a2ab87116ab,
+          0xa8453cffe7d895a1, 0x16cfa41cfddb9459},
+         {0x0ec95efeb58e8ada, 0x75ada3cbc5babbea,
+          0xf5b7d0f700c666ea, 0x76ae31649f7d801b}},
+        {{0xacb8abcaab76ef88, 0x34ab9ab60d715487,
+          0x75d466b09fad30d7, 0x626eb0d470d43609},
+         {0x5e7f91f7ca4f4152, 0x0cd7bf19180b857b,
+          0x1f02dd96888784e5, 0xd814b697179f78da}},
+        {{0x7121a1bcf9e1028c, 0xc73d0d0f7d0d8fb9,
+          0xced27f1438308151, 0xc3a91403e806a5e9},
+         {0x61f97d94591e02d5, 0x560bdc675660a6ac,
+          0x48e5d2d78daa09b3, 0x11a532856d060cfd}},
+    },
+    // 16^56 * G
+    {
+        {{0x62def7ed6d8c664c, 0xa18cdcd5d7c445c6,
+          0xafef1fffeb247a53, 0xf18532d4a7bcaff3},
+         {0x9d6b98be8228f8b6, 0xa6d78326df5bae09,
+          0x2a14242f2df3ef7d, 0xf8e6318f7c9186ec}},
+        {{0x24e7be564195ea3b, 0xc83ca2fbe9004927,
+          0x1f714602fe22b55d, 0x46a812c11300d585},
+         {0x6d1c150949a4326f, 0x809cd7eb0ed826f8,
+          0xd7bfc2088af9df29, 0xa2de76ad255a91bd}},
+        {{0x0f8239b316fd9964, 0xf665d70cf2610a4c,
+          0x171cbd7297d2ea7e, 0x73b4471861abaab8},
+         {0x7cf5112759fe8da0, 0x0f4f41e5b07df47e,
+          0xffa8f0274a372433, 0xd81f30a627f74cbd}},
+        {{0xeead2ca76c1f0a26, 0x2e01d56c13682a88,
+          0xc8a80826a462087b, 0xfc58f34328cba4b2},
+         {0x8dd7c9f6f29a3c5e, 0x850dbfa79ad618d8,
+          0xf50863c39b6b61a2, 0x002a661a7d05ee45}},
+        {{0x14010c4e27d3b8be, 0xedbeaaf5e3a443f4,
+          0x490345b0b8292acb, 0xc7e668d325ba42a7},
+         {0xc19660d1e0537626, 0xd66fd1cd18fae412,
+          0x9fcd223a6da0faff, 0xd7ce345098936cec}},
+        {{0xf034f9aea560c149, 0xe5890a29989c20eb,
+          0x458f2ae45b53f4cd, 0xef29ced5ee3acab9},
+         {0x76ccef1d3b955c96, 0x962e7cc3b56b6ec7,
+          0x875d647d07d6bce5, 0x8c23b3bf74c21890}},
+        {{0xcedb11ede03cb9d5, 0x47738de304764b76,
+          0x6f7ce6e850bb6ded, 0x5e608149f8ed3511},
+         {0x356e84cdb59509fa, 0x5bf4f3164380a777,
+          0xc01ee4584b247fc2, 0x78f1f2bb21904864}},
+        {{0x1238b582d5f746f5, 0xc57efeb9cb88cc2b,
+          0xf68eca6d745003a1, 0x07a970b0bfc8f384},
+         {0x0bee944d22cc2470, 0x3443464d8b1f2c1c,
+          0x4994b3e813feac55, 0x4b765986f3956a55}},
+    },
+    // 16^57 * G
+    {
+        {{0x5110960e0c373dd5, 0x473288436a66bc95,
+          0xfacc5c9636fe8309, 0x9aa4ac3fd8f96a7c},
+         {0x25f9d0eb667a4056, 0x8682792202dc4791,
+          0x439c22a22fd413a8, 0x7a042220fdd26609}},
+        {{0x5eb13209141575ff, 0xbddd09757eb9e721,
+          0x65663fa76831b938, 0xd4b7c42755f6cb48},
+         {0x4b49a85d96d2060f, 0x3ed79c3ada925c2e,
+          0x1d4451f68e82d785, 0x6d98f3a7ba6a5e46}},
+        {{0x7ea7f2679ceb342d, 0xb0aeba904f7050c2,
+          0x1975255c36a48ee4, 0x51e8f00afb0cbbcb},
+         {0x4db8c88372cd1726, 0xb7cefa6e21884b56,
+          0xb3d992165a8b51e6, 0xe8874be817432c34}},
+        {{0x31997616b4d7985c, 0x179ce767ec57c2a4,
+          0x5f0cf0323f526d15, 0x264738dedb4bfa47},
+         {0x25f639cd9f8ded60, 0xdf159b4bb5d53ef3,
+          0x03d62f07af518a12, 0x6555dc2e31b4f561}},
+        {{0xbcf70c6180f8cec9, 0x5a1cb8ee7fdbc85c,
+          0x63b4e05baf124288, 0xe1194240d8dae0df},
+         {0xb5a18a21addbe46c, 0xe90fbfffa40cad66,
+          0xa66ec75c3e5ed63e, 0x95190b6733bc24ec}},
+        {{0x4b2926c235e9bdea, 0x93765a1566ea67d6,
+          0xbecb7f0ddb1e8b45, 0x92da4ab9fe438cd3},
+         {0x3b26a5850e616cb6, 0xb839d504412b5c02,
+          0x913335d8b0a1106a, 0x24281c27ba76ccd2}},
+        {{0xcde4440c6698fed0, 0xdf0621e5ef201bad,
+          0xc2c8fde2bcdf274d, 0x62b01cbd1aaa4904},
+         {0x900ade529c61e404, 0xc8ccc9968a3c2467,
+          0xbc42abda7d124d52, 0x544a1e20a4daa07c}},
+        {{0xd2e9b318d21a8cc9, 0xdd1451322ca3021c,
+          0x50809c23662a1d49, 0xd2d88e2edb9a43a7},
+         {0xfcb9c78dd8f5ae76, 0x43c24579cc9eaa64,
+          0x0ec952544c77b841, 0x81bf40c79fd1a16b}},
+    },
+    // 16^58 * G
+    {
+        {{0x003f5ad086deb025, 0x2679509ec67cd0e7,
+          0xf5ea14340bf55abe, 0x2b008316e55ab6f7},
+         {0xf024a0faf74f6d2d, 0x6a6aee85bc0354d2,
+          0x9585855763655ba8, 0x4a498fa22e5ae080}},
+        {{0x50a1938b6c5ad1de, 0x582af3d3bbbcfbb2,
+          0x52d4caa6616dc98c, 0x0358ee8f6436993f},
+         {0x1726fb3fa8a225da, 0x19963274ba153234,
+          0x2faa07b27dd63a79, 0xfa61479103af0155}},
+        {{0xb64cc68f38d649c9, 0xba386af2eb0b32b3,
+          0x46203d6bc7e04a43, 0xe7119d35ac933a18},
+         {0xb49945b82d8e2319, 0x50803fb2ebc198c1,
+          0xbba9b72254e1965f, 0xef99e5556a2f6ce3}},
+        {{0x1b67ab9fa76e0551, 0x9cd8980380103930,
+          0xa44ada9e1e3f0b7d, 0xd8b9e12dab068051},
+         {0x4b173f876c9b9264, 0xf690324aed83fccc,
+          0xbcf11c37cbf26ab6, 0x756e686cbb5a5124}},
+        {{0x6e7438ad72201d51, 0x21575ff72f9c5f1e,
+          0xa79e730de9e69ca5, 0x8c4b76ef181dc1e6},
+         {0xee49b48136fd5dcd, 0xe2b0abbf9b98a9e7,
+          0x158bf19f56d73e2f, 0x57f48600171dbdaf}},
+        {{0x52be199a4c06054c, 0xfb672e766bc131fe,
+          0x18456f9875727a3d, 0x582bb4310b54e514},
+         {0x423b2d26342db765, 0xb9f61c88410dd3af,
+          0x982ed8e5591372c6, 0x164d3dcfa254d7de}},
+        {{0xd002c66947aaf362, 0x2c617eeabe3d6cf1,
+          0xc675e4722696c156, 0x30a327a9300de521},
+         {0x4c302013b2c1271f, 0x1e33aefc9f200a8d,
+          0x96b0439d570430d1, 0x81f0a2a7a3b38fda}},
+        {{0xc733bd99649297e4, 0x05838cadabce43a2,
+          0xfa436f8ce4e80fe3, 0xb96752300d5f0144},
+         {0x2e032b531623b566, 0xeaa63a6b474d46f4,
+          0x5fb45d1d5d26c59d, 0x42bb533dc33009a6}},
+    },
+    // 16^59 * G
+    {
+        {{0xc282d4de2ae9a2d2, 0x29f78296ac52c9e0,
+          0x7f0d2cb23df2f4c6, 0x980a7fcf41039d16},
+         {0x4db1b8c45b06b724, 0xe320e3fe1a1b85bc,
+          0xcc8d9f847360d0d3, 0x007988f09f48ed5a}},
+        {{0xfc5b776fbdc5ad71, 0x65542b91985eb32a,
+          0xcacf2e0c0572e1ce, 0xd22452adc36bab49},
+         {0x26cd44db4fe83e32, 0xf3e0468c310d6ee6,
+          0xc3bd373ceeff57dd, 0xfd62daae90b4bba6}},
+        {{0x6d7e41987ebba3af, 0x31b82b57b9594c53,
+          0x202472e5f7e90a67, 0xbae47c177ecd9d60},
+         {0x8b00deb97afa5a52, 0x33cf329fb7baa490,
+          0xc238e1aa5eab4c84, 0x30e7aa2e47f854e8}},
+        {{0xf864e88b532a6ea6, 0xfee47ad73b673480,
+          0xb04a05b54df42da4, 0x37b535107da26163},
+         {0x012aa5dcbdd06aef, 0x70a2fa71142e67ae,
+          0x3600dc14ea7ddb62, 0x014f4f019a751d6c}},
+        {{0xebaa0c848f2803fb, 0x037062a411063d6b,
+          0xac6f4632067b1edb, 0x5405ce0b8c4780f5},
+         {0xed5b2284b5aee22c, 0x5779e1a903e5ce17,
+          0x19ab0c2421ae0f74, 0xc0fd201ee6fdf6a8}},
+        {{0x3917737f2522c787, 0x7ae68169cd5a286d,
+          0xe113a3484734b0ff, 0xf5515a258e2a7e2c},
+         {0x1ca9c156adcc3054, 0x824e49f002e3142e,
+          0x5701bb3bec044d6d, 0x69cca7f0a2800195}},
+        {{0x5606a38c967e1348, 0x9fd57b0c6120b33a,
+          0x985ccf77e070661b, 0x79192e40c9d1cd73},
+         {0x363b83865950129f, 0x7ebff26d86776532,
+          0x862fd966f85915d1, 0x3184a214e27e9295}},
+        {{0xc1dbd304adb5844f, 0xe262b782f6d15bb7,
+          0xa0f75234f56a39fd, 0x21f4b899d1952cd7},
+         {0xa39cc4e795bb73ec, 0xf970466be5531d05,
+          0x54bcd9baac6f43ce, 0xdb6a18bbc9d0eaf8}},
+    },
+    // 16^60 * G
+    {
+        {{0x2d63d36358a8aecc, 0x393a5462676a1840,
+          0xa2f08a934368ae8f, 0x36c2bb30a611c3dd},
+         {0x701f8653e44f6d6a, 0x846ec4780fa19833,
+          0x54ab2b7e1921b4a8, 0x92d19021a6b88446}},
+        {{0xb97f1163dd09da64, 0x22a4e399855f07e6,
+          0x4810731cf028904a, 0xf5d6732748a80513},
+         {0xec9ac3e0f139875e, 0x92011af04d56af2f,
+          0x6db7c2d15e3b93de, 0x30763ea7455bebe0}},
+        {{0x5551b17cdbc895f4, 0x7f5ecb2f8a21f081,
+          0x520715fae2b4f569, 0xc7051b37f7dcd9d2},
+         {0x76181b8827c8e319, 0xfb6baad8e4fc1a12,
+          0x8f81106c61cfce76, 0xa021837d35008866}},
+        {{0x65a09e59c4f8fcf1, 0xffbd761d272ecd9c,
+          0x6a5115a1452e0fc2, 0xf069fcc756818b68},
+         {0xd59b3e61899fe72d, 0x0435d4fe3a361043,
+          0xdc258d16e6ef01a6, 0x2630d853c6e9e195}},
+        {{0x1cdf62df302513da, 0x64605506e4dc1668,
+          0xdee53189972be654, 0x1519d30a948afbf7},
+         {0x5b6cb34a423acbe9, 0xcbd96d42495866f3,
+          0x8af8c97eb27a8c3f, 0xf4b8706502405022}},
+        {{0x96106aaacb98810e, 0x40ba6754f5e4b4b3,
+          0x5c711b3ee92ec5a1, 0xb78ce790441a876e},
+         {0x1f0544b6a49c603d, 0x3715dcecf545894f,
+          0x243454e354ba6c95, 0x2342ae4f54895e73}},
+        {{0x31e248108e0376ec, 0x3abd9b67e5d7a816,
+          0xa7fc938a5e189d01, 0xeee2e9f62fe13886},
+         {0x9d96c9e34bc5b96c, 0x11b750f4a5b490d2,
+          0x63366b8b3b718de7, 0x3b2921b67b2b7291}},
+        {{0x5e6469a5a87b66ce, 0x75a2f4b1946d2536,
+          0x71ef918327b5e5a1, 0xc2f01d4629e52df0},
+         {0x0f28729f19f3e19f, 0xa5e2d300058097f7,
+          0xfefc21c624c2a91f, 0xe57907eb62ea2c7f}},
+    },
+    // 16^61 * G
+    {
+        {{0x14a623434d63744a, 0xee299d67ea69d91c,
+          0x173ca9800a87b7b8, 0x4fd8d4ee4e3c52e9},
+         {0x3f63f285cb5e964d, 0xf84535bd33c29892,
+          0x871517ad9796c762, 0xeac1b195d1906b6a}},
+        {{0x25682ef122e6d938, 0x930697aacdaf0c39,
+          0xfab5a955cee93bc7, 0x0c6c00c2a20132b1},
+         {0x9eec6ca49b7cf9cf, 0x4a111c6231ce8ad6,
+          0xe04520c3a987713e, 0x8d0700f390518566}},
+        {{0x76244513acdb1996, 0x28534c94f854401a,
+          0xe607908c0de6deb8, 0x518180d7947515fb},
+         {0xef95a29375d618ff, 0x76133680ea691683,
+          0xf7d9db72228f229f, 0x4571f5c2c21652b9}},
+        {{0x41c22ed6792ce794, 0xdc1a8163e2df1d86,
+          0xc8dfe2a5effd19e7, 0xd1852be6cd7f0d80},
+         {0xa1d23f5449f4005b, 0xb5a8237a4c6b2d55,
+          0xd5e6c50632d62eff, 0x661f40955be6c80e}},
+        {{0xe381ef40d205c729, 0x84951bc4e1d5ea8a,
+          0x5fc6a8f17adae535, 0xf110ff498d5f9698},
+         {0xc0d8c71097809982, 0x6e79c46c14a30d86,
+          0x030dbff4d10250d1, 0xddbc7a97db917c3a}},
+        {{0x48fe1bcbcab64f0a, 0xdcfca529ada33f60,
+          0x232f18b884ff9455, 0xc095688e5d06a595},
+         {0x186b93778b935daf, 0x0fee16e44e0b7932,
+          0x8827fdd64d5e5305, 0xaf507d126288a7cb}},
+        {{0x6a24e08102283142, 0x14f6d967c4f2d47d,
+          0xe8c2518f9a0e70bc, 0x03a2b4206c062aac},
+         {0xe57579e4f6978ba1, 0xdd58e46ef1aae477,
+          0x78dd32ccfdbceb6a, 0x380235dcdb4279d2}},
+        {{0x2a5f69e9f47de484, 0x7aba671efbb82355,
+          0x3c06b9436f252895, 0xa6c3e44fa0cd8361},
+         {0xc6f187be73fff468, 0x0b11ad5682f838d0,
+          0x75e9f54eadcfaeb8, 0x654296a00a4a149d}},
+    },
+    // 16^62 * G
+    {
+        {{0x337059fc9c2d5cfc, 0xe3544a1ef5d4355d,
+          0xf137ac1878ac2a02, 0xdf585ddee8cbe756},
+         {0xbd1cf0bffb7d309c, 0x52af123d6110ef25,
+          0x2bc7ddc6a603c7a0, 0x515411d502f740ca}},
+        {{0xcc9237949b4306d6, 0x6f09b405b6570363,
+          0x52cc6c39f0f61a26, 0x2b5537c9b8e4b1a6},
+         {0x20c368bccc3d02f1, 0x77717d8f13658089,
+          0x9e9fae855878301b, 0x5af0fcfbe1e19026}},
+        {{0x331f8e671eed0ac1, 0x3aa82b930a3ae515,
+          0xd35f3448b60277d6, 0x16c4f000f7caaa28},
+         {0x93c754e13a9ac023, 0x291d518230543f9f,
+          0x7bf2bc2d7842c791, 0xa76c303441224319}},
+        {{0xa5ce7fe8f441ac64, 0xce4b9a6ff8cbe95b,
+          0x1a2bd334b4cf46a4, 0x125ea7171204ca96},
+         {0x4b514210251c6124, 0x60bc1ca40639deb7,
+          0x716c7eb1d4951a8a, 0xf052592f46c9f47a}},
+        {{0xbf40d0a04b2ee342, 0x3ad10b433444890b,
+          0x8c121e4445f9d798, 0xacc46a050500fe8e},
+         {0xe4d0a241be33f5b8, 0xdea400e9ac35dd20,
+          0x10f7698c587d8930, 0xc332c0a12a7bed84}},
+        {{0x6d713a08734323f3, 0xfc73ff28593efbc0,
+          0xae2a6b564d774a67, 0x3dd5bdf896682f80},
+         {0x698fb54321bd018b, 0x64e57462a6527853,
+          0x6e06421960f4399d, 0x4cc6c512d11d2a9f}},
+        {{0x70c1ab626da23d4f, 0x59b0ecd7fecdf2e8,
+          0xe648e7cc26d72b4f, 0x390c880a9ac57eaf},
+         {0x2b264f03a3320960, 0xe08a1b3cb4bc6ed3,
+          0x6c4f448c5f74a2d9, 0x512ba20c02a5d6df}},
+        {{0xfbb2e41682e814fd, 0x6ffeb2aca380f2ec,
+          0xa8a674c2e61dfa89, 0x18ec5df2808e4168},
+         {0x180fe9f2f26b9ade, 0x981de86cb8222fe2,
+          0x38393ffb008395c5, 0xc79260276af46d92}},
+    },
+    // 16^63 * G
+    {
+        {{0xdf617ce3e9babde8, 0x6991275be3abb00d,
+          0x2dac072dd6bba665, 0x1add23397e19efda},
+         {0x7219993721f58b27, 0x9e4ec35e49552723,
+          0xa91d33635c4f8e12, 0x04190e2cb733468e}},
+        {{0xd73c1384675ce6d9, 0x8e4b2cc114885193,
+          0xf37f3a36cf8d48c2, 0x442c90ddcb9979bd},
+         {0xa2287ab00b286749, 0x26e48da7765ffe2b,
+          0x76b296fde82ed040, 0xfda3336af807aab9}},
+        {{0x01eae63744045c30, 0x7bdfec375439aa4a,
+          0x1b01503ed1cf4fb6, 0x83cc4aa31a5d2286},
+         {0x107653f1e5ca2320, 0xd0fbf683ca8f71ec,
+          0xf033315afb588b56, 0x7099c199d412ab93}},
+        {{0x8e3f45354392a7d1, 0xd44a38a7262757f6,
+          0xe7e34de04ac50c17, 0xe3ea52f14e4bc0b3},
+         {0x3d0a8a548cac974f, 0xdcf1b089238cb42c,
+          0x34b7f17cd2bc7851, 0xe9085ab6f117a3c5}},
+        {{0xe563669dbcb24585, 0x838ec0b8d378e8bc,
+          0x0a621868f4781453, 0xfc88da2a21ca7890},
+         {0xe6b0e6c731781b8b, 0x8ef44a5641f9cbb3,
+          0xc1f1f5548f49b992, 0xe194c930a07ea702}},
+        {{0x3eed7556f5290f0c, 0x86196f2faedd3748,
+          0xfa01beca698a1d1d, 0xa6571d2b56e44533},
+         {0x36224aac73505201, 0xcb2871405c2388c6,
+          0x2a173c5fee50c656, 0xc7f071d72e008dc4}},
+        {{0x0388d7f65d673b40, 0xe27359e970261ca1,
+          0xe824439e04484dbe, 0xd21998355bad7a6f},
+         {0x69d07609e6352079, 0x104a00b9dfb14a4e,
+          0x78f9f1fde6d4e000, 0xbaa5f28a188d7b77}},
+        {{0x2bcf5baeaaf86fd0, 0x68f2776f6d23b3b0,
+          0xeb4ca6bc43bfaf72, 0x51f540a6aecddc61},
+         {0xafbedc2b926b683a, 0x6fa1b2db83105534,
+          0x3fa241d7d1f855a4, 0x6fc22ed7802414cc}},
+    },
+    // 16^64 * G
+    {
+        {{0xab16dfa164afd22e, 0x06f7c22691decd76,
+          0xf75a16505bccf2ac, 0x2b02930bf115a732},
+         {0xd44d58aea3be8b68, 0x4a4baf0bd4c46a7f,
+          0x75de6aac24d967b7, 0x49ca5f208a027f8a}},
+        {{0x7a15ca9caf93525e, 0xa4c275c74baeb655,
+          0x66cc56704fb6a3d5, 0x00e475d4c7715ec7},
+         {0x762e1416eb1ee413, 0x37d71458529669b3,
+          0xbd21887633bc086a, 0x30fb48d0fffb762b}},
+        {{0x7cc74171bd61026e, 0xfca1c17b66478b41,
+          0x20360187775c1a86, 0x3f7016a597f2aae4},
+         {0x27f3dbee1f202b1f, 0x39bd5c200d959d45,
+          0x1cb20f12ed81b019, 0x210837c600f58a22}},
+        {{0x68f04f9c8ac43533, 0x8c25092bdc71601f,
+          0x6159b02950f6a62f, 0x74f1e62e2642d8ba},
+         {0x141b486f0114b537, 0x6276903845370c40,
+          0x6135b74f21052eda, 0x5e3949a711962c1e}},
+        {{0xa2da649b6dd02956, 0x3486aec593af548c,
+          0x637c591e9b67b5e9, 0x71cfdcf90c38b410},
+         {0x1190ff59e138f6f0, 0x409af49246781f59,
+          0x342032309d87eed6, 0x336e71f1976a7f94}},
+        {{0x0ff60310c72a33da, 0x09e11d8135179a1d,
+          0x559e46c8ff7f7d43, 0x00fdac1de14e65e1},
+         {0xc15b26b131c47074, 0x7d34cfbcd0880892,
+          0x1207282680dd1242, 0xcecbf6f8b9b35c5f}},
+        {{0xfeec1d1f893068df, 0x727d24e071f0f59c,
+          0x4b75d66705dfd344, 0xa3f31aa81671178b},
+         {0x5f971d19e9d3e03f, 0x400ac9337f15fe61,
+          0xa1127883de08d59d, 0x222e827e59f6e758}},
+        {{0xc215a5a5bbecbfa0, 0x46d8aacaa7dafd51,
+          0xd04b708d2896d043, 0x9395cf109140b160},
+         {0xfcbea159151c4d40, 0x4961c01c8c9b7cbf,
+          0x8b215d383cc12793, 0x9261e83c6c7ccad1}},
+    },
+};
+
+} // namespace detail
+} // namespace crypto
+} // namespace dtvm
@@ -2,16 +2,31 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include "abi_struct.hpp"
+#include "fixed.hpp"
 #include "hostio.hpp"
 #include "math.hpp"
+#include "packed.hpp"
+#include "packed_encoding.hpp"
 #include "storage_slot.hpp"
 #include "types.hpp"
 #include "utils.hpp"
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <string>
+#include <utility>
 
 /// https://docs.soliditylang.org/en/latest/internals/layout_in_storage.html
 
+// Opt in with -DDTVM_SOLIDITY_STRING_MAP_KEYS=1 to hash string keys of a
+// StorageMap unpadded, the slots solidity gives mapping(string => ...). By
+// default a string key is zero padded to a multiple of 32 bytes first, the
+// layout contracts deployed with this SDK already use.
+#ifndef DTVM_SOLIDITY_STRING_MAP_KEYS
+#define DTVM_SOLIDITY_STRING_MAP_KEYS 0
+#endif
+
 namespace dtvm {
 
 // Read and decode bytes or string from a storage slot
@@ -36,13 +51,24 @@ void encode_and_store_bytes_or_string_in_storage_slot(
 template <typename T> T read_storage_value(const StorageSlot &slot);
 
 template <> __uint128_t read_storage_value(const StorageSlot &slot) {
-  const auto &bytes = hostio::read_storage(slot.get_slot());
-  return uint256(bytes).to_uint128();
+  return hostio::read_storage_word(slot.get_key()).to_uint128();
 }
 
 template <> uint256 read_storage_value(const StorageSlot &slot) {
-  const auto &bytes = hostio::read_storage(slot.get_slot());
-  return uint256(bytes);
+  return hostio::read_storage_word(slot.get_key());
+}
+
+template <> int256 read_storage_value(const StorageSlot &slot) {
+  return int256::from_bits(hostio::read_storage_word(slot.get_key()));
+}
+
+template <> ufixed18 read_storage_value(const StorageSlot &slot) {
+  return ufixed18::from_raw(hostio::read_storage_word(slot.get_key()));
+}
+
+template <> sfixed18 read_storage_value(const StorageSlot &slot) {
+  return sfixed18::from_raw(
+      int256::from_bits(hostio::read_storage_word(slot.get_key())));
 }
 
 template <> std::string read_storage_value(const StorageSlot &slot) {
@@ -61,12 +87,12 @@ template <> dtvm::Bytes read_storage_value(const StorageSlot &slot) {
 }
 
 template <> Address read_storage_value(const StorageSlot &slot) {
-  const auto &bytes = hostio::read_storage(slot.get_slot());
+  const auto &bytes = hostio::read_storage(slot.get_key());
   return Address(bytes);
 }
 
 template <> bool read_storage_value(const StorageSlot &slot) {
-  const auto &bytes = hostio::read_storage(slot.get_slot());
+  const auto &bytes = hostio::read_storage(slot.get_key());
   return bytes[slot.get_offset()] != 0;
 }
 
@@ -75,7 +101,7 @@ template <> bool read_storage_value(const StorageSlot &slot) {
 
 template <typename T, size_t int_bytes_count>
 T read_storage_int_value(const StorageSlot &slot) {
-  const auto &bytes = hostio::read_storage(slot.get_slot());
+  const auto &bytes = hostio::read_storage(slot.get_key());
   // read big endian
   T value = 0;
   for (size_t i = 0; i < int_bytes_count; ++i) {
@@ -104,12 +130,27 @@ void write_storage_value(const StorageSlot &slot, const T &value);
 
 template <>
 void write_storage_value(const StorageSlot &slot, const __uint128_t &value) {
-  hostio::write_storage(slot.get_slot(), uint256(value).bytes());
+  hostio::write_storage_word(slot.get_key(), uint256(value));
 }
 
 template <>
 void write_storage_value(const StorageSlot &slot, const uint256 &value) {
-  hostio::write_storage(slot.get_slot(), value.bytes());
+  hostio::write_storage_word(slot.get_key(), value);
+}
+
+template <>
+void write_storage_value(const StorageSlot &slot, const int256 &value) {
+  hostio::write_storage_word(slot.get_key(), value.to_bits());
+}
+
+template <>
+void write_storage_value(const StorageSlot &slot, const ufixed18 &value) {
+  hostio::write_storage_word(slot.get_key(), value.to_raw());
+}
+
+template <>
+void write_storage_value(const StorageSlot &slot, const sfixed18 &value) {
+  hostio::write_storage_word(slot.get_key(), value.to_raw().to_bits());
 }
 
 template <>
@@ -137,21 +178,21 @@ void write_storage_value(const StorageSlot &slot,
 template <>
 void write_storage_value(const StorageSlot &slot, const bool &value) {
   // read slot old value first
-  bytes32 bytes = hostio::read_storage(slot.get_slot());
+  bytes32 bytes = hostio::read_storage(slot.get_key());
   bytes[slot.get_offset()] = value ? 1 : 0;
-  hostio::write_storage(slot.get_slot(), bytes);
+  hostio::write_storage(slot.get_key(), bytes);
 }
 
 template <typename T, size_t int_bytes_count>
 void write_storage_int_value(const StorageSlot &slot, const T &value) {
   // write big endian
   // read slot old value first
-  bytes32 bs = hostio::read_storage(slot.get_slot());
+  bytes32 bs = hostio::read_storage(slot.get_key());
   for (size_t i = 0; i < int_bytes_count; ++i) {
     bs[slot.get_offset() + i] =
         static_cast<uint8_t>(value >> (8 * (int_bytes_count - i - 1)));
   }
-  hostio::write_storage(slot.get_slot(), bs);
+  hostio::write_storage(slot.get_key(), bs);
 }
 
 #define DECLARE_INT_WRITE_STORAGE_VALUE_FUNC(IntType, int_bytes_count)         \
@@ -169,6 +210,268 @@ DECLARE_INT_WRITE_STORAGE_VALUE_FUNC(int32_t, 4)
 DECLARE_INT_WRITE_STORAGE_VALUE_FUNC(uint64_t, 8)
 DECLARE_INT_WRITE_STORAGE_VALUE_FUNC(int64_t, 8)
 
+// Structs declared with DTVM_ABI_STRUCT, laid out like solidity structs:
+// the members fill slots in order, each value type in the lowest bytes still
+// free in the current slot when it fits there and in a new slot otherwise.
+// Strings, bytes, fixed point numbers and nested structs take whole slots
+// of their own, and the struct always starts and ends on a slot boundary.
+//
+//   StorageStruct<Order> order(StorageSlot(4, 0));
+//   order.set(Order{maker, amount, expiry});
+//   uint64_t expiry = order.get<&Order::expiry>();
+//
+// The layout is computed at compile time. get() and set() of the whole
+// struct load or store each slot once, the members of a slot are extracted
+// from or packed into that word by BitFields.
+
+namespace detail {
+
+// A member of PACKED_SIZE bytes shares slots with its neighbours, one of
+// PACKED_SIZE 0 takes SLOTS whole slots
+template <typename T, typename Enable = void> struct StorageField;
+
+template <typename T> struct StoragePackedField {
+  static constexpr size_t PACKED_SIZE = (PackedValue<T>::BITS + 7) / 8;
+  static constexpr size_t SLOTS = 0;
+  // bool is a single bit in its byte, any other value fills its bytes
+  using bit_field = BitField<0, PackedValue<T>::BITS, T>;
+};
+
+template <size_t Slots> struct StorageWholeSlots {
+  static constexpr size_t PACKED_SIZE = 0;
+  static constexpr size_t SLOTS = Slots;
+};
+
+template <typename T>
+struct StorageField<T, std::enable_if_t<is_packed_integer_v<T>>>
+    : StoragePackedField<T> {};
+
+template <> struct StorageField<uint256> : StoragePackedField<uint256> {};
+
+template <> struct StorageField<int256> : StoragePackedField<int256> {};
+
+template <> struct StorageField<Address> : StoragePackedField<Address> {};
+
+template <size_t N>
+struct StorageField<std::array<uint8_t, N>,
+                    std::enable_if_t<N >= 1 && N <= 32>>
+    : StoragePackedField<std::array<uint8_t, N>> {};
+
+template <> struct StorageField<ufixed18> : StorageWholeSlots<1> {};
+
+template <> struct StorageField<sfixed18> : StorageWholeSlots<1> {};
+
+template <> struct StorageField<std::string> : StorageWholeSlots<1> {};
+
+template <> struct StorageField<Bytes> : StorageWholeSlots<1> {};
+
+template <>
+struct StorageField<std::vector<uint8_t>> : StorageWholeSlots<1> {};
+
+// slot counted from the first slot of the struct, offset in bytes from the
+// least significant end of that slot
+struct StorageFieldPlace {
+  size_t slot;
+  size_t offset;
+};
+
+template <size_t N> struct StorageLayout {
+  std::array<StorageFieldPlace, N> places;
+  size_t slots;
+
+  constexpr bool first_in_slot(size_t i) const {
+    return places[i].offset == 0;
+  }
+  constexpr bool last_in_slot(size_t i) const {
+    return i + 1 == N || places[i + 1].slot != places[i].slot;
+  }
+};
+
+template <typename... Ts>
+constexpr StorageLayout<sizeof...(Ts)> storage_layout() {
+  constexpr size_t packed_sizes[] = {StorageField<Ts>::PACKED_SIZE...};
+  constexpr size_t whole_slots[] = {StorageField<Ts>::SLOTS...};
+  StorageLayout<sizeof...(Ts)> layout{};
+  size_t slot = 0;
+  size_t used = 0;
+  for (size_t i = 0; i < sizeof...(Ts); i++) {
+    if (packed_sizes[i] != 0) {
+      if (used + packed_sizes[i] > 32) {
+        slot++;
+        used = 0;
+      }
+      layout.places[i] = StorageFieldPlace{slot, used};
+      used += packed_sizes[i];
+    } else {
+      if (used != 0) {
+        slot++;
+        used = 0;
+      }
+      layout.places[i] = StorageFieldPlace{slot, 0};
+      slot += whole_slots[i];
+    }
+  }
+  layout.slots = slot + (used != 0 ? 1 : 0);
+  return layout;
+}
+
+template <typename T, typename Fields> struct StorageStructLayout;
+
+template <typename T, auto... Members>
+struct StorageStructLayout<T, AbiStructFields<Members...>> {
+  static constexpr StorageLayout<sizeof...(Members)> LAYOUT =
+      storage_layout<member_value_t<Members>...>();
+};
+
+template <typename T>
+struct StorageField<T, std::enable_if_t<is_abi_struct_v<T>>>
+    : StorageWholeSlots<
+          StorageStructLayout<T, abi_struct_fields_t<T>>::LAYOUT.slots> {};
+
+} // namespace detail
+
+template <typename T, typename Fields = abi_struct_fields_t<T>>
+class StorageStruct;
+
+template <typename T, auto... Members>
+class StorageStruct<T, AbiStructFields<Members...>> {
+  static constexpr auto LAYOUT =
+      detail::StorageStructLayout<T, AbiStructFields<Members...>>::LAYOUT;
+
+public:
+  // slots the struct takes, starting at the slot it is constructed with
+  static constexpr size_t SLOTS = LAYOUT.slots;
+
+  inline StorageStruct(const StorageSlot &slot) : slot_(slot) {}
+
+  T get() const {
+    T result{};
+    get_members(result, std::make_index_sequence<sizeof...(Members)>());
+    return result;
+  }
+
+  void set(const T &value) const {
+    set_members(value, std::make_index_sequence<sizeof...(Members)>());
+  }
+
+  // One member, e.g. get<&Order::expiry>()
+  template <auto Member> member_value_t<Member> get() const {
+    constexpr size_t index = index_of<Member>();
+    using V = member_value_t<Member>;
+    if constexpr (is_packed<V>()) {
+      return bit_field<index, V>::get(hostio::read_storage(key_of(index)));
+    } else {
+      return read_storage_value<V>(slot_of(index));
+    }
+  }
+
+  // One member, keeping the others that share its slot
+  template <auto Member>
+  void set(const member_value_t<Member> &value) const {
+    constexpr size_t index = index_of<Member>();
+    using V = member_value_t<Member>;
+    if constexpr (is_packed<V>()) {
+      const bytes32 &key = key_of(index);
+      bytes32 word = hostio::read_storage(key);
+      bit_field<index, V>::set(word, value);
+      hostio::write_storage(key, word);
+    } else {
+      write_storage_value<V>(slot_of(index), value);
+    }
+  }
+
+private:
+  template <typename V> static constexpr bool is_packed() {
+    return detail::StorageField<V>::PACKED_SIZE != 0;
+  }
+
+  template <size_t Index, typename V>
+  using bit_field = BitField<8 * LAYOUT.places[Index].offset,
+                             detail::PackedValue<V>::BITS, V>;
+
+  template <auto Member> static constexpr size_t index_of() {
+    constexpr size_t index = member_index<Member, Members...>();
+    static_assert(index < sizeof...(Members),
+                  "not a member listed in DTVM_ABI_STRUCT");
+    return index;
+  }
+
+  StorageSlot slot_of(size_t index) const {
+    return StorageSlot(slot_.get_slot() + uint256(LAYOUT.places[index].slot),
+                       0);
+  }
+
+  bytes32 key_of(size_t index) const {
+    if (LAYOUT.places[index].slot == 0) {
+      return slot_.get_key();
+    }
+    return slot_of(index).get_key();
+  }
+
+  template <size_t... Indexes>
+  void get_members(T &result, std::index_sequence<Indexes...>) const {
+    // the word of the slot the packed members are currently read from
+    bytes32 word{};
+    (get_member<Indexes, Members>(result, word), ...);
+  }
+
+  template <size_t Index, auto Member>
+  void get_member(T &result, bytes32 &word) const {
+    using V = member_value_t<Member>;
+    if constexpr (is_packed<V>()) {
+      if constexpr (LAYOUT.first_in_slot(Index)) {
+        word = hostio::read_storage(key_of(Index));
+      }
+      result.*Member = bit_field<Index, V>::get(word);
+    } else {
+      result.*Member = read_storage_value<V>(slot_of(Index));
+    }
+  }
+
+  template <size_t... Indexes>
+  void set_members(const T &value, std::index_sequence<Indexes...>) const {
+    bytes32 word{};
+    (set_member<Indexes, Members>(value, word), ...);
+  }
+
+  // The struct owns its slots, so a slot is built from zero and stored once
+  // its last member is in, with no read of the old value
+  template <size_t Index, auto Member>
+  void set_member(const T &value, bytes32 &word) const {
+    using V = member_value_t<Member>;
+    if constexpr (is_packed<V>()) {
+      if constexpr (LAYOUT.first_in_slot(Index)) {
+        word = bytes32{};
+      }
+      bit_field<Index, V>::set(word, value.*Member);
+      if constexpr (LAYOUT.last_in_slot(Index)) {
+        hostio::write_storage(key_of(Index), word);
+      }
+    } else {
+      write_storage_value<V>(slot_of(Index), value.*Member);
+    }
+  }
+
+  StorageSlot slot_;
+};
+
+// The types without a specialization above are structs, which makes
+// StorageValue, StorageMap values and nested structs work for them too
+template <typename T> T read_storage_value(const StorageSlot &slot) {
+  static_assert(is_abi_struct_v<T>, "read_storage_value of an unsupported "
+                                    "type, declare structs with "
+                                    "DTVM_ABI_STRUCT");
+  return StorageStruct<T>(slot).get();
+}
+
+template <typename T>
+void write_storage_value(const StorageSlot &slot, const T &value) {
+  static_assert(is_abi_struct_v<T>, "write_storage_value of an unsupported "
+                                    "type, declare structs with "
+                                    "DTVM_ABI_STRUCT");
+  StorageStruct<T>(slot).set(value);
+}
+
 template <typename V> class StorageValue {
 public:
   inline StorageValue(const StorageSlot &slot) { slot_ = slot; }
@@ -192,36 +495,74 @@ bytes32 to_map_key_slot(const StorageSlot &map_slot, const K &key);
 
 template <>
 bytes32 to_map_key_slot(const StorageSlot &map_slot, const Address &key) {
-  bytes32 bs = key.to_bytes32();
-  std::vector<uint8_t> key_merger;
-  key_merger.insert(key_merger.end(), bs.begin(), bs.end());
-  // concat map slot
-  const auto &map_slot_bytes = map_slot.get_slot().bytes();
-  key_merger.insert(key_merger.end(), map_slot_bytes.begin(),
-                    map_slot_bytes.end());
-  return hostio::keccak256(key_merger);
+  return keccak256_packed(key.to_bytes32(), map_slot.get_key());
 }
 
+template <>
+bytes32 to_map_key_slot(const StorageSlot &map_slot, const uint256 &key) {
+  return keccak256_packed(key, map_slot.get_key());
+}
+
+template <>
+bytes32 to_map_key_slot(const StorageSlot &map_slot, const bytes32 &key) {
+  return keccak256_packed(key, map_slot.get_key());
+}
+
+namespace detail {
+
+constexpr bool SOLIDITY_STRING_MAP_KEYS = DTVM_SOLIDITY_STRING_MAP_KEYS;
+
+// keccak256(k zero padded to a multiple of 32 bytes . p), the slot of a
+// string key by default. Keys up to 224 bytes are laid out on the stack.
+inline bytes32 padded_string_map_key_slot(const StorageSlot &map_slot,
+                                          const std::string &key) {
+  const size_t padded_size = (key.size() + 31) / 32 * 32;
+  uint8_t stack_buffer[256];
+  std::vector<uint8_t> heap_buffer;
+  uint8_t *buffer = stack_buffer;
+  if (padded_size + 32 > sizeof(stack_buffer)) {
+    heap_buffer.resize(padded_size + 32);
+    buffer = heap_buffer.data();
+  }
+  if (!key.empty()) {
+    memcpy(buffer, key.data(), key.size());
+  }
+  memset(buffer + key.size(), 0, padded_size - key.size());
+  const auto &map_slot_bytes = map_slot.get_key();
+  memcpy(buffer + padded_size, map_slot_bytes.data(), 32);
+  return hostio::keccak256(buffer, padded_size + 32);
+}
+
+// keccak256(k . p), the slot solidity gives a string key
+inline bytes32 solidity_string_map_key_slot(const StorageSlot &map_slot,
+                                            const std::string &key) {
+  return keccak256_packed(key, map_slot.get_key());
+}
+
+} // namespace detail
+
 template <>
 bytes32 to_map_key_slot(const StorageSlot &map_slot, const std::string &key) {
-  // string key to unpadded data
-  std::vector<uint8_t> unpadded_key = unpadded_string(key);
-  std::vector<uint8_t> key_merger = unpadded_key;
-  // concat map slot
-  const auto &map_slot_bytes = map_slot.get_slot().bytes();
-  key_merger.insert(key_merger.end(), map_slot_bytes.begin(),
-                    map_slot_bytes.end());
-  return hostio::keccak256(key_merger);
+  if constexpr (detail::SOLIDITY_STRING_MAP_KEYS) {
+    return detail::solidity_string_map_key_slot(map_slot, key);
+  } else {
+    return detail::padded_string_map_key_slot(map_slot, key);
+  }
+}
+
+template <>
+bytes32 to_map_key_slot(const StorageSlot &map_slot, const Bytes &key) {
+  return keccak256_packed(key, map_slot.get_key());
 }
 
-// TODO: more base types and bytes and string key of to_map_key_slot
+// TODO: more base types of to_map_key_slot
 
 template <typename V> class StorageArray {
 public:
   inline StorageArray(const StorageSlot &slot) {
     slot_ = slot;
     const auto &body_slot_begin_bytes =
-        hostio::read_storage(slot_.get_slot().bytes());
+        hostio::read_storage(slot_.get_key());
     ;
     body_slot_begin_ = uint256(body_slot_begin_bytes);
   }
@@ -316,7 +657,7 @@ public:
 private:
   StorageSlot get_slot_of_key(const K &key) const {
     bytes32 key_slot_bytes = to_map_key_slot(slot_, key);
-    return StorageSlot(uint256(key_slot_bytes), 0);
+    return StorageSlot(key_slot_bytes, 0);
   }
 
 private:
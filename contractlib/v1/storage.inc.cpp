@@ -4,11 +4,12 @@
 #include "hostio.hpp"
 #include "storage_slot.hpp"
 #include <cstring>
+#include <stdexcept>
 
 namespace dtvm {
 
 std::vector<uint8_t> decode_bytes_or_string_from_slot(const StorageSlot &slot) {
-  const auto &cur_slot_bytes = hostio::read_storage(slot.get_slot());
+  const auto &cur_slot_bytes = hostio::read_storage(slot.get_key());
   // Find the right non-zero byte in cur_slot_bytes (if any). If it's odd, the
   // length of the bytes to decode
   bool longer_than_31_bytes = false;
@@ -74,12 +75,12 @@ void encode_and_store_bytes_or_string_in_storage_slot(
     if (length < 31) {
       memset(encoded.data() + length + 1, 0x0, 31 - length);
     }
-    hostio::write_storage(slot.get_slot(), encoded);
+    hostio::write_storage(slot.get_key(), encoded);
     return;
   }
   // length > 31
   bytes32 length_bytes = uint256(length * 2 + 1).bytes();
-  hostio::write_storage(slot.get_slot(), length_bytes);
+  hostio::write_storage(slot.get_key(), length_bytes);
   const auto &content_begin_slot =
       uint256(hostio::keccak256(slot.to_bytes32()));
   for (size_t i = 0; i < length / 32; i++) {
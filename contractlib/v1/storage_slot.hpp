@@ -9,25 +9,26 @@
 namespace dtvm {
 class StorageSlot {
 public:
-  inline StorageSlot() {
-    slot_ = uint256::max();
-    offset_ = 0;
-  }
-  inline StorageSlot(int slot, uint32_t offset) {
-    slot_ = uint256(slot);
-    offset_ = offset;
-  }
-  inline StorageSlot(uint256 slot, uint32_t offset) {
-    slot_ = slot;
-    offset_ = offset;
-  }
-  inline bool is_valid() { return slot_ != uint256::max(); }
-  inline uint256 get_slot() const { return slot_; }
-  inline uint32_t get_offset() const { return offset_; }
-  inline bytes32 to_bytes32() const { return slot_.bytes(); }
+  constexpr StorageSlot()
+      : slot_(uint256::max()), key_(slot_.bytes()), offset_(0) {}
+  constexpr StorageSlot(int slot, uint32_t offset)
+      : slot_(uint256(slot)), key_(slot_.bytes()), offset_(offset) {}
+  constexpr StorageSlot(uint256 slot, uint32_t offset)
+      : slot_(slot), key_(slot_.bytes()), offset_(offset) {}
+  // from an already big endian slot key(eg. keccak256 of a mapping key)
+  constexpr StorageSlot(const bytes32 &key, uint32_t offset)
+      : slot_(uint256(key)), key_(key), offset_(offset) {}
+  constexpr bool is_valid() const { return slot_ != uint256::max(); }
+  constexpr uint256 get_slot() const { return slot_; }
+  // big endian slot key passed to the storage hostapis
+  constexpr const bytes32 &get_key() const { return key_; }
+  constexpr uint32_t get_offset() const { return offset_; }
+  constexpr bytes32 to_bytes32() const { return key_; }
 
 private:
   uint256 slot_;
+  // slot_ as big endian bytes, cached so storage access needs no conversion
+  bytes32 key_;
   // Multiple state variables may exist in the same slot, offset_ indicates the
   // offset
   uint32_t offset_;
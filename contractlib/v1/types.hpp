@@ -5,6 +5,8 @@
 #include "math.hpp"
 #include "utils.hpp"
 #include <cstring>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace dtvm {
@@ -49,4 +51,47 @@ public:
 private:
   std::vector<uint8_t> data_;
 };
+
+// Non owning view of bytes kept elsewhere, usually the calldata buffer.
+// Valid only as long as that buffer is; to_bytes() and to_vector() make an
+// owning copy.
+class BytesView {
+public:
+  constexpr BytesView() : data_(nullptr), size_(0) {}
+  constexpr BytesView(const uint8_t *data, size_t size)
+      : data_(data), size_(size) {}
+  BytesView(const std::vector<uint8_t> &data)
+      : data_(data.data()), size_(data.size()) {}
+  BytesView(const Bytes &bytes) : data_(bytes.data()), size_(bytes.size()) {}
+
+  constexpr const uint8_t *data() const { return data_; }
+  constexpr size_t size() const { return size_; }
+  constexpr bool empty() const { return size_ == 0; }
+
+  constexpr const uint8_t *begin() const { return data_; }
+  constexpr const uint8_t *end() const { return data_ + size_; }
+
+  constexpr uint8_t operator[](size_t index) const { return data_[index]; }
+
+  std::string_view as_string_view() const {
+    return std::string_view((const char *)data_, size_);
+  }
+
+  std::vector<uint8_t> to_vector() const {
+    return std::vector<uint8_t>(begin(), end());
+  }
+
+  Bytes to_bytes() const { return Bytes(to_vector()); }
+
+  bool operator==(const BytesView &other) const {
+    return size_ == other.size_ &&
+           (size_ == 0 || ::memcmp(data_, other.data_, size_) == 0);
+  }
+
+  bool operator!=(const BytesView &other) const { return !(*this == other); }
+
+private:
+  const uint8_t *data_;
+  size_t size_;
+};
 } // namespace dtvm
@@ -5,8 +5,6 @@
 #include "hostapi.h"
 #include <array>
 #include <cstdint>
-#include <iomanip>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -35,31 +33,32 @@ inline std::array<uint8_t, 32> as_bytes32(const std::vector<uint8_t> &data) {
   return ret;
 }
 
-inline std::string hex(const std::vector<uint8_t> &bytes) {
-  std::stringstream ss;
-  for (const auto &byte : bytes) {
-    ss << std::hex << std::setw(2) << std::setfill('0')
-       << static_cast<int>(byte);
+namespace detail {
+
+inline constexpr char hex_digits[] = "0123456789abcdef";
+
+// Two output characters per byte straight from the digit table
+inline std::string hex_encode(const uint8_t *data, size_t size) {
+  std::string result(size * 2, '0');
+  for (size_t i = 0; i < size; i++) {
+    result[2 * i] = hex_digits[data[i] >> 4];
+    result[2 * i + 1] = hex_digits[data[i] & 0xf];
   }
-  return ss.str();
+  return result;
+}
+
+} // namespace detail
+
+inline std::string hex(const std::vector<uint8_t> &bytes) {
+  return detail::hex_encode(bytes.data(), bytes.size());
 }
 
 inline std::string hex(const std::array<uint8_t, 32> &bytes) {
-  std::stringstream ss;
-  for (const auto &byte : bytes) {
-    ss << std::hex << std::setw(2) << std::setfill('0')
-       << static_cast<int>(byte);
-  }
-  return ss.str();
+  return detail::hex_encode(bytes.data(), bytes.size());
 }
 
 inline std::string hex(const std::array<uint8_t, 20> &bytes) {
-  std::stringstream ss;
-  for (const auto &byte : bytes) {
-    ss << std::hex << std::setw(2) << std::setfill('0')
-       << static_cast<int>(byte);
-  }
-  return ss.str();
+  return detail::hex_encode(bytes.data(), bytes.size());
 }
 
 inline std::vector<uint8_t> unhex(const std::string &str) {
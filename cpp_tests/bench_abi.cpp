@@ -0,0 +1,290 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Throughput of the ABI codec over argument shapes from a single address up
+// to 1000 element arrays and 4 KB strings. Time per iteration is ns/op, the
+// bytes_per_second counter the encoded bytes produced or consumed. The Naive
+// and Bytewise benchmarks are the implementations the codec replaced.
+//
+//   ./runAbiBenchmarks --benchmark_filter=Decode
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <contractlib/v1/contractlib.hpp>
+
+using namespace dtvm;
+
+namespace {
+
+struct Order {
+  Address maker;
+  uint256 amount;
+  uint64_t expiry;
+};
+DTVM_ABI_STRUCT(Order, maker, amount, expiry)
+
+const Address MAKER(std::string("0x112233445566778899aa112233445566778899aa"));
+
+// A value of each shape, state.range(0) elements or bytes long
+struct AddressShape {
+  using type = Address;
+  static type make(size_t) { return MAKER; }
+};
+
+struct StringShape {
+  using type = std::string;
+  static type make(size_t size) { return std::string(size, 'x'); }
+};
+
+struct Uint256ArrayShape {
+  using type = std::vector<uint256>;
+  static type make(size_t size) {
+    type values;
+    for (size_t i = 0; i < size; i++) {
+      values.push_back(uint256(i) * uint256(1000000007));
+    }
+    return values;
+  }
+};
+
+struct StringArrayShape {
+  using type = std::vector<std::string>;
+  static type make(size_t size) {
+    return type(size, "a 40 byte memo, two words of abi tail..");
+  }
+};
+
+struct OrderArrayShape {
+  using type = std::vector<Order>;
+  static type make(size_t size) {
+    return type(size, Order{MAKER, uint256(1000), 1700000000});
+  }
+};
+
+template <typename Shape> void BM_AbiEncode(benchmark::State &state) {
+  const auto &value = Shape::make(size_t(state.range(0)));
+  const size_t size = abi_encode(value).size();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_encode(value));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(size));
+}
+
+template <typename Shape> void BM_AbiEncodeVector(benchmark::State &state) {
+  const auto &value = Shape::make(size_t(state.range(0)));
+  const size_t size = abi_encode_vector(value).size();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_encode_vector(value));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(size));
+}
+
+template <typename Shape> void BM_AbiDecode(benchmark::State &state) {
+  using T = typename Shape::type;
+  const auto &encoded = abi_encode(Shape::make(size_t(state.range(0))));
+  uint32_t read_bytes = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_decode<T>(
+        encoded.data(), encoded.data() + encoded.size(), read_bytes));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) *
+                          int64_t(encoded.size()));
+}
+
+template <typename Shape> void BM_AbiDecodeVector(benchmark::State &state) {
+  using E = typename Shape::type::value_type;
+  const auto &encoded = abi_encode_vector(Shape::make(size_t(state.range(0))));
+  uint32_t read_bytes = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_decode_vector<E>(
+        encoded.data(), encoded.data() + encoded.size(), read_bytes));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) *
+                          int64_t(encoded.size()));
+}
+
+// The value as the only parameter of a call, read the way dispatch does
+template <typename Shape> void BM_InputRead(benchmark::State &state) {
+  using T = typename Shape::type;
+  const auto &calldata = abi_encode_args(Shape::make(size_t(state.range(0))));
+  for (auto _ : state) {
+    Input input(calldata.data(), uint32_t(calldata.size()));
+    benchmark::DoNotOptimize(input.read<T>());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) *
+                          int64_t(calldata.size()));
+}
+
+// transfer(address,uint256), the most common call
+void BM_InputReadTransfer(benchmark::State &state) {
+  const auto &calldata = abi_encode_args(MAKER, uint256(1000));
+  for (auto _ : state) {
+    Input input(calldata.data(), uint32_t(calldata.size()));
+    benchmark::DoNotOptimize(input.read<Address>());
+    benchmark::DoNotOptimize(input.read<uint256>());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) *
+                          int64_t(calldata.size()));
+}
+BENCHMARK(BM_InputReadTransfer);
+
+// The tuple encoding abi_encode did before AbiWriter: a vector per element,
+// then separate head and tail vectors copied into the result
+template <typename... Args>
+std::vector<uint8_t> naive_abi_encode_args(const Args &...args) {
+  std::vector<uint8_t> prefix_part;
+  std::vector<uint8_t> suffix_part;
+  const uint32_t prefix_size = 32 * sizeof...(Args);
+  auto encode_element = [&](const auto &arg) {
+    const std::vector<uint8_t> &encoded = abi_encode(arg);
+    if (is_dynamic_encoding_type(arg)) {
+      const auto &offset = uint256(prefix_size + suffix_part.size()).bytes();
+      prefix_part.insert(prefix_part.end(), offset.begin(), offset.end());
+      suffix_part.insert(suffix_part.end(), encoded.begin(), encoded.end());
+    } else {
+      prefix_part.insert(prefix_part.end(), encoded.begin(), encoded.end());
+    }
+  };
+  (encode_element(args), ...);
+  std::vector<uint8_t> result = prefix_part;
+  result.insert(result.end(), suffix_part.begin(), suffix_part.end());
+  return result;
+}
+
+const Address TRANSFER_FROM(
+    std::string("0x112233445566778899aa112233445566778899aa"));
+const Address TRANSFER_TO(
+    std::string("0xaabbccddeeff00112233445566778899aabbccdd"));
+
+// Transfer(address,address,uint256) event data
+void BM_AbiEncodeTransfer(benchmark::State &state) {
+  const uint256 amount(1000000000000000000ull);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        abi_encode_args(TRANSFER_FROM, TRANSFER_TO, amount));
+  }
+}
+BENCHMARK(BM_AbiEncodeTransfer);
+
+void BM_NaiveAbiEncodeTransfer(benchmark::State &state) {
+  const uint256 amount(1000000000000000000ull);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        naive_abi_encode_args(TRANSFER_FROM, TRANSFER_TO, amount));
+  }
+}
+BENCHMARK(BM_NaiveAbiEncodeTransfer);
+
+// a dynamic argument between static ones
+void BM_AbiEncodeWithString(benchmark::State &state) {
+  const std::string memo = "a memo that takes two words of abi tail";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_encode_args(TRANSFER_TO, memo, uint256(42)));
+  }
+}
+BENCHMARK(BM_AbiEncodeWithString);
+
+void BM_NaiveAbiEncodeWithString(benchmark::State &state) {
+  const std::string memo = "a memo that takes two words of abi tail";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        naive_abi_encode_args(TRANSFER_TO, memo, uint256(42)));
+  }
+}
+BENCHMARK(BM_NaiveAbiEncodeWithString);
+
+// A string argument of state.range(0) bytes, as an owning copy and as a
+// view into the encoded buffer
+void BM_AbiDecodeString(benchmark::State &state) {
+  const auto &encoded = abi_encode(std::string(state.range(0), 'x'));
+  uint32_t read_bytes = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_decode<std::string>(
+        encoded.data(), encoded.data() + encoded.size(), read_bytes));
+  }
+}
+BENCHMARK(BM_AbiDecodeString)->Arg(32)->Arg(4096);
+
+void BM_AbiDecodeStringView(benchmark::State &state) {
+  const auto &encoded = abi_encode(std::string(state.range(0), 'x'));
+  uint32_t read_bytes = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(abi_decode<std::string_view>(
+        encoded.data(), encoded.data() + encoded.size(), read_bytes));
+  }
+}
+BENCHMARK(BM_AbiDecodeStringView)->Arg(32)->Arg(4096);
+
+// The preimage of a mapping slot, h(key) . slot, packed on the stack and
+// concatenated into a vector the way to_map_key_slot used to
+void BM_AbiEncodePackedMapKey(benchmark::State &state) {
+  const StorageSlot slot(3, 0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        abi_encode_packed(TRANSFER_TO.to_bytes32(), slot.get_key()));
+  }
+}
+BENCHMARK(BM_AbiEncodePackedMapKey);
+
+void BM_NaivePackedMapKey(benchmark::State &state) {
+  const StorageSlot slot(3, 0);
+  for (auto _ : state) {
+    const bytes32 &key = TRANSFER_TO.to_bytes32();
+    std::vector<uint8_t> key_merger;
+    key_merger.insert(key_merger.end(), key.begin(), key.end());
+    key_merger.insert(key_merger.end(), slot.get_key().begin(),
+                      slot.get_key().end());
+    benchmark::DoNotOptimize(key_merger);
+  }
+}
+BENCHMARK(BM_NaivePackedMapKey);
+
+// The strict mode check of a uint64 argument, word-wise and byte by byte
+void BM_AbiCanonicalCheck(benchmark::State &state) {
+  const auto &word = abi_encode(uint64_t(12345));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        detail::abi_integer_is_canonical<uint64_t>(word.data()));
+  }
+}
+BENCHMARK(BM_AbiCanonicalCheck);
+
+void BM_AbiCanonicalCheckBytewise(benchmark::State &state) {
+  const auto &word = abi_encode(uint64_t(12345));
+  for (auto _ : state) {
+    bool canonical = true;
+    for (size_t i = 0; i < 24; i++) {
+      canonical = canonical && word[i] == 0;
+    }
+    benchmark::DoNotOptimize(canonical);
+  }
+}
+BENCHMARK(BM_AbiCanonicalCheckBytewise);
+
+} // namespace
+
+#define BENCHMARK_ABI_SHAPE(Shape, ...)                                        \
+  BENCHMARK_TEMPLATE(BM_AbiEncode, Shape)->__VA_ARGS__;                        \
+  BENCHMARK_TEMPLATE(BM_AbiDecode, Shape)->__VA_ARGS__;                        \
+  BENCHMARK_TEMPLATE(BM_InputRead, Shape)->__VA_ARGS__;
+
+#define BENCHMARK_ABI_ARRAY_SHAPE(Shape)                                       \
+  BENCHMARK_ABI_SHAPE(Shape, Arg(1)->Arg(10)->Arg(100)->Arg(1000))             \
+  BENCHMARK_TEMPLATE(BM_AbiEncodeVector, Shape)                                \
+      ->Arg(1)                                                                 \
+      ->Arg(10)                                                                \
+      ->Arg(100)                                                               \
+      ->Arg(1000);                                                             \
+  BENCHMARK_TEMPLATE(BM_AbiDecodeVector, Shape)                                \
+      ->Arg(1)                                                                 \
+      ->Arg(10)                                                                \
+      ->Arg(100)                                                               \
+      ->Arg(1000);
+
+BENCHMARK_ABI_SHAPE(AddressShape, Arg(1))
+BENCHMARK_ABI_SHAPE(StringShape, Arg(32)->Arg(256)->Arg(4096))
+BENCHMARK_ABI_ARRAY_SHAPE(Uint256ArrayShape)
+BENCHMARK_ABI_ARRAY_SHAPE(StringArrayShape)
+BENCHMARK_ABI_ARRAY_SHAPE(OrderArrayShape)
@@ -0,0 +1,588 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include <contractlib/v1/math.hpp>
+#include <contractlib/v1/modfield.hpp>
+#include <contractlib/v1/packed.hpp>
+#include <contractlib/v1/secp256k1.hpp>
+#include <contractlib/v1/storage.hpp>
+
+using namespace dtvm;
+
+namespace {
+
+// The bit by bit shift-and-subtract loop contracts used before uint256 had
+// division, kept as the baseline
+std::pair<uint256, uint256> naive_divmod(const uint256 &a, const uint256 &b) {
+  uint256 quotient;
+  uint256 remainder;
+  for (int i = 255; i >= 0; i--) {
+    remainder = (remainder << 1) | ((a >> i) & uint256(1));
+    if (remainder >= b) {
+      remainder = remainder - b;
+      quotient = quotient | (uint256(1) << i);
+    }
+  }
+  return {quotient, remainder};
+}
+
+uint256 random_u256(std::mt19937_64 &rng, int bits) {
+  uint256 v((__uint128_t(rng()) << 64) | rng(),
+            (__uint128_t(rng()) << 64) | rng());
+  v = bits >= 256 ? v : v >> (256 - bits);
+  return v == uint256(0) ? uint256(1) : v;
+}
+
+// 256-bit dividends and divisors of state.range(0) bits
+std::vector<std::pair<uint256, uint256>> division_inputs(int divisor_bits) {
+  std::mt19937_64 rng(divisor_bits);
+  std::vector<std::pair<uint256, uint256>> inputs;
+  for (int i = 0; i < 64; i++) {
+    inputs.emplace_back(random_u256(rng, 256), random_u256(rng, divisor_bits));
+  }
+  return inputs;
+}
+
+void BM_U256DivMod(benchmark::State &state) {
+  const auto &inputs = division_inputs((int)state.range(0));
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(input.first.divmod(input.second));
+  }
+}
+BENCHMARK(BM_U256DivMod)->Arg(32)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+void BM_U256NaiveDivMod(benchmark::State &state) {
+  const auto &inputs = division_inputs((int)state.range(0));
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(naive_divmod(input.first, input.second));
+  }
+}
+BENCHMARK(BM_U256NaiveDivMod)->Arg(32)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+// dividing amounts by 1e18, the general divmod against the precomputed
+// reciprocal
+void BM_U256DivByWad(benchmark::State &state) {
+  const auto &inputs = division_inputs(64);
+  const uint256 wad(1000000000000000000ull);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(inputs[i++ % inputs.size()].first.divmod(wad));
+  }
+}
+BENCHMARK(BM_U256DivByWad);
+
+void BM_U256DivByConstantWad(benchmark::State &state) {
+  const auto &inputs = division_inputs(64);
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint256 &a = inputs[i++ % inputs.size()].first;
+    benchmark::DoNotOptimize(a.divmod_by<1000000000000000000ull>());
+  }
+}
+BENCHMARK(BM_U256DivByConstantWad);
+
+void BM_U256MulDiv(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &x = inputs[i++ % inputs.size()];
+    const auto &y = inputs[i % inputs.size()];
+    // the denominator is the larger operand so the result always fits
+    const uint256 &denominator = x.first > y.first ? x.first : y.first;
+    benchmark::DoNotOptimize(mul_div(x.first, y.first, denominator));
+  }
+}
+BENCHMARK(BM_U256MulDiv);
+
+void BM_U256MulMod(benchmark::State &state) {
+  const auto &inputs = division_inputs((int)state.range(0));
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(mulmod(input.first, input.first, input.second));
+  }
+}
+BENCHMARK(BM_U256MulMod)->Arg(64)->Arg(256);
+
+// Operand sets every uint256 operator benchmark runs over, selected by
+// state.range(0). Random words exercise the common case, the edge values
+// hit the limb boundaries where carries, borrows and shifts cross halves.
+enum InputSet : int64_t { RANDOM_INPUTS = 0, EDGE_INPUTS = 1 };
+
+std::vector<std::pair<uint256, uint256>> operand_pairs(int64_t input_set) {
+  if (input_set == RANDOM_INPUTS) {
+    return division_inputs(256);
+  }
+  const uint256 &one(1);
+  const std::vector<uint256> edges = {
+      uint256(0),
+      one,
+      (one << 64) - one,
+      one << 64,
+      (one << 128) - one,
+      one << 128,
+      (one << 192) - one,
+      one << 255,
+      uint256::max() - one,
+      uint256::max(),
+      uint256::max() / uint256(3),               // 0x5555...
+      uint256::max() / uint256(3) * uint256(2)}; // 0xaaaa...
+  std::vector<std::pair<uint256, uint256>> pairs;
+  for (const auto &a : edges) {
+    for (const auto &b : edges) {
+      pairs.emplace_back(a, b);
+    }
+  }
+  return pairs;
+}
+
+template <typename Op> void BM_U256Op(benchmark::State &state, Op op) {
+  const auto &inputs = operand_pairs(state.range(0));
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(op(input.first, input.second));
+  }
+}
+
+// b is unused by the unary ops (bit_not, bytes, to_uint*)
+#define BENCHMARK_U256_OP(name, expr)                                          \
+  BENCHMARK_CAPTURE(BM_U256Op, name,                                           \
+                    [](const uint256 &a, [[maybe_unused]] const uint256 &b) {  \
+                      return expr;                                             \
+                    })                                                         \
+      ->ArgName("edge")                                                        \
+      ->Arg(RANDOM_INPUTS)                                                     \
+      ->Arg(EDGE_INPUTS)
+
+BENCHMARK_U256_OP(add, a + b);
+BENCHMARK_U256_OP(sub, a - b);
+BENCHMARK_U256_OP(mul, a * b);
+BENCHMARK_U256_OP(shl, a << size_t(uint64_t(b.low) % 256));
+BENCHMARK_U256_OP(shr, a >> size_t(uint64_t(b.low) % 256));
+BENCHMARK_U256_OP(lt, a < b);
+BENCHMARK_U256_OP(eq, a == b);
+BENCHMARK_U256_OP(bit_and, a & b);
+BENCHMARK_U256_OP(bit_xor, a ^ b);
+BENCHMARK_U256_OP(bit_not, ~a);
+BENCHMARK_U256_OP(bytes, a.bytes());
+BENCHMARK_U256_OP(to_uint128, a.to_uint128());
+BENCHMARK_U256_OP(to_uint64, a.to_uint64());
+BENCHMARK_U256_OP(to_uint32, a.to_uint32());
+BENCHMARK_U256_OP(to_uint8, a.to_uint8());
+
+void BM_U256FromBytes32(benchmark::State &state) {
+  std::vector<bytes32> words;
+  for (const auto &input : operand_pairs(state.range(0))) {
+    words.push_back(input.first.bytes());
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(uint256(words[i++ % words.size()]));
+  }
+}
+BENCHMARK(BM_U256FromBytes32)
+    ->ArgName("edge")
+    ->Arg(RANDOM_INPUTS)
+    ->Arg(EDGE_INPUTS);
+
+// Backend kernels side by side, the selected one is what uint256 uses
+template <typename Backend> void BM_BackendAdd(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(Backend::add(input.first, input.second));
+  }
+}
+
+template <typename Backend> void BM_BackendSub(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(Backend::sub(input.first, input.second));
+  }
+}
+
+template <typename Backend> void BM_BackendMul(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(Backend::mul(input.first, input.second));
+  }
+}
+
+template <typename Backend> void BM_BackendShl(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(Backend::shl(input.first, i % 256));
+  }
+}
+
+template <typename Backend> void BM_BackendShr(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(Backend::shr(input.first, i % 256));
+  }
+}
+
+template <typename Backend> void BM_BackendLt(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(Backend::lt(input.first, input.second));
+  }
+}
+
+// bit by bit integer square root, the baseline for the Newton sqrt
+uint256 naive_sqrt(const uint256 &x) {
+  uint256 remainder = x;
+  uint256 root;
+  uint256 bit = uint256(1) << 254;
+  while (bit > remainder) {
+    bit = bit >> 2;
+  }
+  while (bit != uint256(0)) {
+    if (remainder >= root + bit) {
+      remainder = remainder - (root + bit);
+      root = (root >> 1) + bit;
+    } else {
+      root = root >> 1;
+    }
+    bit = bit >> 2;
+  }
+  return root;
+}
+
+void BM_U256Sqrt(benchmark::State &state) {
+  const auto &inputs = division_inputs(int(state.range(0)));
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sqrt(inputs[i++ % inputs.size()].first));
+  }
+}
+BENCHMARK(BM_U256Sqrt)->Arg(64)->Arg(256);
+
+void BM_U256NaiveSqrt(benchmark::State &state) {
+  const auto &inputs = division_inputs(int(state.range(0)));
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(naive_sqrt(inputs[i++ % inputs.size()].first));
+  }
+}
+BENCHMARK(BM_U256NaiveSqrt)->Arg(64)->Arg(256);
+
+void BM_U256Log10(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(log10(inputs[i++ % inputs.size()].second));
+  }
+}
+BENCHMARK(BM_U256Log10);
+
+void BM_U256Clz(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(clz(inputs[i++ % inputs.size()].second));
+  }
+}
+BENCHMARK(BM_U256Clz);
+
+void BM_U256Pow(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(
+        pow(input.first, uint256(uint64_t(input.second.low) % 256)));
+  }
+}
+BENCHMARK(BM_U256Pow);
+
+// one divmod_u64 by 10 per digit, the baseline for the chunked formatter
+std::string naive_to_dec_string(uint256 value) {
+  std::string digits;
+  do {
+    const auto &result = value.divmod_u64(10);
+    digits.push_back(char('0' + uint64_t(result.second.low)));
+    value = result.first;
+  } while (value != uint256(0));
+  return std::string(digits.rbegin(), digits.rend());
+}
+
+void BM_U256ToDecString(benchmark::State &state) {
+  const auto &inputs = division_inputs(int(state.range(0)));
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        to_dec_string(inputs[i++ % inputs.size()].second));
+  }
+}
+BENCHMARK(BM_U256ToDecString)->Arg(64)->Arg(256);
+
+void BM_U256NaiveToDecString(benchmark::State &state) {
+  const auto &inputs = division_inputs(int(state.range(0)));
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        naive_to_dec_string(inputs[i++ % inputs.size()].second));
+  }
+}
+BENCHMARK(BM_U256NaiveToDecString)->Arg(64)->Arg(256);
+
+void BM_U256FromDecString(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  std::vector<std::string> strings;
+  for (const auto &input : inputs) {
+    strings.push_back(to_dec_string(input.first));
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(from_dec_string(strings[i++ % strings.size()]));
+  }
+}
+BENCHMARK(BM_U256FromDecString);
+
+void BM_U256ToHexString(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(to_hex_string(inputs[i++ % inputs.size()].first));
+  }
+}
+BENCHMARK(BM_U256ToHexString);
+
+void BM_U256FromBeBytes(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  std::vector<bytes32> words;
+  for (const auto &input : inputs) {
+    words.push_back(input.first.bytes());
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        uint256::from_be_bytes(words[i++ % words.size()].data()));
+  }
+}
+BENCHMARK(BM_U256FromBeBytes);
+
+void BM_U256ToBeBytes(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  bytes32 out;
+  size_t i = 0;
+  for (auto _ : state) {
+    inputs[i++ % inputs.size()].first.to_be_bytes(out.data());
+    benchmark::DoNotOptimize(out);
+  }
+}
+BENCHMARK(BM_U256ToBeBytes);
+
+// read-modify-write of a mapping balance, as an ERC20 transfer does twice
+// (the mock storage dominates the absolute numbers)
+void BM_BalanceUpdate(benchmark::State &state) {
+  StorageMap<Address, uint256> balances(StorageSlot(1, 0));
+  Address owner(std::string("0x1111111111111111111111111111111111111111"));
+  balances.set(owner, uint256(1000000));
+  for (auto _ : state) {
+    balances.set(owner, balances.get(owner) - uint256(1));
+  }
+}
+BENCHMARK(BM_BalanceUpdate);
+
+// A 96-bit amount packed at bit 64, through BitField and by hand with the
+// generic uint256 shifts
+using PackedAmount = BitField<64, 96, __uint128_t>;
+
+void BM_PackedFieldGetSet(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint256 &word = inputs[i++ % inputs.size()].first;
+    const __uint128_t amount = PackedAmount::get(word);
+    benchmark::DoNotOptimize(PackedAmount::set(word, amount >> 1));
+  }
+}
+BENCHMARK(BM_PackedFieldGetSet);
+
+void BM_ManualShiftGetSet(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  const uint256 &mask = uint256::max() >> 160;
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint256 &word = inputs[i++ % inputs.size()].first;
+    const uint256 &amount = (word >> 64) & mask;
+    benchmark::DoNotOptimize((word & ~(mask << 64)) | ((amount >> 1) << 64));
+  }
+}
+BENCHMARK(BM_ManualShiftGetSet);
+
+void BM_PackedFieldSetBytes32(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  std::vector<bytes32> words;
+  for (const auto &input : inputs) {
+    words.push_back(input.first.bytes());
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    bytes32 &word = words[i++ % words.size()];
+    PackedAmount::set(word, PackedAmount::get(word) >> 1);
+    benchmark::DoNotOptimize(word);
+  }
+}
+BENCHMARK(BM_PackedFieldSetBytes32);
+
+// Montgomery field operations, against mulmod with the same modulus as the
+// baseline for a multiplication
+template <typename Field> std::vector<Field> field_inputs() {
+  std::vector<Field> values;
+  for (const auto &input : division_inputs(256)) {
+    values.push_back(Field::from_uint256(input.first));
+  }
+  return values;
+}
+
+template <typename Field> void BM_ModFieldMul(benchmark::State &state) {
+  const auto &values = field_inputs<Field>();
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &x = values[i++ % values.size()];
+    benchmark::DoNotOptimize(x * values[i % values.size()]);
+  }
+}
+
+template <typename Field> void BM_ModFieldMulMod(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &x = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(mulmod(x.first, x.second, Field::P));
+  }
+}
+
+template <typename Field> void BM_ModFieldAdd(benchmark::State &state) {
+  const auto &values = field_inputs<Field>();
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &x = values[i++ % values.size()];
+    benchmark::DoNotOptimize(x + values[i % values.size()]);
+  }
+}
+
+template <typename Field> void BM_ModFieldInverse(benchmark::State &state) {
+  const auto &values = field_inputs<Field>();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(values[i++ % values.size()].inverse());
+  }
+}
+
+template <typename Field> void BM_ModFieldToUint256(benchmark::State &state) {
+  const auto &values = field_inputs<Field>();
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(values[i++ % values.size()].to_uint256());
+  }
+}
+
+#define BENCHMARK_MOD_FIELD(Field)                                             \
+  BENCHMARK_TEMPLATE(BM_ModFieldMul, Field);                                   \
+  BENCHMARK_TEMPLATE(BM_ModFieldMulMod, Field);                                \
+  BENCHMARK_TEMPLATE(BM_ModFieldAdd, Field);                                   \
+  BENCHMARK_TEMPLATE(BM_ModFieldInverse, Field);                               \
+  BENCHMARK_TEMPLATE(BM_ModFieldToUint256, Field);
+
+BENCHMARK_MOD_FIELD(secp256k1_fp)
+BENCHMARK_MOD_FIELD(bn254_fp)
+
+// ecrecover without the final keccak256 (the mock host prints every hash),
+// and its two scalar multiplications on their own
+struct RecoverInput {
+  bytes32 hash;
+  uint8_t v;
+  uint256 r;
+  uint256 s;
+};
+
+std::vector<RecoverInput> recover_inputs() {
+  using crypto::detail::Fn;
+  std::vector<RecoverInput> inputs;
+  for (const auto &input : division_inputs(256)) {
+    // signed by private key 1 with nonce input.first
+    const uint256 &k = input.first % Fn::P;
+    const auto &point = crypto::detail::mul_generator(k);
+    const auto &z_inverse = point.z.inverse();
+    const uint256 &x = (point.x * z_inverse.square()).to_uint256();
+    const uint256 &y = (point.y * z_inverse.square() * z_inverse).to_uint256();
+    const uint256 &r = x % Fn::P;
+    const bytes32 &hash = input.second.bytes();
+    const auto &s = Fn::from_uint256(k).inverse() *
+                    (Fn::from_uint256(input.second) + Fn::from_uint256(r));
+    inputs.push_back({hash, uint8_t(27 + (y.low & 1)), r, s.to_uint256()});
+  }
+  return inputs;
+}
+
+void BM_Secp256k1RecoverPublicKey(benchmark::State &state) {
+  const auto &inputs = recover_inputs();
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &input = inputs[i++ % inputs.size()];
+    benchmark::DoNotOptimize(
+        crypto::recover_public_key(input.hash, input.v, input.r, input.s));
+  }
+}
+BENCHMARK(BM_Secp256k1RecoverPublicKey);
+
+void BM_Secp256k1MulGenerator(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        crypto::detail::mul_generator(inputs[i++ % inputs.size()].first));
+  }
+}
+BENCHMARK(BM_Secp256k1MulGenerator);
+
+void BM_Secp256k1MulPoint(benchmark::State &state) {
+  const auto &inputs = division_inputs(256);
+  const auto &g = crypto::detail::generator_multiple(0, 1);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        crypto::detail::mul_point(g, inputs[i++ % inputs.size()].first));
+  }
+}
+BENCHMARK(BM_Secp256k1MulPoint);
+
+#define BENCHMARK_UINT256_BACKEND(Backend)                                     \
+  BENCHMARK_TEMPLATE(BM_BackendAdd, Backend);                                  \
+  BENCHMARK_TEMPLATE(BM_BackendSub, Backend);                                  \
+  BENCHMARK_TEMPLATE(BM_BackendMul, Backend);                                  \
+  BENCHMARK_TEMPLATE(BM_BackendShl, Backend);                                  \
+  BENCHMARK_TEMPLATE(BM_BackendShr, Backend);                                  \
+  BENCHMARK_TEMPLATE(BM_BackendLt, Backend);
+
+BENCHMARK_UINT256_BACKEND(detail::U128Backend)
+BENCHMARK_UINT256_BACKEND(detail::Limb64Backend)
+#ifdef DTVM_HAS_BITINT_256
+BENCHMARK_UINT256_BACKEND(detail::BitIntBackend)
+#endif
+
+} // namespace
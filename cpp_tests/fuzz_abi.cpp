@@ -0,0 +1,328 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Differential round trip fuzzing of the ABI codec. Every input builds typed
+// values of one of several shapes and checks that
+//
+//   - abi_encode_args, abi_encode of the tuple, AbiWriter and
+//     abi_encode_call produce the same bytes, of abi_encoded_size bytes
+//   - abi_decode_args, Input::read and abi_decode_vector give back values
+//     that encode to the same bytes, without reverting
+//
+// and then decodes the raw input itself, which may revert but must not read
+// outside of it, and whose decoded values must round trip too.
+//
+// With clang this is a libFuzzer target, run as
+//   ./fuzzAbiRoundTrip -max_len=4096 corpus/
+// Other compilers build it with a main that replays pseudo random inputs.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <contractlib/v1/contractlib.hpp>
+
+using namespace dtvm;
+
+extern "C" int32_t mock_revert_count();
+
+#define FUZZ_CHECK(condition)                                                  \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,         \
+              #condition);                                                     \
+      abort();                                                                 \
+    }                                                                          \
+  } while (0)
+
+namespace {
+
+struct FuzzOrder {
+  Address maker;
+  uint256 amount;
+  std::string memo;
+  std::vector<uint64_t> fills;
+};
+DTVM_ABI_STRUCT(FuzzOrder, maker, amount, memo, fills)
+
+// Hands out the input bytes, then zeros once they run out
+class FuzzReader {
+public:
+  FuzzReader(const uint8_t *data, size_t size)
+      : data_(data), end_(data + size) {}
+
+  uint8_t byte() { return data_ < end_ ? *data_++ : 0; }
+
+  void fill(uint8_t *out, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+      out[i] = byte();
+    }
+  }
+
+  size_t length(size_t max) { return byte() % (max + 1); }
+
+private:
+  const uint8_t *data_;
+  const uint8_t *end_;
+};
+
+template <typename T, typename Enable = void> struct FuzzValue;
+
+template <typename T>
+struct FuzzValue<T, std::enable_if_t<std::is_integral<T>::value &&
+                                     !std::is_same<T, bool>::value>> {
+  static T make(FuzzReader &reader) {
+    T value = 0;
+    reader.fill((uint8_t *)&value, sizeof(T));
+    return value;
+  }
+};
+
+template <> struct FuzzValue<bool> {
+  static bool make(FuzzReader &reader) { return (reader.byte() & 1) != 0; }
+};
+
+template <> struct FuzzValue<uint256> {
+  static uint256 make(FuzzReader &reader) {
+    bytes32 word;
+    reader.fill(word.data(), word.size());
+    return uint256(word);
+  }
+};
+
+template <> struct FuzzValue<int256> {
+  static int256 make(FuzzReader &reader) {
+    return int256::from_bits(FuzzValue<uint256>::make(reader));
+  }
+};
+
+template <> struct FuzzValue<Address> {
+  static Address make(FuzzReader &reader) {
+    return Address(FuzzValue<uint256>::make(reader).bytes());
+  }
+};
+
+template <> struct FuzzValue<std::string> {
+  static std::string make(FuzzReader &reader) {
+    std::string value(reader.length(100), '\0');
+    reader.fill((uint8_t *)value.data(), value.size());
+    return value;
+  }
+};
+
+template <> struct FuzzValue<Bytes> {
+  static Bytes make(FuzzReader &reader) {
+    std::vector<uint8_t> value(reader.length(100));
+    reader.fill(value.data(), value.size());
+    return Bytes(value);
+  }
+};
+
+template <typename T, size_t N> struct FuzzValue<std::array<T, N>> {
+  static std::array<T, N> make(FuzzReader &reader) {
+    std::array<T, N> value;
+    for (T &element : value) {
+      element = FuzzValue<T>::make(reader);
+    }
+    return value;
+  }
+};
+
+template <typename T> struct FuzzValue<std::vector<T>> {
+  static std::vector<T> make(FuzzReader &reader) {
+    std::vector<T> value;
+    const size_t length = reader.length(8);
+    for (size_t i = 0; i < length; i++) {
+      value.push_back(FuzzValue<T>::make(reader));
+    }
+    return value;
+  }
+};
+
+template <typename... Args> struct FuzzValue<std::tuple<Args...>> {
+  static std::tuple<Args...> make(FuzzReader &reader) {
+    // a braced list evaluates the elements in order
+    return std::tuple<Args...>{FuzzValue<Args>::make(reader)...};
+  }
+};
+
+template <> struct FuzzValue<FuzzOrder> {
+  static FuzzOrder make(FuzzReader &reader) {
+    return FuzzOrder{FuzzValue<Address>::make(reader),
+                     FuzzValue<uint256>::make(reader),
+                     FuzzValue<std::string>::make(reader),
+                     FuzzValue<std::vector<uint64_t>>::make(reader)};
+  }
+};
+
+template <typename T> struct is_std_vector : std::false_type {};
+template <typename T>
+struct is_std_vector<std::vector<T>> : std::true_type {};
+
+// The vector entry points agree with the generic ones
+template <typename T> void check_vector(const T &value) {
+  if constexpr (is_std_vector<T>::value) {
+    const auto &encoded = abi_encode_vector(value);
+    FUZZ_CHECK(encoded == abi_encode(value));
+    uint32_t read_bytes = 0;
+    const auto &decoded = abi_decode_vector<typename T::value_type>(
+        encoded.data(), encoded.data() + encoded.size(), read_bytes);
+    FUZZ_CHECK(read_bytes == encoded.size());
+    FUZZ_CHECK(abi_encode_vector(decoded) == encoded);
+  }
+}
+
+// Returns the encoding of values
+template <typename... Args>
+std::vector<uint8_t> check_round_trip(const std::tuple<Args...> &values) {
+  const int32_t reverts = mock_revert_count();
+  const auto &encoded = std::apply(
+      [](const Args &...args) { return abi_encode_args(args...); }, values);
+  FUZZ_CHECK(encoded.size() == std::apply(
+                                   [](const Args &...args) {
+                                     return abi_encoded_size(args...);
+                                   },
+                                   values));
+  FUZZ_CHECK(abi_encode(values) == encoded);
+  FUZZ_CHECK(AbiWriter().write_value(values).take() == encoded);
+
+  const auto &call = std::apply(
+      [](const Args &...args) { return abi_encode_call(0x12345678, args...); },
+      values);
+  FUZZ_CHECK(call.size() == 4 + encoded.size());
+  FUZZ_CHECK(call[0] == 0x12 && call[3] == 0x78);
+  FUZZ_CHECK(std::equal(encoded.begin(), encoded.end(), call.begin() + 4));
+
+  const auto &decoded =
+      abi_decode_args<Args...>(encoded.data(), encoded.data() + encoded.size());
+  FUZZ_CHECK(abi_encode(decoded) == encoded);
+
+  Input input(encoded.data(), uint32_t(encoded.size()));
+  const std::tuple<Args...> read{input.read<Args>()...};
+  FUZZ_CHECK(abi_encode(read) == encoded);
+
+  std::apply([](const Args &...args) { (check_vector(args), ...); }, values);
+  FUZZ_CHECK(mock_revert_count() == reverts);
+  return encoded;
+}
+
+// Arbitrary bytes decoded as Args: whatever decodes without a revert is a
+// valid encoding of its values, so it has to round trip as well
+template <typename... Args>
+void fuzz_raw_decode(const uint8_t *data, size_t size) {
+  const int32_t reverts = mock_revert_count();
+  const auto &decoded = abi_decode_args<Args...>(data, data + size);
+  Input input(data, uint32_t(size));
+  const std::tuple<Args...> read{input.read<Args>()...};
+  if (mock_revert_count() == reverts) {
+    FUZZ_CHECK(abi_encode(read) == abi_encode(decoded));
+    check_round_trip(decoded);
+  }
+}
+
+// Round trips values of a shape, then decodes their encoding with one byte
+// changed and cut short, which reaches far more of the decoder's checks
+// than random bytes do
+template <typename... Args> void fuzz_shape(FuzzReader &reader) {
+  std::vector<uint8_t> encoded =
+      check_round_trip(FuzzValue<std::tuple<Args...>>::make(reader));
+  const size_t position = FuzzValue<uint16_t>::make(reader) % encoded.size();
+  encoded[position] ^= reader.byte() | 1;
+  // a copy of exactly that size, so a read past it is caught by ASan
+  const std::vector<uint8_t> changed(
+      encoded.begin(),
+      encoded.end() - reader.length(64) % encoded.size());
+  fuzz_raw_decode<Args...>(changed.data(), changed.size());
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***) {
+  // the mock host prints every revert
+  std::cout.setstate(std::ios::failbit);
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  FuzzReader reader(data, size);
+  switch (reader.byte() % 9) {
+  case 0:
+    fuzz_shape<uint8_t, int16_t, uint64_t, bool>(reader);
+    break;
+  case 1:
+    fuzz_shape<int64_t, uint256, int256, int8_t>(reader);
+    break;
+  case 2:
+    fuzz_shape<Address, std::array<uint8_t, 4>, bytes32>(reader);
+    break;
+  case 3:
+    fuzz_shape<std::string, Bytes, uint256>(reader);
+    break;
+  case 4:
+    fuzz_shape<std::vector<uint256>, std::vector<std::string>>(reader);
+    break;
+  case 5:
+    fuzz_shape<std::array<std::string, 2>,
+               std::vector<std::array<uint16_t, 3>>>(reader);
+    break;
+  case 6:
+    fuzz_shape<std::tuple<Address, std::string>,
+               std::vector<std::vector<int32_t>>>(reader);
+    break;
+  case 7:
+    fuzz_shape<FuzzOrder, std::vector<FuzzOrder>>(reader);
+    break;
+  default:
+    fuzz_shape<std::vector<bool>, std::vector<Address>>(reader);
+    break;
+  }
+
+  fuzz_raw_decode<std::string, std::vector<uint256>, bool>(data, size);
+  fuzz_raw_decode<FuzzOrder>(data, size);
+  fuzz_raw_decode<std::vector<std::string>, Address>(data, size);
+  return 0;
+}
+
+#ifdef DTVM_FUZZ_STANDALONE
+// Replays the files given as arguments, or else a fixed number of pseudo
+// random inputs, so the target runs as a test where libFuzzer is missing
+int main(int argc, char **argv) {
+  LLVMFuzzerInitialize(&argc, &argv);
+  if (argc > 1) {
+    for (int i = 1; i < argc; i++) {
+      FILE *file = fopen(argv[i], "rb");
+      FUZZ_CHECK(file != nullptr);
+      std::vector<uint8_t> input;
+      int c;
+      while ((c = fgetc(file)) != EOF) {
+        input.push_back(uint8_t(c));
+      }
+      fclose(file);
+      LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    return 0;
+  }
+  std::mt19937_64 rng(20250101);
+  for (size_t run = 0; run < 20000; run++) {
+    std::vector<uint8_t> input(rng() % 1024);
+    for (uint8_t &byte : input) {
+      byte = uint8_t(rng());
+    }
+    // raw decoding needs plausible offsets and lengths now and then
+    for (size_t i = 31; i < input.size(); i += 32) {
+      if (rng() % 2 == 0) {
+        memset(&input[i - 31], 0, 31);
+        input[i] = uint8_t(rng() % 256);
+      }
+    }
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+  }
+  return 0;
+}
+#endif
@@ -207,6 +207,11 @@ private:
 
 void clear_mock_storage() { MockStorageHolder::getInstance()->clear(); }
 
+// reverts so far, the mock returns from revert instead of exiting
+static int32_t mock_reverts = 0;
+
+int32_t mock_revert_count() { return mock_reverts; }
+
 static std::array<uint8_t, 32> read_bytes32_from_address(ADDRESS_UINT address) {
   std::array<uint8_t, 32> bytes;
   memcpy(bytes.data(), (uint8_t *)address, 32);
@@ -312,8 +317,9 @@ createContract(ADDRESS_UINT valueOffset, ADDRESS_UINT codeOffset,
 
 __attribute__((import_module("env"), import_name("finish"))) void
 finish(ADDRESS_UINT data_offset, int32_t length) {
-  std::cout << "wasm context finished with data: "
-            << std::string((char *)data_offset, length) << std::endl;
+  // written as is, so finishing does not allocate in the mock either
+  std::cout << "wasm context finished with data: ";
+  std::cout.write((const char *)data_offset, length) << std::endl;
   // exit the wasm context
 }
 
@@ -321,6 +327,7 @@ __attribute__((import_module("env"), import_name("revert"))) void
 revert(ADDRESS_UINT data_offset, int32_t length) {
   std::cout << "wasm context reverted with data: "
             << std::string((char *)data_offset, length) << std::endl;
+  mock_reverts++;
   // exit the wasm context with revert status
 }
 
@@ -0,0 +1,122 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "utils.hpp"
+#include "gtest/gtest.h"
+#include <contractlib/v1/contractlib.hpp>
+
+using namespace dtvm;
+
+// Every operator new of this binary is counted, so a test can tell how many
+// heap allocations a piece of code makes
+static size_t heap_allocations = 0;
+
+void *operator new(size_t size) {
+  heap_allocations++;
+  if (void *memory = malloc(size != 0 ? size : 1)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *memory) noexcept { free(memory); }
+void operator delete[](void *memory) noexcept { free(memory); }
+void operator delete(void *memory, size_t) noexcept { free(memory); }
+void operator delete[](void *memory, size_t) noexcept { free(memory); }
+
+namespace {
+
+const Address OWNER(std::string("0x112233445566778899aa112233445566778899aa"));
+
+// The return data the mock host printed, empty when nothing finished
+std::string captured_finish_data() {
+  const std::string &output = testing::internal::GetCapturedStdout();
+  const std::string prefix = "wasm context finished with data: ";
+  const size_t begin = output.find(prefix);
+  if (begin == std::string::npos) {
+    return "";
+  }
+  // the data runs to the newline the mock ends the line with
+  return output.substr(begin + prefix.size(),
+                       output.size() - 1 - begin - prefix.size());
+}
+
+std::string as_string(const std::vector<uint8_t> &data) {
+  return std::string(data.begin(), data.end());
+}
+
+} // namespace
+
+TEST(ContractTest, FinishEncodedStatic) {
+  const uint256 balance(1000);
+  // the first write to the captured stdout sets up its buffer
+  testing::internal::CaptureStdout();
+  finish_encoded(balance);
+  testing::internal::GetCapturedStdout();
+
+  testing::internal::CaptureStdout();
+  const size_t before = heap_allocations;
+  const CResult &result = finish_encoded(balance, OWNER, true);
+  EXPECT_EQ(heap_allocations, before);
+  EXPECT_EQ(captured_finish_data(),
+            as_string(abi_encode_args(balance, OWNER, true)));
+  EXPECT_TRUE(result.success());
+  EXPECT_TRUE(result.finished());
+  EXPECT_TRUE(result.data().empty());
+}
+
+TEST(ContractTest, FinishEncodedDynamic) {
+  const std::string name = "a token name longer than fifteen characters";
+  const std::vector<uint256> values = {uint256(1), uint256(2), uint256(3)};
+  testing::internal::CaptureStdout();
+  finish_encoded(name);
+  testing::internal::GetCapturedStdout();
+
+  // within the scratch buffer
+  testing::internal::CaptureStdout();
+  const size_t before = heap_allocations;
+  finish_encoded(name, values, OWNER);
+  EXPECT_EQ(heap_allocations, before);
+  EXPECT_EQ(captured_finish_data(),
+            as_string(abi_encode_args(name, values, OWNER)));
+
+  // beyond it, with the same encoding
+  const std::string large(3000, 'x');
+  testing::internal::CaptureStdout();
+  finish_encoded(large, values);
+  EXPECT_EQ(captured_finish_data(), as_string(abi_encode_args(large, values)));
+}
+
+TEST(ContractTest, ResultMovesEncoding) {
+  // the vector the encoder produced is the one the result holds
+  size_t before = heap_allocations;
+  const CResult &ok = Ok(uint256(5));
+  EXPECT_EQ(heap_allocations, before + 1);
+  EXPECT_EQ(bytesToHex(ok.data()), bytesToHex(abi_encode(uint256(5))));
+  EXPECT_FALSE(ok.finished());
+
+  std::vector<uint8_t> data = {1, 2, 3};
+  const uint8_t *buffer = data.data();
+  before = heap_allocations;
+  const CResult moved(std::move(data), false, 2);
+  EXPECT_EQ(heap_allocations, before);
+  EXPECT_EQ(moved.data().data(), buffer);
+  EXPECT_EQ(moved.ret_code(), 2);
+}
+
+TEST(ContractTest, WriteResult) {
+  const CResult &ok = Ok(uint256(5));
+  testing::internal::CaptureStdout();
+  contract::write_result(ok);
+  EXPECT_EQ(captured_finish_data(), as_string(ok.data()));
+
+  // the data of finish_encoded is not finished a second time
+  testing::internal::CaptureStdout();
+  contract::write_result(CResult::already_finished());
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+}
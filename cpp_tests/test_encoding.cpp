@@ -7,9 +7,12 @@
 #include "gtest/gtest.h"
 #include <climits>
 #include <contractlib/v1/encoding.hpp>
+#include <contractlib/v1/errors.hpp>
 
 using namespace dtvm;
 
+extern "C" int32_t mock_revert_count();
+
 TEST(TestEncoding, BasicEncodeUInts) {
   {
     // uint8 abi encoding test
@@ -254,7 +257,7 @@ TEST(TestEncoding, BasicEncodeIntsMinMaxValues) {
 
     EXPECT_EQ(
         bytesToHex(encoded),
-        "0000000000000000000000000000000000000000000000000000000000000080");
+        "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff80");
     const auto &decoded = abi_decode_all<int8_t>(encoded);
     EXPECT_EQ(decoded, value);
   }
@@ -280,7 +283,7 @@ TEST(TestEncoding, BasicEncodeIntsMinMaxValues) {
 
     EXPECT_EQ(
         bytesToHex(encoded),
-        "0000000000000000000000000000000000000000000000000000000000008000");
+        "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff8000");
     const auto &decoded = abi_decode_all<int16_t>(encoded);
     EXPECT_EQ(decoded, value);
   }
@@ -306,7 +309,7 @@ TEST(TestEncoding, BasicEncodeIntsMinMaxValues) {
 
     EXPECT_EQ(
         bytesToHex(encoded),
-        "0000000000000000000000000000000000000000000000000000000080000000");
+        "ffffffffffffffffffffffffffffffffffffffffffffffffffffffff80000000");
     const auto &decoded = abi_decode_all<int32_t>(encoded);
     EXPECT_EQ(decoded, value);
   }
@@ -332,7 +335,7 @@ TEST(TestEncoding, BasicEncodeIntsMinMaxValues) {
 
     EXPECT_EQ(
         bytesToHex(encoded),
-        "0000000000000000000000000000000000000000000000008000000000000000");
+        "ffffffffffffffffffffffffffffffffffffffffffffffff8000000000000000");
     const auto &decoded = abi_decode_all<int64_t>(encoded);
     EXPECT_EQ(decoded, value);
   }
@@ -358,7 +361,7 @@ TEST(TestEncoding, BasicEncodeIntsMinMaxValues) {
 
     EXPECT_EQ(
         bytesToHex(encoded),
-        "0000000000000000000000000000000080000000000000000000000000000000");
+        "ffffffffffffffffffffffffffffffff80000000000000000000000000000000");
     const auto &decoded = abi_decode_all<__int128_t>(encoded);
     EXPECT_EQ(decoded, value);
   }
@@ -379,6 +382,28 @@ TEST(TestEncoding, BasicEncodeIntsMinMaxValues) {
   }
 }
 
+TEST(TestEncoding, BasicEncodeInt256) {
+  {
+    // negative int256 is sign extended
+    int256 value = -2;
+    const auto &encoded = abi_encode(value);
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe");
+    const auto &decoded = abi_decode_all<int256>(encoded);
+    EXPECT_EQ(decoded, value);
+  }
+  {
+    int256 value = int256::max();
+    const auto &encoded = abi_encode(value);
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    const auto &decoded = abi_decode_all<int256>(encoded);
+    EXPECT_EQ(decoded, value);
+  }
+}
+
 TEST(TestEncoding, BasicBoolEncodingDecoding) {
   {
     // true abi encoding
@@ -478,18 +503,19 @@ TEST(TestEncoding, BasicArrayEncodingDecoding) {
     EXPECT_EQ(decoded, int32_array);
   }
   {
-    // string array encoding and decoding
+    // string array encoding and decoding, the offsets count from just after
+    // the length word
     std::vector<std::string> string_array = {"hello", "world"};
     const auto &encoded = abi_encode_vector(string_array);
     EXPECT_EQ(
         bytesToHex(encoded),
-        "0000000000000000000000000000000000000000000000000000000000000002000000"
-        "0000000000000000000000000000000000000000000000000000000060000000000000"
-        "00000000000000000000000000000000000000000000000000a0000000000000000000"
-        "000000000000000000000000000000000000000000000568656c6c6f00000000000000"
-        "0000000000000000000000000000000000000000000000000000000000000000000000"
-        "0000000000000000000000000000000005776f726c6400000000000000000000000000"
-        "0000000000000000000000000000");
+        "0000000000000000000000000000000000000000000000000000000000000002"
+        "0000000000000000000000000000000000000000000000000000000000000040"
+        "0000000000000000000000000000000000000000000000000000000000000080"
+        "0000000000000000000000000000000000000000000000000000000000000005"
+        "68656c6c6f000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000005"
+        "776f726c64000000000000000000000000000000000000000000000000000000");
     std::vector<std::string> decoded =
         abi_decode_vector_all<std::string>(encoded);
     EXPECT_EQ(decoded, string_array);
@@ -526,3 +552,559 @@ TEST(TestEncoding, BasicMultipleValueEncodingDecoding) {
     EXPECT_EQ(decoded2, addr_value);
   }
 }
+
+TEST(TestEncoding, FixedPointEncodingDecoding) {
+  // fixed-point values encode as their raw uint256/int256
+  const ufixed18 &price = ufixed18::from_raw(uint256(1234500000000000000ull));
+  EXPECT_EQ(bytesToHex(abi_encode(price)),
+            bytesToHex(abi_encode(price.to_raw())));
+  const auto &encoded = abi_encode(price);
+  uint32_t read_bytes = 0;
+  EXPECT_EQ(abi_decode<ufixed18>(encoded.data(),
+                                 encoded.data() + encoded.size(), read_bytes),
+            price);
+  EXPECT_EQ(read_bytes, 32u);
+
+  const sfixed18 &delta = sfixed18::from_raw(int256(-2500000000000000000ll));
+  EXPECT_EQ(bytesToHex(abi_encode(delta)),
+            bytesToHex(abi_encode(delta.to_raw())));
+  const auto &signed_encoded = abi_encode(delta);
+  EXPECT_EQ(abi_decode<sfixed18>(signed_encoded.data(),
+                                 signed_encoded.data() + signed_encoded.size(),
+                                 read_bytes),
+            delta);
+}
+
+TEST(TestEncoding, AbiWriterTupleEncoding) {
+  const Address from("0x112233445566778899aa112233445566778899aa");
+  const Address to("0xaabbccddeeff00112233445566778899aabbccdd");
+  const uint256 amount(1000);
+  {
+    // Transfer(address,address,uint256) event data, all static
+    static_assert(abi_static_encoded_size<Address, Address, uint256>() == 96,
+                  "");
+    const auto &encoded = abi_encode_args(from, to, amount);
+    EXPECT_EQ(encoded.size(), 96u);
+    EXPECT_EQ(encoded.capacity(), encoded.size());
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "000000000000000000000000112233445566778899aa112233445566778899aa"
+        "000000000000000000000000aabbccddeeff00112233445566778899aabbccdd"
+        "00000000000000000000000000000000000000000000000000000000000003e8");
+    EXPECT_EQ(bytesToHex(abi_encode(std::make_tuple(from, to, amount))),
+              bytesToHex(encoded));
+  }
+  {
+    // two dynamic values: the offsets count from the start of the heads
+    const std::string name = "hello";
+    const auto &encoded = abi_encode_args(name, amount, "world");
+    EXPECT_EQ(abi_encoded_size(name, amount, "world"), 224u);
+    EXPECT_EQ(encoded.capacity(), encoded.size());
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "0000000000000000000000000000000000000000000000000000000000000060"
+        "00000000000000000000000000000000000000000000000000000000000003e8"
+        "00000000000000000000000000000000000000000000000000000000000000a0"
+        "0000000000000000000000000000000000000000000000000000000000000005"
+        "68656c6c6f000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000005"
+        "776f726c64000000000000000000000000000000000000000000000000000000");
+  }
+  {
+    // selector then arguments, in one allocation
+    const auto &encoded = abi_encode_call(0xa9059cbb, to, amount);
+    EXPECT_EQ(encoded.capacity(), encoded.size());
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "a9059cbb"
+        "000000000000000000000000aabbccddeeff00112233445566778899aabbccdd"
+        "00000000000000000000000000000000000000000000000000000000000003e8");
+    EXPECT_EQ(bytesToHex(abi_encode_call(0x18160ddd)), "18160ddd");
+
+    // write_call is write_selector then write_tuple, also after other writes
+    const std::string name = "hello";
+    AbiWriter separate;
+    separate.write_value(amount).write_selector(0x12345678).write_tuple(name,
+                                                                        to);
+    AbiWriter combined;
+    combined.write_value(amount).write_call(0x12345678, name, to);
+    EXPECT_EQ(bytesToHex(combined.data()), bytesToHex(separate.data()));
+  }
+}
+
+TEST(TestEncoding, AbiWriterValueEncoding) {
+  // write_value matches abi_encode of the single value
+  const std::string long_str = "hello worldhello worldhello worldhello world";
+  EXPECT_EQ(bytesToHex(AbiWriter().write_value(long_str).data()),
+            bytesToHex(abi_encode(long_str)));
+  EXPECT_EQ(bytesToHex(AbiWriter().write_value("call failed").data()),
+            bytesToHex(abi_encode(std::string("call failed"))));
+  EXPECT_EQ(bytesToHex(AbiWriter().write_value(int16_t(-2)).data()),
+            bytesToHex(abi_encode(int16_t(-2))));
+  EXPECT_EQ(bytesToHex(AbiWriter().write_value(int256(-2)).data()),
+            bytesToHex(abi_encode(int256(-2))));
+  EXPECT_EQ(bytesToHex(AbiWriter().write_value(true).data()),
+            bytesToHex(abi_encode(uint8_t(1))));
+
+  // values append to the same buffer
+  AbiWriter writer;
+  writer.write_value(uint256(1)).write_value(std::make_tuple(uint256(2)));
+  EXPECT_EQ(writer.size(), 64u);
+  const auto &taken = writer.take();
+  EXPECT_EQ(taken.size(), 64u);
+  EXPECT_EQ(writer.size(), 0u);
+}
+
+TEST(TestEncoding, ZeroCopyBytesViewDecoding) {
+  const std::string origin_str = "hello worldhello worldhello worldhello world";
+  const auto &encoded = abi_encode(origin_str);
+  const uint8_t *begin = encoded.data();
+  const uint8_t *end = encoded.data() + encoded.size();
+  {
+    // the views point straight into the encoded buffer
+    uint32_t read_bytes = 0;
+    const BytesView &view = abi_decode<BytesView>(begin, end, read_bytes);
+    EXPECT_EQ(read_bytes, encoded.size());
+    EXPECT_EQ(view.data(), begin + 32);
+    EXPECT_EQ(view.size(), origin_str.size());
+    EXPECT_EQ(std::string(view.as_string_view()), origin_str);
+    EXPECT_EQ(view.to_vector(), std::vector<uint8_t>(origin_str.begin(),
+                                                     origin_str.end()));
+
+    const std::string_view &str = abi_decode<std::string_view>(begin, end,
+                                                               read_bytes);
+    EXPECT_EQ((const uint8_t *)str.data(), begin + 32);
+    EXPECT_EQ(str, origin_str);
+    EXPECT_EQ(abi_decode<std::string>(begin, end, read_bytes), origin_str);
+  }
+  {
+    // views encode like the owning types
+    const BytesView view(encoded.data() + 32, origin_str.size());
+    EXPECT_EQ(bytesToHex(abi_encode_args(view, uint256(1))),
+              bytesToHex(abi_encode_args(origin_str, uint256(1))));
+    EXPECT_EQ(bytesToHex(abi_encode_args(view.as_string_view())),
+              bytesToHex(abi_encode_args(origin_str)));
+    EXPECT_EQ(bytesToHex(abi_encode_args(BytesView())),
+              bytesToHex(abi_encode_args(std::string())));
+  }
+  {
+    // string views in a vector
+    const auto &encoded_array =
+        abi_encode_vector(std::vector<std::string>{"hello", "world"});
+    const auto &views =
+        abi_decode_vector_all<std::string_view>(encoded_array);
+    ASSERT_EQ(views.size(), 2u);
+    EXPECT_EQ(views[0], "hello");
+    EXPECT_EQ(views[1], "world");
+  }
+}
+
+TEST(TestEncoding, BytesViewDecodingBoundsChecks) {
+  const auto &encoded = abi_encode(std::string("hello"));
+  uint32_t read_bytes = 0;
+  // content cut short
+  testing::internal::CaptureStdout();
+  abi_decode<BytesView>(encoded.data(), encoded.data() + encoded.size() - 1,
+                        read_bytes);
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+  // a length word far beyond the data must not wrap around
+  std::vector<uint8_t> huge_length(64, 0xff);
+  testing::internal::CaptureStdout();
+  const BytesView &view = abi_decode<BytesView>(
+      huge_length.data(), huge_length.data() + huge_length.size(), read_bytes);
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+  EXPECT_TRUE(view.empty());
+}
+
+TEST(TestEncoding, FixedBytesEncodingDecoding) {
+  // bytesN is left aligned and padded on the right
+  const std::array<uint8_t, 4> selector = {0xa9, 0x05, 0x9c, 0xbb};
+  const auto &encoded = abi_encode_args(selector);
+  EXPECT_EQ(
+      bytesToHex(encoded),
+      "a9059cbb00000000000000000000000000000000000000000000000000000000");
+  uint32_t read_bytes = 0;
+  EXPECT_EQ((abi_decode<std::array<uint8_t, 4>>(
+                encoded.data(), encoded.data() + encoded.size(), read_bytes)),
+            selector);
+  EXPECT_EQ(read_bytes, 32u);
+
+  bytes32 hash;
+  for (size_t i = 0; i < hash.size(); i++) {
+    hash[i] = uint8_t(i);
+  }
+  static_assert(abi_static_encoded_size<bytes32, uint256>() == 64, "");
+  const auto &args = abi_encode_args(hash, uint256(1));
+  EXPECT_EQ(std::vector<uint8_t>(args.begin(), args.begin() + 32),
+            std::vector<uint8_t>(hash.begin(), hash.end()));
+  EXPECT_EQ(std::get<0>(abi_decode_args<bytes32, uint256>(
+                args.data(), args.data() + args.size())),
+            hash);
+
+  // dynamic bytes
+  const Bytes bytes(std::vector<uint8_t>{0xde, 0xad, 0xbe, 0xef});
+  const auto &encoded_bytes = abi_encode(bytes);
+  EXPECT_EQ(
+      bytesToHex(encoded_bytes),
+      "0000000000000000000000000000000000000000000000000000000000000004"
+      "deadbeef00000000000000000000000000000000000000000000000000000000");
+  EXPECT_EQ(abi_decode_all<Bytes>(encoded_bytes).bytes(), bytes.bytes());
+}
+
+TEST(TestEncoding, NestedArrayEncodingDecoding) {
+  {
+    // uint256[2] is static and encoded in place
+    const std::array<uint256, 2> pair = {uint256(1), uint256(2)};
+    static_assert(
+        abi_static_encoded_size<std::array<uint256, 2>, uint256>() == 96, "");
+    const auto &encoded = abi_encode_args(pair, uint256(3));
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "0000000000000000000000000000000000000000000000000000000000000001"
+        "0000000000000000000000000000000000000000000000000000000000000002"
+        "0000000000000000000000000000000000000000000000000000000000000003");
+    const auto &decoded = abi_decode_args<std::array<uint256, 2>, uint256>(
+        encoded.data(), encoded.data() + encoded.size());
+    EXPECT_EQ(std::get<0>(decoded), pair);
+    EXPECT_EQ(std::get<1>(decoded), uint256(3));
+  }
+  {
+    // string[2] is dynamic, a tuple of two strings
+    const std::array<std::string, 2> pair = {"hello", "world"};
+    const auto &encoded = abi_encode_args(pair);
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "0000000000000000000000000000000000000000000000000000000000000020"
+        "0000000000000000000000000000000000000000000000000000000000000040"
+        "0000000000000000000000000000000000000000000000000000000000000080"
+        "0000000000000000000000000000000000000000000000000000000000000005"
+        "68656c6c6f000000000000000000000000000000000000000000000000000000"
+        "0000000000000000000000000000000000000000000000000000000000000005"
+        "776f726c64000000000000000000000000000000000000000000000000000000");
+    EXPECT_EQ(std::get<0>(abi_decode_args<std::array<std::string, 2>>(
+                  encoded.data(), encoded.data() + encoded.size())),
+              pair);
+  }
+  {
+    // uint256[][]
+    const std::vector<std::vector<uint256>> nested = {
+        {uint256(1), uint256(2)}, {uint256(3)}};
+    const auto &encoded = abi_encode_args(nested);
+    EXPECT_EQ(abi_encoded_size(nested), encoded.size());
+    EXPECT_EQ(
+        bytesToHex(encoded),
+        "0000000000000000000000000000000000000000000000000000000000000020"
+        "0000000000000000000000000000000000000000000000000000000000000002"
+        "0000000000000000000000000000000000000000000000000000000000000040"
+        "00000000000000000000000000000000000000000000000000000000000000a0"
+        "0000000000000000000000000000000000000000000000000000000000000002"
+        "0000000000000000000000000000000000000000000000000000000000000001"
+        "0000000000000000000000000000000000000000000000000000000000000002"
+        "0000000000000000000000000000000000000000000000000000000000000001"
+        "0000000000000000000000000000000000000000000000000000000000000003");
+    EXPECT_EQ(std::get<0>(abi_decode_args<std::vector<std::vector<uint256>>>(
+                  encoded.data(), encoded.data() + encoded.size())),
+              nested);
+  }
+}
+
+TEST(TestEncoding, TupleEncodingDecoding) {
+  // (uint256,string) is dynamic, so its head is an offset
+  const auto &inner = std::make_tuple(uint256(1), std::string("hi"));
+  const auto &encoded = abi_encode_args(inner, uint256(7));
+  EXPECT_EQ(
+      bytesToHex(encoded),
+      "0000000000000000000000000000000000000000000000000000000000000040"
+      "0000000000000000000000000000000000000000000000000000000000000007"
+      "0000000000000000000000000000000000000000000000000000000000000001"
+      "0000000000000000000000000000000000000000000000000000000000000040"
+      "0000000000000000000000000000000000000000000000000000000000000002"
+      "6869000000000000000000000000000000000000000000000000000000000000");
+  const auto &decoded =
+      abi_decode_args<std::tuple<uint256, std::string>, uint256>(
+          encoded.data(), encoded.data() + encoded.size());
+  EXPECT_EQ(std::get<0>(decoded), inner);
+  EXPECT_EQ(std::get<1>(decoded), uint256(7));
+
+  // a static struct is inline, like its members one after another
+  const Address owner("0x112233445566778899aa112233445566778899aa");
+  EXPECT_EQ(bytesToHex(abi_encode_args(std::make_tuple(owner, true),
+                                       uint256(5))),
+            bytesToHex(abi_encode_args(owner, true, uint256(5))));
+  std::vector<std::tuple<Address, uint256>> entries = {
+      {owner, uint256(1)}, {owner, uint256(2)}};
+  EXPECT_EQ((abi_decode_all<std::vector<std::tuple<Address, uint256>>>(
+                abi_encode(entries))),
+            entries);
+}
+
+TEST(TestEncoding, NestedDecodingBoundsChecks) {
+  // a length far beyond the data reverts before anything is allocated
+  std::vector<uint8_t> huge_length(64, 0);
+  memset(huge_length.data(), 0xff, 32);
+  uint32_t read_bytes = 0;
+  testing::internal::CaptureStdout();
+  const auto &decoded = abi_decode<std::vector<uint256>>(
+      huge_length.data(), huge_length.data() + huge_length.size(), read_bytes);
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+  EXPECT_TRUE(decoded.empty());
+
+  // an element offset past the end of the data
+  auto encoded = abi_encode_args(std::string("hello"));
+  encoded[31] = 0xff;
+  testing::internal::CaptureStdout();
+  abi_decode_args<std::string>(encoded.data(), encoded.data() + encoded.size());
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+
+  // a word cut short reverts without reading past the data
+  const std::vector<uint8_t> half_word(16, 0xff);
+  const uint8_t *half_word_end = half_word.data() + half_word.size();
+  testing::internal::CaptureStdout();
+  EXPECT_EQ(abi_decode<uint256>(half_word.data(), half_word_end, read_bytes),
+            uint256(0));
+  EXPECT_EQ(abi_decode<int256>(half_word.data(), half_word_end, read_bytes),
+            int256(0));
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+}
+
+TEST(TestEncoding, PackedEncoding) {
+  // the example of the solidity abi specification
+  const std::array<uint8_t, 1> b1 = {0x42};
+  const auto &packed =
+      abi_encode_packed(int16_t(-1), b1, uint16_t(3), "Hello, world!");
+  EXPECT_EQ(abi_packed_size(int16_t(-1), b1, uint16_t(3), "Hello, world!"),
+            18u);
+  EXPECT_EQ(bytesToHex(packed), "ffff42000348656c6c6f2c20776f726c6421");
+
+  // fixed size arguments are packed into a std::array
+  const Address owner("0x112233445566778899aa112233445566778899aa");
+  const auto &fixed = abi_encode_packed(uint8_t(0xff), owner, uint256(1));
+  static_assert(std::is_same<std::decay_t<decltype(fixed)>,
+                             std::array<uint8_t, 53>>::value,
+                "");
+  EXPECT_EQ(bytesToHex(std::vector<uint8_t>(fixed.begin(), fixed.end())),
+            "ff112233445566778899aa112233445566778899aa"
+            "0000000000000000000000000000000000000000000000000000000000000001");
+
+  // array elements are padded to 32 bytes, signed values sign extended
+  EXPECT_EQ(
+      bytesToHex(abi_encode_packed(std::vector<int8_t>{-1, 2}, true)),
+      "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+      "0000000000000000000000000000000000000000000000000000000000000002"
+      "01");
+  const auto &words = abi_encode_packed(std::array<Address, 1>{owner});
+  EXPECT_EQ(bytesToHex(std::vector<uint8_t>(words.begin(), words.end())),
+            "000000000000000000000000112233445566778899aa112233445566778899aa");
+
+  // keccak256_packed hashes the same bytes
+  const std::string long_str(300, 'a');
+  EXPECT_EQ(keccak256_packed(long_str, uint32_t(7)),
+            hostio::keccak256(abi_encode_packed(long_str, uint32_t(7))));
+  EXPECT_EQ(keccak256_packed(int16_t(-1), b1, uint16_t(3), "Hello, world!"),
+            hostio::keccak256(packed));
+  EXPECT_EQ(keccak256_packed(uint8_t(0xff), owner, uint256(1)),
+            hostio::keccak256(fixed.data(), fixed.size()));
+  // raw bytes go in as Bytes, a std::vector<uint8_t> does not compile
+  const std::vector<uint8_t> raw = {1, 2, 3};
+  EXPECT_EQ(keccak256_packed(Bytes(raw)), hostio::keccak256(raw));
+}
+
+TEST(TestEncoding, CanonicalValueChecks) {
+  // the checks behind strict mode, see test_encoding_strict.cpp
+  std::vector<uint8_t> word(32, 0);
+  word[31] = 0xfe;
+  EXPECT_TRUE(detail::abi_integer_is_canonical<uint8_t>(word.data()));
+  EXPECT_FALSE(detail::abi_bool_is_canonical(word.data()));
+  EXPECT_FALSE(detail::abi_integer_is_canonical<int8_t>(word.data()));
+  word[30] = 1;
+  EXPECT_FALSE(detail::abi_integer_is_canonical<uint8_t>(word.data()));
+  EXPECT_TRUE(detail::abi_integer_is_canonical<uint16_t>(word.data()));
+  // dirty byte in the first limb
+  word[3] = 1;
+  EXPECT_FALSE(detail::abi_integer_is_canonical<uint64_t>(word.data()));
+  EXPECT_FALSE(detail::abi_address_is_canonical(word.data()));
+  EXPECT_FALSE(detail::abi_integer_is_canonical<__uint128_t>(word.data()));
+
+  // negative values are sign extended
+  std::vector<uint8_t> minus_two(32, 0xff);
+  minus_two[31] = 0xfe;
+  EXPECT_TRUE(detail::abi_integer_is_canonical<int8_t>(minus_two.data()));
+  EXPECT_TRUE(detail::abi_integer_is_canonical<int64_t>(minus_two.data()));
+  EXPECT_FALSE(detail::abi_integer_is_canonical<uint64_t>(minus_two.data()));
+  minus_two[0] = 0x7f;
+  EXPECT_FALSE(detail::abi_integer_is_canonical<int64_t>(minus_two.data()));
+
+  // bytesN is followed by zeros
+  std::vector<uint8_t> selector(32, 0);
+  selector[0] = 0xa9;
+  selector[3] = 0xbb;
+  EXPECT_TRUE(detail::abi_fixed_bytes_is_canonical<4>(selector.data()));
+  selector[4] = 1;
+  EXPECT_FALSE(detail::abi_fixed_bytes_is_canonical<4>(selector.data()));
+  EXPECT_TRUE(detail::abi_fixed_bytes_is_canonical<5>(selector.data()));
+
+  // the default mode stays lenient
+  uint32_t read_bytes = 0;
+  EXPECT_EQ(abi_decode<uint8_t>(word.data(), word.data() + 32, read_bytes),
+            0xfe);
+  EXPECT_TRUE(abi_decode<bool>(word.data(), word.data() + 32, read_bytes));
+  // and encodes exactly like strict mode, negative values sign extended
+  EXPECT_EQ(bytesToHex(abi_encode(int16_t(-2))),
+            "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe");
+  EXPECT_EQ(bytesToHex(abi_encode_args(int64_t(-3), uint8_t(5))),
+            "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffd"
+            "0000000000000000000000000000000000000000000000000000000000000005");
+  // the zero padded form older encoders produced still decodes
+  std::vector<uint8_t> zero_padded(32, 0);
+  zero_padded[30] = 0xff;
+  zero_padded[31] = 0xfe;
+  EXPECT_EQ(abi_decode<int16_t>(zero_padded.data(), zero_padded.data() + 32,
+                                read_bytes),
+            -2);
+}
+
+namespace {
+
+struct Order {
+  Address maker;
+  uint256 amount;
+  uint64_t expiry;
+};
+DTVM_ABI_STRUCT(Order, maker, amount, expiry)
+
+struct Listing {
+  std::string name;
+  Order order;
+  std::vector<uint16_t> tags;
+};
+DTVM_ABI_STRUCT(Listing, name, order, tags)
+
+} // namespace
+
+TEST(TestEncoding, StructEncodingDecoding) {
+  const Address maker("0x112233445566778899aa112233445566778899aa");
+  const Order order{maker, uint256(1000), 1700000000};
+  const auto &as_tuple =
+      std::make_tuple(maker, uint256(1000), uint64_t(1700000000));
+  EXPECT_FALSE(detail::AbiType<Order>::DYNAMIC);
+  EXPECT_EQ(abi_static_encoded_size<Order>(), size_t(96));
+  EXPECT_EQ(bytesToHex(abi_encode(order)), bytesToHex(abi_encode(as_tuple)));
+  EXPECT_EQ(bytesToHex(abi_encode_args(order, true)),
+            bytesToHex(abi_encode_args(as_tuple, true)));
+
+  const auto &decoded = abi_decode_all<Order>(abi_encode(order));
+  EXPECT_EQ(decoded.maker, maker);
+  EXPECT_EQ(decoded.amount, uint256(1000));
+  EXPECT_EQ(decoded.expiry, uint64_t(1700000000));
+
+  // a dynamic member makes the struct dynamic, nested structs are inline
+  const Listing listing{"ask", order, {3, 4}};
+  const auto &listing_tuple = std::make_tuple(
+      std::string("ask"), as_tuple, std::vector<uint16_t>{3, 4});
+  EXPECT_TRUE(detail::AbiType<Listing>::DYNAMIC);
+  EXPECT_EQ(bytesToHex(abi_encode_args(listing, uint256(9))),
+            bytesToHex(abi_encode_args(listing_tuple, uint256(9))));
+
+  const std::vector<Listing> listings = {listing, {"bid", order, {}}};
+  const auto &encoded = abi_encode_args(listings);
+  const auto &decoded_args = abi_decode_args<std::vector<Listing>>(
+      encoded.data(), encoded.data() + encoded.size());
+  const auto &decoded_listings = std::get<0>(decoded_args);
+  ASSERT_EQ(decoded_listings.size(), size_t(2));
+  EXPECT_EQ(decoded_listings[0].name, "ask");
+  EXPECT_EQ(decoded_listings[0].order.maker, maker);
+  EXPECT_EQ(decoded_listings[0].tags, (std::vector<uint16_t>{3, 4}));
+  EXPECT_EQ(decoded_listings[1].name, "bid");
+  EXPECT_EQ(decoded_listings[1].order.expiry, uint64_t(1700000000));
+  EXPECT_TRUE(decoded_listings[1].tags.empty());
+}
+
+namespace {
+
+DTVM_ERROR(InsufficientBalance, uint256, uint256)
+DTVM_ERROR(Unauthorized)
+DTVM_ERROR(BadRate, ufixed18)
+DTVM_ERROR(OrderExpired, Order, std::vector<std::string>)
+
+static_assert(abi_signature<uint256, Address>("f").view() ==
+                  "f(uint256,address)",
+              "abi_signature of value types");
+static_assert(abi_signature<int8_t, bytes32, std::array<uint16_t, 3>,
+                            std::vector<bool>>("g")
+                      .view() == "g(int8,bytes32,uint16[3],bool[])",
+              "abi_signature of arrays");
+static_assert(abi_signature<Order, std::vector<std::string>>("OrderExpired")
+                      .view() ==
+                  "OrderExpired((address,uint256,uint64),string[])",
+              "abi_signature of a struct");
+static_assert(abi_signature<ufixed18, sfixed18>("rate").view() ==
+                  "rate(uint256,int256)",
+              "abi_signature of fixed point numbers");
+static_assert(abi_signature<>("pause").view() == "pause()",
+              "abi_signature without arguments");
+static_assert(ERROR_STRING_SELECTOR == 0x08c379a0, "Error(string)");
+static_assert(InsufficientBalance::SELECTOR == 0xcf479181,
+              "InsufficientBalance(uint256,uint256)");
+static_assert(Unauthorized::SELECTOR == 0x82b42900, "Unauthorized()");
+static_assert(OrderExpired::SELECTOR == 0xb252ab42,
+              "OrderExpired((address,uint256,uint64),string[])");
+static_assert(is_custom_error_v<Unauthorized> && !is_custom_error_v<uint256>,
+              "is_custom_error_v");
+
+// the revert data the mock host printed, empty when it did not revert
+std::string captured_revert_data(int32_t reverts_before) {
+  const std::string &output = testing::internal::GetCapturedStdout();
+  const std::string prefix = "wasm context reverted with data: ";
+  const size_t begin = output.find(prefix);
+  if (mock_revert_count() == reverts_before || begin == std::string::npos) {
+    return "";
+  }
+  // the data runs to the newline the mock ends the line with
+  return output.substr(begin + prefix.size(),
+                       output.size() - 1 - begin - prefix.size());
+}
+
+} // namespace
+
+TEST(TestEncoding, CustomErrors) {
+  const InsufficientBalance error(uint256(5), uint256(7));
+  const auto &encoded = error.encode();
+  EXPECT_EQ(bytesToHex(encoded),
+            "cf479181"
+            "0000000000000000000000000000000000000000000000000000000000000005"
+            "0000000000000000000000000000000000000000000000000000000000000007");
+  EXPECT_EQ(bytesToHex(Unauthorized().encode()), "82b42900");
+  EXPECT_EQ(BadRate::SELECTOR, function_selector("BadRate(uint256)"));
+  EXPECT_EQ(bytesToHex(BadRate(ufixed18::from_raw(uint256(5))).encode()),
+            bytesToHex(abi_encode_call(BadRate::SELECTOR, uint256(5))));
+  const Order order{Address(), uint256(1), 2};
+  EXPECT_EQ(bytesToHex(OrderExpired(order, {"late"}).encode()),
+            bytesToHex(abi_encode_call(
+                0xb252ab42, order, std::vector<std::string>{"late"})));
+
+  // the stack built revert data of static arguments is encode()
+  int32_t reverts = mock_revert_count();
+  testing::internal::CaptureStdout();
+  error.revert();
+  EXPECT_EQ(captured_revert_data(reverts),
+            std::string(encoded.begin(), encoded.end()));
+
+  reverts = mock_revert_count();
+  testing::internal::CaptureStdout();
+  OrderExpired(order, {"late"}).revert();
+  EXPECT_FALSE(captured_revert_data(reverts).empty());
+
+  // Error(string) as solidity's require(false, "not owner") reverts
+  const auto &message = abi_encode_call(0x08c379a0, std::string("not owner"));
+  reverts = mock_revert_count();
+  testing::internal::CaptureStdout();
+  revert_with_message("not owner");
+  EXPECT_EQ(captured_revert_data(reverts),
+            std::string(message.begin(), message.end()));
+  EXPECT_EQ(message.size(), size_t(100));
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <iostream>
+
+#include "utils.hpp"
+#include "gtest/gtest.h"
+
+#define DTVM_ABI_STRICT 1
+#include <contractlib/v1/encoding.hpp>
+
+using namespace dtvm;
+
+namespace {
+
+// Decodes T from word and tells whether that reverted
+template <typename T> bool decode_reverts(const std::vector<uint8_t> &word) {
+  uint32_t read_bytes = 0;
+  testing::internal::CaptureStdout();
+  abi_decode<T>(word.data(), word.data() + word.size(), read_bytes);
+  return testing::internal::GetCapturedStdout().find("reverted") !=
+         std::string::npos;
+}
+
+std::vector<uint8_t> word_with_low_byte(uint8_t low) {
+  std::vector<uint8_t> word(32, 0);
+  word[31] = low;
+  return word;
+}
+
+} // namespace
+
+TEST(StrictEncoding, CanonicalValuesDecode) {
+  EXPECT_FALSE(decode_reverts<bool>(word_with_low_byte(1)));
+  EXPECT_FALSE(decode_reverts<uint8_t>(word_with_low_byte(0xff)));
+  EXPECT_FALSE(decode_reverts<Address>(abi_encode(
+      Address("0x112233445566778899aa112233445566778899aa"))));
+  EXPECT_FALSE(decode_reverts<int16_t>(abi_encode(int16_t(-2))));
+
+  // negative values round trip sign extended
+  const auto &encoded = abi_encode_args(int16_t(-2), int64_t(-3));
+  EXPECT_EQ(bytesToHex(std::vector<uint8_t>(encoded.begin(),
+                                            encoded.begin() + 32)),
+            "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe");
+  const auto &decoded = abi_decode_args<int16_t, int64_t>(
+      encoded.data(), encoded.data() + encoded.size());
+  EXPECT_EQ(std::get<0>(decoded), -2);
+  EXPECT_EQ(std::get<1>(decoded), -3);
+}
+
+TEST(StrictEncoding, NonCanonicalValuesRevert) {
+  // bools other than 0 and 1
+  EXPECT_TRUE(decode_reverts<bool>(word_with_low_byte(2)));
+  // integers wider than their type
+  std::vector<uint8_t> wide = word_with_low_byte(1);
+  wide[30] = 1;
+  EXPECT_TRUE(decode_reverts<uint8_t>(wide));
+  EXPECT_FALSE(decode_reverts<uint16_t>(wide));
+  wide[0] = 1;
+  EXPECT_TRUE(decode_reverts<uint64_t>(wide));
+  EXPECT_TRUE(decode_reverts<__uint128_t>(wide));
+  EXPECT_FALSE(decode_reverts<uint256>(wide));
+  // a negative value that is not sign extended
+  EXPECT_TRUE(decode_reverts<int8_t>(word_with_low_byte(0xfe)));
+  // dirty address bytes
+  EXPECT_TRUE(decode_reverts<Address>(wide));
+  // bytes4 with bytes after the fourth
+  std::vector<uint8_t> selector(32, 0);
+  selector[0] = 0xa9;
+  selector[4] = 1;
+  EXPECT_TRUE((decode_reverts<std::array<uint8_t, 4>>(selector)));
+  EXPECT_FALSE(decode_reverts<bytes32>(selector));
+  // elements of arrays are checked too
+  EXPECT_FALSE(decode_reverts<std::vector<bool>>(
+      abi_encode(std::vector<uint256>{uint256(0), uint256(1)})));
+  EXPECT_TRUE(decode_reverts<std::vector<bool>>(
+      abi_encode(std::vector<uint256>{uint256(1), uint256(2)})));
+}
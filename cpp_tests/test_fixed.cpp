@@ -0,0 +1,181 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <iostream>
+
+#include "utils.hpp"
+#include "gtest/gtest.h"
+#include <contractlib/v1/fixed.hpp>
+
+using namespace dtvm;
+
+namespace {
+
+ufixed18 ud(const uint256 &raw) { return ufixed18::from_raw(raw); }
+
+sfixed18 sd(const int256 &raw) { return sfixed18::from_raw(raw); }
+
+// |actual - expected| <= expected / 10^15, the expected values are exact
+// floors computed with 120 digits
+void expect_close(const uint256 &actual, const uint256 &expected) {
+  const uint256 &diff =
+      actual > expected ? actual - expected : expected - actual;
+  EXPECT_LE(diff * 1000000000000000_u256, expected)
+      << "actual " << uint64_t(actual.low) << " expected "
+      << uint64_t(expected.low);
+}
+
+bool reverted(const std::string &output) {
+  return output.find("wasm context reverted") != std::string::npos;
+}
+
+} // namespace
+
+TEST(FixedTest, UFixed18Arithmetic) {
+  static_assert(ufixed18::from_integer(3_u256).to_raw() ==
+                    3000000000000000000_u256,
+                "");
+  const ufixed18 &a = ud(1500000000000000000_u256); // 1.5
+  const ufixed18 &b = ud(2250000000000000000_u256); // 2.25
+  EXPECT_EQ((a * b).to_raw(), 3375000000000000000_u256);
+  EXPECT_EQ((a + b).to_raw(), 3750000000000000000_u256);
+  EXPECT_EQ((b - a).to_raw(), 750000000000000000_u256);
+  EXPECT_EQ((ufixed18::unit() / ufixed18::from_integer(3_u256)).to_raw(),
+            333333333333333333_u256);
+  EXPECT_EQ((b / a).to_raw(), 1500000000000000000_u256);
+  EXPECT_EQ((a * b).to_integer(), 3_u256);
+
+  // the 512-bit intermediate: (max / 2) * 2 does not overflow early
+  const ufixed18 &half_max = ud(uint256::max() / 2_u256);
+  EXPECT_EQ((half_max * ufixed18::from_integer(2_u256)).to_raw(),
+            uint256::max() - 1_u256);
+  EXPECT_EQ((half_max / ufixed18::from_integer(2_u256)).to_raw(),
+            uint256::max() / 4_u256);
+
+  testing::internal::CaptureStdout();
+  a - b;
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+  testing::internal::CaptureStdout();
+  ud(uint256::max()) * ufixed18::from_integer(2_u256);
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+}
+
+TEST(FixedTest, UFixed18ExpLog) {
+  const ufixed18 &one = ufixed18::unit();
+  EXPECT_EQ(exp2(ufixed18()), one);
+  EXPECT_EQ(exp2(one).to_raw(), 2000000000000000000_u256);
+  EXPECT_EQ(exp2(ufixed18::from_integer(64_u256)).to_raw(),
+            18446744073709551616000000000000000000_u256);
+  expect_close(exp2(ud(500000000000000000_u256)).to_raw(),
+               1414213562373095048_u256);
+  expect_close(
+      exp2(ud(191500000000000000000_u256)).to_raw(),
+      4438581203289767414339175591698529914022621046959442208844926142485233141591_u256);
+  expect_close(exp(one).to_raw(), 2718281828459045235_u256);
+  expect_close(
+      exp(ufixed18::from_integer(100_u256)).to_raw(),
+      26881171418161354484126255515800135873611118773741922415191608_u256);
+
+  EXPECT_EQ(log2(one), ufixed18());
+  EXPECT_EQ(log2(ufixed18::from_integer(8_u256)).to_raw(),
+            3000000000000000000_u256);
+  expect_close(log2(ud(1500000000000000000_u256)).to_raw(),
+               584962500721156181_u256);
+  EXPECT_EQ(ln(ufixed18::from_integer(2_u256)).to_raw(),
+            693147180559945309_u256);
+  expect_close(ln(ufixed18::from_integer(10_u256)).to_raw(),
+               2302585092994045684_u256);
+
+  testing::internal::CaptureStdout();
+  log2(ud(500000000000000000_u256));
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+  testing::internal::CaptureStdout();
+  exp2(ufixed18::from_integer(192_u256));
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+}
+
+TEST(FixedTest, UFixed18PowSqrt) {
+  const ufixed18 &one = ufixed18::unit();
+  const ufixed18 &two = ufixed18::from_integer(2_u256);
+  EXPECT_EQ(sqrt(two).to_raw(), 1414213562373095048_u256);
+  EXPECT_EQ(sqrt(ufixed18::from_integer(144_u256)),
+            ufixed18::from_integer(12_u256));
+  EXPECT_EQ(sqrt(ufixed18()), ufixed18());
+  testing::internal::CaptureStdout();
+  sqrt(ud(uint256::max()));
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+
+  EXPECT_EQ(pow(ufixed18(), ufixed18()), one);
+  EXPECT_EQ(pow(ufixed18(), two), ufixed18());
+  EXPECT_EQ(pow(two, one), two);
+  EXPECT_EQ(pow(one, two), one);
+  expect_close(pow(two, ud(500000000000000000_u256)).to_raw(),
+               1414213562373095048_u256);
+  // bases below one go through the reciprocal
+  expect_close(pow(ud(500000000000000000_u256), ud(2500000000000000000_u256))
+                   .to_raw(),
+               176776695296636881_u256);
+  expect_close(
+      pow(ud(1080000000000000000_u256), ud(30500000000000000000_u256))
+          .to_raw(),
+      10457419794604896674_u256);
+
+  EXPECT_EQ(powu(ud(1100000000000000000_u256), 10_u256).to_raw(),
+            2593742460100000000_u256);
+  EXPECT_EQ(powu(two, 0_u256), one);
+  EXPECT_EQ(powu(two, 100_u256).to_integer(),
+            1267650600228229401496703205376_u256);
+}
+
+TEST(FixedTest, SFixed18) {
+  const sfixed18 &one = sfixed18::unit();
+  const sfixed18 &minus_one_half = sd(int256(-1500000000000000000ll));
+  const sfixed18 &two = sfixed18::from_integer(int256(2));
+  EXPECT_EQ((minus_one_half * two).to_raw(), int256(-3000000000000000000ll));
+  EXPECT_EQ((minus_one_half * -two).to_raw(), int256(3000000000000000000ll));
+  EXPECT_EQ((minus_one_half / two).to_raw(), int256(-750000000000000000ll));
+  EXPECT_EQ((minus_one_half + two).to_raw(), int256(500000000000000000ll));
+  EXPECT_EQ((minus_one_half - two).to_raw(), int256(-3500000000000000000ll));
+  EXPECT_EQ(minus_one_half.to_integer(), int256(-1));
+  EXPECT_EQ(sfixed18::from_integer(int256(-7)).to_raw(),
+            int256(-7000000000000000000ll));
+
+  expect_close(exp(-one).to_raw().abs(), 367879441171442321_u256);
+  expect_close(exp(-sd(int256(10500000000000000000ull))).to_raw().abs(),
+               27536449349747_u256);
+  EXPECT_EQ(exp(sfixed18::from_integer(int256(-100))), sfixed18());
+  EXPECT_EQ(exp2(-one).to_raw(), int256(500000000000000000ll));
+  EXPECT_EQ(log2(sd(int256(500000000000000000ll))), -one);
+  EXPECT_EQ(log2(sd(int256(250000000000000000ll))).to_raw(),
+            int256(-2000000000000000000ll));
+  // ln(0.25) = -1.386294361119890618...
+  const int256 &ln_quarter = ln(sd(int256(250000000000000000ll))).to_raw();
+  EXPECT_TRUE(ln_quarter.is_negative());
+  expect_close(ln_quarter.abs(), 1386294361119890618_u256);
+  EXPECT_EQ(sqrt(sfixed18::from_integer(int256(144))),
+            sfixed18::from_integer(int256(12)));
+  EXPECT_EQ(powu(-two, 3_u256), sfixed18::from_integer(int256(-8)));
+  EXPECT_EQ(powu(-two, 4_u256), sfixed18::from_integer(int256(16)));
+  expect_close(pow(two, sd(int256(500000000000000000ll))).to_raw().abs(),
+               1414213562373095048_u256);
+  expect_close(pow(two, sd(int256(-500000000000000000ll))).to_raw().abs(),
+               707106781186547524_u256);
+
+  testing::internal::CaptureStdout();
+  log2(-one);
+  const std::string &output = testing::internal::GetCapturedStdout();
+  EXPECT_TRUE(reverted(output));
+  // with the Error(string) selector before the reason
+  EXPECT_NE(output.find("\x08\xc3\x79\xa0"), std::string::npos);
+  EXPECT_NE(output.find("sfixed18: log input must be positive"),
+            std::string::npos);
+  testing::internal::CaptureStdout();
+  sqrt(-one);
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+  testing::internal::CaptureStdout();
+  sd(int256::max()) + one;
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+  testing::internal::CaptureStdout();
+  sd(int256::min()) - one;
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+}
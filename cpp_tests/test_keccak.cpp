@@ -0,0 +1,57 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "utils.hpp"
+#include "gtest/gtest.h"
+#include <contractlib/v1/keccak.hpp>
+#include <string>
+
+using namespace dtvm;
+
+static std::string hash_hex(const bytes32 &hash) {
+  return bytesToHex(std::vector<uint8_t>(hash.begin(), hash.end()));
+}
+
+TEST(KeccakTest, KnownHashes) {
+  EXPECT_EQ(
+      hash_hex(const_keccak256("")),
+      "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+  EXPECT_EQ(
+      hash_hex(const_keccak256("Transfer(address,address,uint256)")),
+      "ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef");
+  // one byte short of a block, exactly a block, and several blocks
+  EXPECT_EQ(
+      hash_hex(const_keccak256(std::string(135, 'a'))),
+      "34367dc248bbd832f4e3e69dfaac2f92638bd0bbd18f2912ba4ef454919cf446");
+  EXPECT_EQ(
+      hash_hex(const_keccak256(std::string(136, 'a'))),
+      "a6c4d403279fe3e0af03729caada8374b5ca54d8065329a3ebcaeb4b60aa386e");
+  EXPECT_EQ(
+      hash_hex(const_keccak256(std::string(300, 'a'))),
+      "5b7e0e47a96f32a88b4f14ca177982790807c40e1a105742ba0fc1babe1ef826");
+}
+
+TEST(KeccakTest, SelectorsAtCompileTime) {
+  static_assert(DTVM_SELECTOR("transfer(address,uint256)") == 0xa9059cbb, "");
+  static_assert(DTVM_SELECTOR("balanceOf(address)") == 0x70a08231, "");
+  static_assert(DTVM_SELECTOR("balanceOf(address)") == 1889567281, "");
+
+  // usable as case labels
+  uint32_t selector = 0x70a08231;
+  int matched = 0;
+  switch (selector) {
+  case DTVM_SELECTOR("transfer(address,uint256)"):
+    matched = 1;
+    break;
+  case DTVM_SELECTOR("balanceOf(address)"):
+    matched = 2;
+    break;
+  }
+  EXPECT_EQ(matched, 2);
+
+  constexpr bytes32 topic =
+      DTVM_EVENT_TOPIC("Transfer(address,address,uint256)");
+  static_assert(topic[0] == 0xdd && topic[31] == 0xef, "");
+  EXPECT_EQ(hash_hex(topic), hash_hex(event_topic(
+                                 "Transfer(address,address,uint256)")));
+}
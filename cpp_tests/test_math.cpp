@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include "utils.hpp"
 #include "gtest/gtest.h"
 #include <contractlib/v1/math.hpp>
+#include <contractlib/v1/storage_slot.hpp>
 #include <contractlib/v1/utils.hpp>
 
 using namespace dtvm;
@@ -45,6 +48,15 @@ TEST(MathTest, U256Add) {
         bytesToHex(r.bytes()),
         "0000000000000000000000000000000140000000000000000000000000000003");
   }
+  {
+    // carry when the low sum keeps its top bit
+    uint256 a = (__uint128_t)__int128_t(-1);
+    uint256 r = a + a;
+    EXPECT_EQ(
+        bytesToHex(r.bytes()),
+        "00000000000000000000000000000001fffffffffffffffffffffffffffffffe");
+    EXPECT_EQ(r - a, a);
+  }
 }
 
 TEST(MathTest, U256Max) {
@@ -110,6 +122,14 @@ TEST(MathTest, U256Mul) {
         bytesToHex(r.bytes()),
         "00000000000000000000000000000009fffffffffffffffffffffffffffffff6");
   }
+  {
+    // u128 max square, the cross products carry into the high part
+    uint256 a = (__uint128_t)__int128_t(-1);
+    uint256 r = a * a;
+    EXPECT_EQ(
+        bytesToHex(r.bytes()),
+        "fffffffffffffffffffffffffffffffe00000000000000000000000000000001");
+  }
 }
 
 TEST(MathTest, U256ShiftLeftRight) {
@@ -178,3 +198,623 @@ TEST(MathTest, U256Decoding) {
     EXPECT_EQ(uint64_t(a.low >> 64), uint64_t(0xffffffffffffffffL));
   }
 }
+
+TEST(MathTest, U256BigEndianBytes) {
+  const auto &hex =
+      "0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20";
+  const auto &data = unhex(hex);
+  uint256 a = uint256::from_be_bytes(data.data());
+  EXPECT_EQ(uint64_t(a.high >> 64), uint64_t(0x0102030405060708ULL));
+  EXPECT_EQ(uint64_t(a.high), uint64_t(0x090a0b0c0d0e0f10ULL));
+  EXPECT_EQ(uint64_t(a.low >> 64), uint64_t(0x1112131415161718ULL));
+  EXPECT_EQ(uint64_t(a.low), uint64_t(0x191a1b1c1d1e1f20ULL));
+  EXPECT_EQ(a, uint256(as_bytes32(data)));
+
+  bytes32 out;
+  a.to_be_bytes(out.data());
+  EXPECT_EQ(bytesToHex(out), hex);
+  EXPECT_EQ(bytesToHex(a.bytes()), hex);
+  EXPECT_EQ(bytesToHex(uint256(1).bytes()),
+            "0000000000000000000000000000000000000000000000000000000000000001");
+}
+
+TEST(MathTest, U256Div) {
+  uint256 a(as_bytes32(unhex(
+      "10000000000000000000000000000000fffffffffffffffffffffffffffffff6")));
+  {
+    // small ints
+    EXPECT_EQ(uint256(8376392) / uint256(1234), uint256(6788));
+    EXPECT_EQ(uint256(8376393) % uint256(1234), uint256(1));
+    EXPECT_EQ(uint256(5) / uint256(8), uint256(0));
+    EXPECT_EQ(uint256(5) % uint256(8), uint256(5));
+  }
+  {
+    // divisor fits in 32 bits
+    EXPECT_EQ(
+        bytesToHex((a / uint256(7)).bytes()),
+        "024924924924924924924924924924926db6db6db6db6db6db6db6db6db6db6c");
+    EXPECT_EQ(a % uint256(7), uint256(2));
+  }
+  {
+    // divisor fits in 64 bits
+    uint256 d = uint256(1000000000000000000ull);
+    EXPECT_EQ(
+        bytesToHex((a / d).bytes()),
+        "00000000000000012725dd1d243aba0e75fe645cc4873fb0d80db85b0cd482d9");
+    EXPECT_EQ(
+        bytesToHex((a % d).bytes()),
+        "000000000000000000000000000000000000000000000000069297e6543bfff6");
+  }
+  {
+    // divisor fits in 128 bits
+    uint256 d = uint256(__uint128_t(0xfedcba9876543210ull) << 8 | 0xff);
+    EXPECT_EQ(
+        bytesToHex((a / d).bytes()),
+        "000000000000000000101249249249249237ea2f1a1f58d0fbda24351fc75ec9");
+    EXPECT_EQ(
+        bytesToHex((a % d).bytes()),
+        "0000000000000000000000000000000000000000000000825e6df4686b3a05bf");
+  }
+  {
+    // 129 bits divisor
+    uint256 d = uint256(1, 1);
+    EXPECT_EQ(
+        bytesToHex((a / d).bytes()),
+        "0000000000000000000000000000000010000000000000000000000000000000");
+    EXPECT_EQ(
+        bytesToHex((a % d).bytes()),
+        "00000000000000000000000000000000effffffffffffffffffffffffffffff6");
+  }
+  {
+    // large divisor
+    uint256 d = (uint256(1) << 200) + uint256(12345);
+    EXPECT_EQ(
+        bytesToHex((a / d).bytes()),
+        "0000000000000000000000000000000000000000000000000010000000000000");
+    EXPECT_EQ(
+        bytesToHex((a % d).bytes()),
+        "00000000000000000000000000000000fffffffffffffffcfc6ffffffffffff6");
+  }
+  {
+    // max values
+    EXPECT_EQ(
+        bytesToHex((uint256::max() / uint256(3)).bytes()),
+        "5555555555555555555555555555555555555555555555555555555555555555");
+    EXPECT_EQ(uint256::max() % uint256(1, 1), uint256(0));
+    EXPECT_EQ(uint256::max() / uint256::max(), uint256(1));
+    EXPECT_EQ(a / uint256::max(), uint256(0));
+  }
+}
+
+TEST(MathTest, U256DivMod) {
+  // q * d + r == a and r < d for random operands of every size
+  std::mt19937_64 rng(20240601);
+  auto random_u256 = [&rng](int bits) {
+    uint256 v((__uint128_t(rng()) << 64) | rng(),
+              (__uint128_t(rng()) << 64) | rng());
+    return bits >= 256 ? v : v >> (256 - bits);
+  };
+  for (int i = 0; i < 2000; i++) {
+    uint256 a = random_u256(1 + rng() % 256);
+    uint256 d = random_u256(1 + rng() % 256);
+    if (d == uint256(0)) {
+      continue;
+    }
+    auto [q, r] = a.divmod(d);
+    EXPECT_TRUE(r < d);
+    EXPECT_EQ(q * d + r, a);
+    EXPECT_EQ(a / d, q);
+    EXPECT_EQ(a % d, r);
+  }
+}
+
+namespace {
+
+template <uint64_t D> void check_div_by(const std::vector<uint256> &inputs) {
+  for (const uint256 &a : inputs) {
+    const auto &result = a.divmod_by<D>();
+    EXPECT_EQ(result.first, a / uint256(D)) << D;
+    EXPECT_EQ(result.second, a % uint256(D)) << D;
+    EXPECT_EQ(a.div_by<D>(), result.first);
+    EXPECT_EQ(a.mod_by<D>(), result.second);
+  }
+}
+
+} // namespace
+
+TEST(MathTest, U256DivByConstant) {
+  std::mt19937_64 rng(15);
+  std::vector<uint256> inputs = {uint256(0), uint256(1), uint256::max(),
+                                 uint256::max() - uint256(1),
+                                 uint256(~uint64_t(0)),
+                                 uint256(__uint128_t(1) << 64),
+                                 uint256(1000000000000000000ull),
+                                 uint256(999999999999999999ull)};
+  for (int i = 0; i < 500; i++) {
+    uint256 v((__uint128_t(rng()) << 64) | rng(),
+              (__uint128_t(rng()) << 64) | rng());
+    inputs.push_back(v >> (rng() % 256));
+  }
+  check_div_by<1>(inputs);
+  check_div_by<2>(inputs);
+  check_div_by<3>(inputs);
+  check_div_by<7>(inputs);
+  check_div_by<10>(inputs);
+  check_div_by<10000>(inputs);
+  check_div_by<31536000>(inputs);
+  check_div_by<1000000000000000000ull>(inputs);
+  check_div_by<10000000000000000000ull>(inputs);
+  check_div_by<uint64_t(1) << 63>(inputs);
+  check_div_by<~uint64_t(0)>(inputs);
+
+  static_assert(uint256::max().div_by<3>() * uint256(3) == uint256::max(), "");
+  static_assert(uint256(12345).mod_by<100>() == uint256(45), "");
+  static_assert(uint256(12345).div_by<64>() == uint256(192), "");
+}
+
+TEST(MathTest, U256MulDiv) {
+  uint256 a(as_bytes32(unhex(
+      "b1e03fa0c4d96e0fd9a3f5efa8b9e5d6c0f2a9ec4c3d7e1f8a9b0c1d2e3f4051")));
+  uint256 b(as_bytes32(unhex(
+      "9f8e7d6c5b4a39281706f5e4d3c2b1a09988776655443322110ffeeddccbbaa9")));
+  uint256 c(as_bytes32(unhex(
+      "c3d2e1f00f1e2d3c4b5a69788796a5b4c3d2e1f00f1e2d3c4b5a697887961234")));
+  {
+    // 512-bit intermediate product
+    EXPECT_EQ(
+        bytesToHex(mul_div(a, b, c).bytes()),
+        "90eecbd1fbb21ff0c9c4a74b92fd9567c329c624e8b7f6ed1c71304bda62e25e");
+    EXPECT_EQ(
+        bytesToHex(mul_div_round_up(a, b, c).bytes()),
+        "90eecbd1fbb21ff0c9c4a74b92fd9567c329c624e8b7f6ed1c71304bda62e25f");
+    EXPECT_EQ(
+        bytesToHex(mulmod(a, b, c).bytes()),
+        "603c6ff27e03e987c891eeb72e4079b39e785fe72944d45378ea392493a2b861");
+  }
+  {
+    // max values
+    uint256 max = uint256::max();
+    EXPECT_EQ(mul_div(max, max - uint256(1), max), max - uint256(1));
+    EXPECT_EQ(mul_div_round_up(max, max - uint256(1), max), max - uint256(1));
+    EXPECT_EQ(
+        bytesToHex(mul_div(max, uint256(3), uint256(6)).bytes()),
+        "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    EXPECT_EQ(
+        bytesToHex(mulmod(max, max, uint256(1000000000000000007ull)).bytes()),
+        "00000000000000000000000000000000000000000000000000eeb630d3456d95");
+  }
+  {
+    // exact division does not round up
+    EXPECT_EQ(mul_div_round_up(uint256(6), uint256(7), uint256(21)),
+              uint256(2));
+    EXPECT_EQ(mul_div_round_up(uint256(6), uint256(7), uint256(20)),
+              uint256(3));
+    EXPECT_EQ(mul_div(uint256(6), uint256(7), uint256(20)), uint256(2));
+  }
+  {
+    // small operands agree with the plain 256-bit operators
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 500; i++) {
+      uint256 x = (__uint128_t(rng()) << 64) | rng();
+      uint256 y = (__uint128_t(rng()) << 64) | rng();
+      uint256 d = uint256(rng() | 1) << (rng() % 190);
+      EXPECT_EQ(mul_div(x, y, d), (x * y) / d);
+      EXPECT_EQ(mulmod(x, y, d), (x * y) % d);
+    }
+  }
+}
+
+TEST(MathTest, U256AddMod) {
+  uint256 a(as_bytes32(unhex(
+      "b1e03fa0c4d96e0fd9a3f5efa8b9e5d6c0f2a9ec4c3d7e1f8a9b0c1d2e3f4051")));
+  uint256 b(as_bytes32(unhex(
+      "9f8e7d6c5b4a39281706f5e4d3c2b1a09988776655443322110ffeeddccbbaa9")));
+  uint256 c(as_bytes32(unhex(
+      "c3d2e1f00f1e2d3c4b5a69788796a5b4c3d2e1f00f1e2d3c4b5a697887961234")));
+  // the sum overflows 256 bits
+  EXPECT_EQ(
+      bytesToHex(addmod(a, b, c).bytes()),
+      "8d9bdb1d110579fba550825bf4e5f1c296a83f62926384055050a1928374e8c6");
+  EXPECT_EQ(addmod(uint256::max(), uint256::max(), uint256(7)), uint256(2));
+  EXPECT_EQ(addmod(uint256(5), uint256(6), uint256(11)), uint256(0));
+  EXPECT_EQ(addmod(uint256(5), uint256(6), uint256(100)), uint256(11));
+}
+
+TEST(MathTest, I256Arithmetic) {
+  {
+    // negative values are sign extended two's complement
+    int256 a = -7;
+    EXPECT_EQ(
+        bytesToHex(a.bytes()),
+        "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff9");
+    EXPECT_TRUE(a.is_negative());
+    EXPECT_EQ(a.to_int64(), -7);
+    EXPECT_EQ(-a, int256(7));
+    EXPECT_EQ(a.abs(), uint256(7));
+  }
+  {
+    int256 a = -1234;
+    int256 b = 6788;
+    EXPECT_EQ(a + b, int256(5554));
+    EXPECT_EQ(a - b, int256(-8022));
+    EXPECT_EQ(a * b, int256(-8376392));
+    EXPECT_EQ(a * a, int256(1522756));
+  }
+  {
+    // division truncates toward zero, remainder takes the dividend sign
+    EXPECT_EQ(int256(-7) / int256(2), int256(-3));
+    EXPECT_EQ(int256(-7) % int256(2), int256(-1));
+    EXPECT_EQ(int256(7) / int256(-2), int256(-3));
+    EXPECT_EQ(int256(7) % int256(-2), int256(1));
+    EXPECT_EQ(int256(-7) / int256(-2), int256(3));
+    EXPECT_EQ(int256(-7) % int256(-2), int256(-1));
+    EXPECT_EQ(int256::min() / int256(-1), int256::min());
+  }
+  {
+    // large negative dividend
+    int256 a =
+        int256(-(__int128_t(1234567890123456789ll) * 1000000000000ll + 999));
+    EXPECT_EQ(
+        bytesToHex((a / int256(1000)).bytes()),
+        "fffffffffffffffffffffffffffffffffffffffffc02ca149286856e42836e00");
+    EXPECT_EQ(a % int256(1000), int256(-999));
+  }
+  {
+    // min and max
+    EXPECT_EQ(
+        bytesToHex(int256::min().bytes()),
+        "8000000000000000000000000000000000000000000000000000000000000000");
+    EXPECT_EQ(
+        bytesToHex(int256::max().bytes()),
+        "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    EXPECT_EQ(int256::max() + int256(1), int256::min());
+    EXPECT_EQ(int256::min().abs(), uint256(1) << 255);
+  }
+}
+
+TEST(MathTest, I256ShiftCompare) {
+  {
+    // arithmetic right shift keeps the sign
+    EXPECT_EQ(int256(-16) >> 2, int256(-4));
+    EXPECT_EQ(int256(-17) >> 2, int256(-5));
+    EXPECT_EQ(int256(16) >> 2, int256(4));
+    EXPECT_EQ(int256(-1) >> 200, int256(-1));
+    EXPECT_EQ(int256::min() >> 255, int256(-1));
+    EXPECT_EQ(int256::max() >> 300, int256(0));
+    EXPECT_EQ(int256(-3) << 130 >> 130, int256(-3));
+  }
+  {
+    EXPECT_TRUE(int256(-1) < int256(0));
+    EXPECT_TRUE(int256::min() < int256(-1));
+    EXPECT_TRUE(int256(1) > int256(-100));
+    EXPECT_TRUE(int256(-100) < int256(-99));
+    EXPECT_TRUE(int256(-99) >= int256(-99));
+    EXPECT_TRUE(int256::max() > int256(0));
+    EXPECT_FALSE(int256(3) <= int256(-3));
+  }
+  {
+    // sign extension from a smaller width
+    EXPECT_EQ(int256::sign_extend(uint256(0xff), 8), int256(-1));
+    EXPECT_EQ(int256::sign_extend(uint256(0x7f), 8), int256(127));
+    EXPECT_EQ(int256::sign_extend(uint256(0x1ff80), 8), int256(-128));
+    EXPECT_EQ(int256::sign_extend(uint256(__uint128_t(1) << 127), 128),
+              int256(-(__int128_t(1) << 126) * 2));
+  }
+}
+
+// Every backend must agree with the selected one (and the unit tests above)
+TEST(MathTest, U256Checked) {
+  const uint256 &max = uint256::max();
+  uint256 out;
+  EXPECT_FALSE(add_overflow(max - uint256(1), uint256(1), out));
+  EXPECT_EQ(out, max);
+  EXPECT_TRUE(add_overflow(max, uint256(1), out));
+  EXPECT_EQ(out, uint256(0));
+  // carry through the 128-bit boundary into the top bit
+  EXPECT_TRUE(add_overflow(uint256(1) << 255, uint256(1) << 255, out));
+  EXPECT_FALSE(sub_overflow(uint256(5), uint256(5), out));
+  EXPECT_TRUE(sub_overflow(uint256(0), uint256(1), out));
+  EXPECT_EQ(out, max);
+  EXPECT_TRUE(sub_overflow(uint256(1) << 128, (uint256(1) << 128) + 1, out));
+  EXPECT_FALSE(mul_overflow(uint256(1) << 127, uint256(1) << 128, out));
+  EXPECT_EQ(out, uint256(1) << 255);
+  EXPECT_TRUE(mul_overflow(uint256(1) << 128, uint256(1) << 128, out));
+  EXPECT_TRUE(mul_overflow(max, uint256(2), out));
+  EXPECT_FALSE(mul_overflow(max, uint256(1), out));
+  EXPECT_FALSE(mul_overflow(max, uint256(0), out));
+
+  EXPECT_EQ(checked_add(uint256(2), uint256(3)), uint256(5));
+  EXPECT_EQ(checked_sub(uint256(3), uint256(2)), uint256(1));
+  EXPECT_EQ(checked_mul(uint256(3), uint256(2)), uint256(6));
+  EXPECT_EQ(unchecked_sub(uint256(0), uint256(1)), max);
+
+  checked_uint256 a = uint256(10);
+  a += uint256(5);
+  a -= 3;
+  a *= uint256(2);
+  EXPECT_EQ(a.value(), uint256(24));
+  EXPECT_EQ((uint256(1) + a).value(), uint256(25));
+  EXPECT_TRUE(a > uint256(23));
+
+  // overflow reverts with Panic(0x11)
+  testing::internal::CaptureStdout();
+  checked_sub(uint256(1), uint256(2));
+  const auto &output = testing::internal::GetCapturedStdout();
+  EXPECT_NE(output.find("wasm context reverted"), std::string::npos);
+  EXPECT_NE(output.find(std::string("\x4e\x48\x7b\x71", 4)),
+            std::string::npos);
+  EXPECT_EQ(output[output.find("\x4e\x48\x7b\x71") + 35], '\x11');
+
+  testing::internal::CaptureStdout();
+  checked_uint256 c = checked_uint256(max) - checked_uint256(max);
+  EXPECT_EQ(c, uint256(0));
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+}
+
+// evaluated by the compiler, a non constexpr path would fail the build
+static_assert(uint256::max() + uint256(1) == uint256(0), "constexpr add");
+static_assert(uint256(0) - uint256(1) == uint256::max(), "constexpr sub");
+static_assert((uint256(1) << 200) * uint256(3) == uint256(3) << 200,
+              "constexpr mul");
+static_assert(uint256::max() / uint256(3) * uint256(3) == uint256::max(),
+              "constexpr div");
+static_assert((uint256(1) << 255) % uint256(1000000007ull) ==
+                  uint256(396422633ull),
+              "constexpr mod");
+static_assert(mul_div(uint256::max(), uint256(2), uint256(4)) ==
+                  uint256::max() >> 1,
+              "constexpr mul_div");
+static_assert(checked_mul(uint256(1) << 127, uint256(2)) == uint256(1) << 128,
+              "constexpr checked_mul");
+static_assert(int256(-7) / int256(2) == int256(-3), "constexpr int256");
+static_assert(uint256(uint256(0x1234).bytes()) == uint256(0x1234),
+              "constexpr bytes round trip");
+static_assert(StorageSlot(1, 0).get_key()[31] == 1, "constexpr StorageSlot");
+
+TEST(MathTest, U256Literals) {
+  static_assert(0_u256 == uint256(0), "");
+  static_assert(1000000000000000000_u256 ==
+                    uint256(1000000000000000000ull),
+                "");
+  static_assert(1'000'000_u256 == uint256(1000000), "");
+  static_assert(0xff_u256 == uint256(255), "");
+  static_assert(
+      0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_u256 ==
+          uint256::max(),
+      "");
+  static_assert(
+      115792089237316195423570985008687907853269984665640564039457584007913129639935_u256 ==
+          uint256::max(),
+      "");
+  constexpr uint256 wei_per_ether = 1000000000000000000_u256;
+  EXPECT_EQ(wei_per_ether * 3_u256, uint256(3000000000000000000ull));
+  EXPECT_EQ(0x10000000000000000000000000000000fffffffffffffffffffffffffffffff6_u256,
+            uint256(as_bytes32(unhex("10000000000000000000000000000000"
+                                     "fffffffffffffffffffffffffffffff6"))));
+}
+
+TEST(MathTest, U256BitScan) {
+  EXPECT_EQ(clz(uint256(0)), 256);
+  EXPECT_EQ(ctz(uint256(0)), 256);
+  EXPECT_EQ(msb(uint256(0)), -1);
+  EXPECT_EQ(popcount(uint256(0)), 0);
+  EXPECT_EQ(popcount(uint256::max()), 256);
+  EXPECT_EQ(log2(uint256(0)), 0u);
+  for (int i = 0; i < 256; i++) {
+    const uint256 &bit = uint256(1) << size_t(i);
+    EXPECT_EQ(clz(bit), 255 - i);
+    EXPECT_EQ(ctz(bit), i);
+    EXPECT_EQ(msb(bit), i);
+    EXPECT_EQ(popcount(bit), 1);
+    EXPECT_EQ(popcount(bit - uint256(1)), i);
+    EXPECT_EQ(log2(bit), uint32_t(i));
+    EXPECT_EQ(log2(bit | (bit - uint256(1))), uint32_t(i));
+    EXPECT_EQ(ctz(uint256::max() << size_t(i)), i);
+  }
+}
+
+TEST(MathTest, U256PowSqrtLog) {
+  static_assert(sqrt(uint256(1) << 200) == uint256(1) << 100, "");
+  static_assert(log10(1000000000000000000_u256) == 18, "");
+  static_assert(pow(uint256(10), uint256(18)) == 1000000000000000000_u256,
+                "");
+
+  EXPECT_EQ(pow(uint256(0), uint256(0)), uint256(1));
+  EXPECT_EQ(pow(uint256(0), uint256(5)), uint256(0));
+  EXPECT_EQ(pow(uint256(7), uint256(1)), uint256(7));
+  EXPECT_EQ(pow(uint256(2), uint256(255)), uint256(1) << 255);
+  EXPECT_EQ(pow(uint256(2), uint256(256)), uint256(0)); // wraps
+  EXPECT_EQ(checked_pow(uint256(3), uint256(161)),
+            65542350158517637872691969508970705427701150314738255642438471845988797065603_u256);
+  EXPECT_EQ(pow(uint256(1), uint256::max()), uint256(1));
+  EXPECT_EQ(pow(uint256::max(), uint256(2)), uint256(1)); // (-1)^2 wrapped
+  testing::internal::CaptureStdout();
+  checked_pow(uint256(2), uint256(256));
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+  // the square overflows but is never needed
+  testing::internal::CaptureStdout();
+  EXPECT_EQ(checked_pow(uint256(1) << 200, uint256(1)), uint256(1) << 200);
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+
+  uint256 power(1);
+  for (uint32_t k = 0; k <= 77; k++) {
+    EXPECT_EQ(log10(power), k);
+    EXPECT_EQ(pow(uint256(10), uint256(k)), power);
+    if (k > 0) {
+      EXPECT_EQ(log10(power - uint256(1)), k - 1);
+    }
+    power = power * uint256(10);
+  }
+  EXPECT_EQ(log10(uint256::max()), 77u);
+  EXPECT_EQ(log10(uint256(0)), 0u);
+  // the msb estimate at every bit length
+  for (int i = 0; i < 256; i++) {
+    for (const uint256 &x : {uint256(1) << size_t(i),
+                             (uint256(1) << size_t(i)) |
+                                 ((uint256(1) << size_t(i)) - uint256(1))}) {
+      uint32_t expected = 0;
+      for (uint256 y = x / uint256(10); y != uint256(0); y = y / uint256(10)) {
+        expected++;
+      }
+      EXPECT_EQ(log10(x), expected);
+    }
+  }
+
+  EXPECT_EQ(sqrt(uint256(0)), uint256(0));
+  EXPECT_EQ(sqrt(uint256(1)), uint256(1));
+  EXPECT_EQ(sqrt(uint256(3)), uint256(1));
+  EXPECT_EQ(sqrt(uint256(4)), uint256(2));
+  EXPECT_EQ(sqrt(uint256::max()), uint256((__uint128_t)__int128_t(-1)));
+  for (int bits = 32; bits <= 128; bits += 16) {
+    const uint256 &r = (uint256(1) << size_t(bits)) - uint256(1);
+    EXPECT_EQ(sqrt(r * r), r);
+    EXPECT_EQ(sqrt(r * r - uint256(1)), r - uint256(1));
+    if (bits < 128) {
+      EXPECT_EQ(sqrt((r + uint256(1)) * (r + uint256(1)) - uint256(1)), r);
+    }
+  }
+  std::mt19937_64 rng(11);
+  for (int i = 0; i < 2000; i++) {
+    const uint256 &x = uint256((__uint128_t(rng()) << 64) | rng(),
+                               (__uint128_t(rng()) << 64) | rng()) >>
+                       (rng() % 256);
+    const uint256 &r = sqrt(x);
+    // r^2 <= x < (r+1)^2, r < 2^128 so the squares fit
+    EXPECT_LE(r * r, x);
+    const uint256 &next = r + uint256(1);
+    EXPECT_TRUE(mul_full(next, next).first != uint256(0) || next * next > x);
+    EXPECT_EQ(sqrt(r * r), r);
+  }
+}
+
+TEST(MathTest, U256StringConversion) {
+  EXPECT_EQ(to_dec_string(uint256(0)), "0");
+  EXPECT_EQ(to_dec_string(uint256(7)), "7");
+  EXPECT_EQ(to_dec_string(1000000000000000000_u256), "1000000000000000000");
+  // chunk boundaries: 10^19 - 1, 10^19 and 2^64
+  EXPECT_EQ(to_dec_string(9999999999999999999_u256), "9999999999999999999");
+  EXPECT_EQ(to_dec_string(10000000000000000000_u256), "10000000000000000000");
+  EXPECT_EQ(to_dec_string(uint256(1) << 64), "18446744073709551616");
+  EXPECT_EQ(to_dec_string(uint256(1) << 128),
+            "340282366920938463463374607431768211456");
+  EXPECT_EQ(to_dec_string(uint256::max()),
+            "115792089237316195423570985008687907853269984665640564039457584007"
+            "913129639935");
+
+  EXPECT_EQ(to_hex_string(uint256(0)), "0x0");
+  EXPECT_EQ(to_hex_string(uint256(0xabc)), "0xabc");
+  EXPECT_EQ(to_hex_string(uint256(1) << 255),
+            "0x80000000000000000000000000000000"
+            "00000000000000000000000000000000");
+  EXPECT_EQ(from_hex_string("0xABC"), uint256(0xabc));
+  EXPECT_EQ(from_hex_string("ff"), uint256(0xff));
+  EXPECT_EQ(from_hex_string("0x0000000000000000000000000000000000000000000000"
+                            "0000000000000000000001"),
+            uint256(1));
+  EXPECT_EQ(from_dec_string("000123"), uint256(123));
+
+  std::mt19937_64 rng(10);
+  uint256 power(1);
+  for (int i = 0; i < 300; i++) {
+    // random values of every size plus the powers of ten and their neighbours
+    uint256 value((__uint128_t(rng()) << 64) | rng(),
+                  (__uint128_t(rng()) << 64) | rng());
+    value = value >> (i % 256);
+    for (const uint256 &v : {value, power, power - uint256(1)}) {
+      const std::string &dec = to_dec_string(v);
+      EXPECT_EQ(from_dec_string(dec), v);
+      EXPECT_EQ(from_hex_string(to_hex_string(v)), v);
+      EXPECT_EQ(dec.size(), v == uint256(0) ? 1 : log10(v) + 1);
+    }
+    power = i % 78 == 77 ? uint256(1) : power * uint256(10);
+  }
+
+  for (const char *bad :
+       {"", "12a", "-1",
+        "115792089237316195423570985008687907853269984665640564039457584007913"
+        "129639936"}) {
+    testing::internal::CaptureStdout();
+    from_dec_string(bad);
+    EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+              std::string::npos)
+        << bad;
+  }
+  for (const char *bad :
+       {"0x", "0xg1",
+        "0x1000000000000000000000000000000000000000000000000000000000000000"
+        "0"}) {
+    testing::internal::CaptureStdout();
+    from_hex_string(bad);
+    EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+              std::string::npos)
+        << bad;
+  }
+
+  // the reason is Error(string) encoded, as solidity's require sends it
+  testing::internal::CaptureStdout();
+  from_dec_string("12a");
+  const std::string reason = "from_dec_string: invalid digit in 12a";
+  std::string expected("\x08\xc3\x79\xa0", 4);
+  expected += std::string(31, '\0') + '\x20';
+  expected += std::string(31, '\0') + char(reason.size());
+  expected += reason + std::string(64 - reason.size(), '\0');
+  EXPECT_NE(testing::internal::GetCapturedStdout().find(
+                "wasm context reverted with data: " + expected + "\n"),
+            std::string::npos);
+}
+
+template <typename Backend> void check_uint256_backend() {
+  std::mt19937_64 rng(7);
+  std::vector<uint256> values = {
+      uint256(0),
+      uint256(1),
+      uint256::max(),
+      uint256((__uint128_t)__int128_t(-1)),
+      uint256(1) << 128,
+      uint256(1) << 255,
+      uint256(0xffffffffffffffffull),
+  };
+  for (int i = 0; i < 200; i++) {
+    values.push_back(uint256((__uint128_t(rng()) << 64) | rng(),
+                             (__uint128_t(rng()) << 64) | rng()) >>
+                     (rng() % 256));
+  }
+  for (size_t i = 0; i < values.size(); i++) {
+    const uint256 &a = values[i];
+    const uint256 &b = values[(i * 7 + 3) % values.size()];
+    EXPECT_EQ(Backend::add(a, b), a + b);
+    EXPECT_EQ(Backend::sub(a, b), a - b);
+    EXPECT_EQ(Backend::mul(a, b), a * b);
+    EXPECT_EQ(Backend::lt(a, b), a < b);
+    EXPECT_EQ(Backend::lt(b, a), b < a);
+    EXPECT_FALSE(Backend::lt(a, a));
+    uint256 out;
+    EXPECT_EQ(Backend::add_overflow(a, b, out), a + b < a);
+    EXPECT_EQ(out, a + b);
+    EXPECT_EQ(Backend::sub_overflow(a, b, out), a < b);
+    EXPECT_EQ(out, a - b);
+    EXPECT_EQ(Backend::mul_overflow(a, b, out),
+              mul_full(a, b).first != uint256(0));
+    EXPECT_EQ(out, a * b);
+    for (size_t shift : {size_t(0), size_t(1), size_t(63), size_t(64),
+                         size_t(65), size_t(127), size_t(128), size_t(129),
+                         size_t(200), size_t(255), size_t(256), size_t(300),
+                         size_t(i % 256)}) {
+      EXPECT_EQ(Backend::shl(a, shift), a << shift);
+      EXPECT_EQ(Backend::shr(a, shift), a >> shift);
+    }
+  }
+}
+
+TEST(MathTest, U256Backends) {
+  check_uint256_backend<detail::U128Backend>();
+  check_uint256_backend<detail::Limb64Backend>();
+#ifdef DTVM_HAS_BITINT_256
+  check_uint256_backend<detail::BitIntBackend>();
+#endif
+  // shifting out every bit
+  EXPECT_EQ(uint256::max() << 256, uint256(0));
+  EXPECT_EQ(uint256::max() >> 256, uint256(0));
+  EXPECT_EQ(uint256::max() >> 255, uint256(1));
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <iostream>
+#include <random>
+
+#include "gtest/gtest.h"
+#include <contractlib/v1/modfield.hpp>
+
+using namespace dtvm;
+
+namespace {
+
+uint256 random_u256(std::mt19937_64 &rng) {
+  return uint256((__uint128_t(rng()) << 64) | rng(),
+                 (__uint128_t(rng()) << 64) | rng());
+}
+
+// Every operation against the plain mulmod/addmod results
+template <typename Field> void check_field() {
+  const uint256 &p = Field::P;
+  std::mt19937_64 rng(12);
+  std::vector<uint256> values = {uint256(0), uint256(1), uint256(2),
+                                 p - uint256(1), p, p + uint256(1),
+                                 uint256::max()};
+  for (int i = 0; i < 64; i++) {
+    values.push_back(random_u256(rng));
+  }
+  for (size_t i = 0; i < values.size(); i++) {
+    const uint256 &a = values[i];
+    const uint256 &b = values[(i * 7 + 3) % values.size()];
+    const Field &x = Field::from_uint256(a);
+    const Field &y = Field::from_uint256(b);
+    const uint256 &a_mod = a % p;
+    const uint256 &b_mod = b % p;
+    EXPECT_EQ(x.to_uint256(), a_mod);
+    EXPECT_EQ((x * y).to_uint256(), mulmod(a, b, p));
+    EXPECT_EQ(x.square().to_uint256(), mulmod(a, a, p));
+    EXPECT_EQ((x + y).to_uint256(), addmod(a, b, p));
+    EXPECT_EQ((x - y).to_uint256(), addmod(a_mod, p - b_mod, p));
+    EXPECT_EQ((x - y) + y, x);
+    EXPECT_EQ(-x + x, Field::zero());
+    if (!x.is_zero()) {
+      EXPECT_EQ(x * x.inverse(), Field::one());
+      EXPECT_EQ((y / x) * x, y);
+    }
+    // small exponents against repeated multiplication
+    Field power = Field::one();
+    for (uint32_t k = 0; k < 20; k++) {
+      EXPECT_EQ(x.pow(uint256(k)), power);
+      power *= x;
+    }
+    // Fermat: a^(p-1) = 1
+    if (!x.is_zero()) {
+      EXPECT_EQ(x.pow(p - uint256(1)), Field::one());
+    }
+  }
+}
+
+} // namespace
+
+TEST(ModFieldTest, Secp256k1) {
+  check_field<secp256k1_fp>();
+  check_field<secp256k1_fn>();
+  // the curve equation y^2 = x^3 + 7 holds for the generator
+  const secp256k1_fp &gx = secp256k1_fp::from_uint256(
+      0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798_u256);
+  const secp256k1_fp &gy = secp256k1_fp::from_uint256(
+      0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8_u256);
+  EXPECT_EQ(gy.square(),
+            gx.square() * gx + secp256k1_fp::from_uint256(uint256(7)));
+}
+
+TEST(ModFieldTest, Bn254) {
+  check_field<bn254_fp>();
+  check_field<bn254_fr>();
+  // the generator (1, 2) is on y^2 = x^3 + 3
+  const bn254_fp &two = bn254_fp::from_uint256(uint256(2));
+  EXPECT_EQ(two.square(), bn254_fp::one() + bn254_fp::from_uint256(3_u256));
+}
+
+TEST(ModFieldTest, Constexpr) {
+  static_assert(secp256k1_fp::from_uint256(uint256(3)).to_uint256() ==
+                    uint256(3),
+                "");
+  static_assert((bn254_fp::from_uint256(uint256(6)) *
+                 bn254_fp::from_uint256(uint256(7)))
+                        .to_uint256() == uint256(42),
+                "");
+  static_assert(bn254_fr::from_uint256(bn254_fr::P) == bn254_fr::zero(), "");
+
+  testing::internal::CaptureStdout();
+  secp256k1_fp::zero().inverse();
+  EXPECT_NE(testing::internal::GetCapturedStdout().find("reverted"),
+            std::string::npos);
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <iostream>
+#include <random>
+
+#include "utils.hpp"
+#include "gtest/gtest.h"
+#include <contractlib/v1/packed.hpp>
+
+using namespace dtvm;
+
+namespace {
+
+// an order book entry: expiry timestamp, a flag, a signed tick, an amount
+// that straddles the two 128-bit halves and an id in the high half
+using Expiry = BitField<0, 40, uint64_t>;
+using Paused = BitField<40, 1, bool>;
+using Tick = BitField<41, 24, int32_t>;
+using Amount = BitField<65, 96, __uint128_t>;
+using Id = BitField<161, 64, uint64_t>;
+using Order = PackedWord<Expiry, Paused, Tick, Amount, Id>;
+
+using Owner = BitField<0, 160, Address>;
+using Balance = BitField<160, 96, uint256>;
+
+bool reverted(const std::string &output) {
+  return output.find("wasm context reverted") != std::string::npos;
+}
+
+// manual reference: the field bits shifted down with the uint256 operators
+uint256 reference_bits(const uint256 &word, size_t offset, size_t width) {
+  return (word >> offset) & (uint256::max() >> (256 - width));
+}
+
+} // namespace
+
+TEST(PackedTest, GetSetFields) {
+  Order order;
+  order.set<Expiry>(1700000000ull)
+      .set<Paused>(true)
+      .set<Tick>(-887272)
+      .set<Amount>((__uint128_t(1) << 96) - 1)
+      .set<Id>(0xfedcba9876543210ull);
+  EXPECT_EQ(order.get<Expiry>(), 1700000000ull);
+  EXPECT_TRUE(order.get<Paused>());
+  EXPECT_EQ(order.get<Tick>(), -887272);
+  EXPECT_EQ(order.get<Amount>(), (__uint128_t(1) << 96) - 1);
+  EXPECT_EQ(order.get<Id>(), 0xfedcba9876543210ull);
+
+  // each field only touches its own bits
+  order.set<Paused>(false).set<Tick>(5);
+  EXPECT_EQ(order.get<Expiry>(), 1700000000ull);
+  EXPECT_FALSE(order.get<Paused>());
+  EXPECT_EQ(order.get<Tick>(), 5);
+  EXPECT_EQ(order.get<Amount>(), (__uint128_t(1) << 96) - 1);
+  EXPECT_EQ(order.get<Id>(), 0xfedcba9876543210ull);
+  EXPECT_EQ(reference_bits(order.word(), 65, 96),
+            uint256((__uint128_t(1) << 96) - 1));
+  EXPECT_EQ(reference_bits(order.word(), 161, 64),
+            uint256(0xfedcba9876543210ull));
+
+  static_assert(Order().set<Tick>(-1).get<Tick>() == -1, "");
+  static_assert(Tick::MASK == uint256((__uint128_t(1) << 24) - 1) << 41, "");
+}
+
+TEST(PackedTest, ValuesThatDoNotFitRevert) {
+  Order order;
+  testing::internal::CaptureStdout();
+  order.set<Expiry>(uint64_t(1) << 40);
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+  testing::internal::CaptureStdout();
+  order.set<Tick>(1 << 23);
+  EXPECT_TRUE(reverted(testing::internal::GetCapturedStdout()));
+  testing::internal::CaptureStdout();
+  order.set<Tick>(-(1 << 23));
+  order.set<Tick>((1 << 23) - 1);
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+}
+
+TEST(PackedTest, Bytes32RoundTrip) {
+  std::mt19937_64 rng(14);
+  for (int i = 0; i < 64; i++) {
+    const uint256 random_word((__uint128_t(rng()) << 64) | rng(),
+                              (__uint128_t(rng()) << 64) | rng());
+    Order order(random_word);
+    bytes32 bytes = order.to_bytes32();
+    EXPECT_EQ(Order(bytes), order);
+
+    // the bytes32 accessors agree with the uint256 ones
+    EXPECT_EQ(Expiry::get(bytes), order.get<Expiry>());
+    EXPECT_EQ(Paused::get(bytes), order.get<Paused>());
+    EXPECT_EQ(Tick::get(bytes), order.get<Tick>());
+    EXPECT_EQ(Amount::get(bytes), order.get<Amount>());
+    EXPECT_EQ(Id::get(bytes), order.get<Id>());
+
+    const uint64_t expiry = rng() >> 24;
+    const int32_t tick = int32_t(rng() % (1 << 24)) - (1 << 23);
+    const __uint128_t amount = ((__uint128_t(rng()) << 64) | rng()) >> 32;
+    Expiry::set(bytes, expiry);
+    Tick::set(bytes, tick);
+    Amount::set(bytes, amount);
+    order.set<Expiry>(expiry).set<Tick>(tick).set<Amount>(amount);
+    EXPECT_EQ(bytesToHex(bytes), bytesToHex(order.to_bytes32()));
+  }
+}
+
+TEST(PackedTest, AddressAndUint256Fields) {
+  const Address &owner =
+      Address(std::string("0x1111111111111111111111111111111111111111"));
+  uint256 word = Owner::set(uint256(), owner);
+  word = Balance::set(word, uint256(123456789));
+  EXPECT_EQ(Owner::get(word), owner);
+  EXPECT_EQ(Balance::get(word), uint256(123456789));
+  // solidity's (address owner, uint96 balance) slot layout
+  EXPECT_EQ(bytesToHex(word.bytes()),
+            "0000000000000000075bcd151111111111111111111111111111111111111111");
+
+  bytes32 bytes = word.bytes();
+  Balance::set(bytes, uint256(7));
+  EXPECT_EQ(Balance::get(bytes), uint256(7));
+  EXPECT_EQ(Owner::get(bytes), owner);
+}
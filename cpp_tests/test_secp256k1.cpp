@@ -0,0 +1,145 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <iostream>
+#include <random>
+
+#include "utils.hpp"
+#include "gtest/gtest.h"
+#include <contractlib/v1/secp256k1.hpp>
+
+using namespace dtvm;
+using namespace dtvm::crypto;
+
+namespace {
+
+struct SignatureVector {
+  const char *hash;
+  uint8_t v;
+  const char *r;
+  const char *s;
+  const char *public_key;
+};
+
+// signed with private keys 1, n - 1 and the first hardhat test account
+const SignatureVector SIGNATURE_VECTORS[] = {
+    {"7692c3ad3540bb803c020b3aee66cd8887123234ea0c6e7143c0add73ff431ed", 28,
+     "80695f71e18505b33ac5021550fc2ba9cae40d21a708d385960d3e6dfbc528b5",
+     "2d7448ca060b0646818c8728469843399d52581427e48909eb6a7601a00f7756",
+     "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+     "483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8"},
+    {"51aeea8ffa05d2620d35c87463465885e77df13171d5708746df1a9f36d47f35", 27,
+     "6274e16614b9650ab4c63f8a5f40c71e593a3af894f9c51d0af6455173c268d9",
+     "46e18d9de61ce0f2964cbd64468aed3d3419bae97f79b0037eeb72e7dbc0b213",
+     "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+     "b7c52588d95c3b9aa25b0403f1eef75702e84bb7597aabe663b82f6f04ef2777"},
+    {"7bb9a6b7520c432393528decacd8b8d1751efb84b543f9564945f4b773b396b6", 28,
+     "b1f5fc4b765d0ade0555fdb24cacbd09cc52786141728d46e9996d06b55a4d1a",
+     "5ca5327d0033ad4b8838565eab23c7461a4586b14c5b231d97388c5043080e97",
+     "8318535b54105d4a7aae60c08fc45f9687181b4fdfc625bd1a753fa7397fed75"
+     "3547f11ca8696646f2f3acb08e31016afac23e630c5d11f59f61fef57b0d2aa5"},
+};
+
+uint256 from_hex(const char *hex_str) {
+  return uint256(as_bytes32(unhex(hex_str)));
+}
+
+uint256 random_u256(std::mt19937_64 &rng) {
+  return uint256((__uint128_t(rng()) << 64) | rng(),
+                 (__uint128_t(rng()) << 64) | rng());
+}
+
+std::pair<uint256, uint256> to_affine(const crypto::detail::JacobianPoint &p) {
+  const auto &z_inverse = p.z.inverse();
+  return {(p.x * z_inverse.square()).to_uint256(),
+          (p.y * z_inverse.square() * z_inverse).to_uint256()};
+}
+
+} // namespace
+
+TEST(Secp256k1Test, RecoverKnownSignatures) {
+  for (const auto &vec : SIGNATURE_VECTORS) {
+    const bytes32 &hash = from_hex(vec.hash).bytes();
+    const uint256 &r = from_hex(vec.r);
+    const uint256 &s = from_hex(vec.s);
+    const auto &key = recover_public_key(hash, vec.v, r, s);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(hex(std::vector<uint8_t>(key->begin(), key->end())),
+              vec.public_key);
+
+    // the mock keccak256 is not the real hash, so the address is only
+    // checked to come from the recovered key
+    const Address &signer = public_key_to_address(*key);
+    EXPECT_EQ(ecrecover(hash, vec.v, r, s), signer);
+    EXPECT_TRUE(verify_signature(hash, vec.v, r, s, signer));
+    // the other parity recovers some other key
+    EXPECT_FALSE(verify_signature(hash, 55 - vec.v, r, s, signer));
+    // the malleable (n - s, flipped v) twin recovers the same key, but
+    // verify_signature only accepts the low s form
+    const uint256 &high_s = crypto::detail::Fn::P - s;
+    EXPECT_EQ(ecrecover(hash, 55 - vec.v, r, high_s), signer);
+    EXPECT_FALSE(verify_signature(hash, 55 - vec.v, r, high_s, signer));
+  }
+}
+
+TEST(Secp256k1Test, RejectInvalidSignatures) {
+  const auto &vec = SIGNATURE_VECTORS[0];
+  const bytes32 &hash = from_hex(vec.hash).bytes();
+  const uint256 &r = from_hex(vec.r);
+  const uint256 &s = from_hex(vec.s);
+  const uint256 &n = crypto::detail::Fn::P;
+  EXPECT_FALSE(recover_public_key(hash, 0, r, s).has_value());
+  EXPECT_FALSE(recover_public_key(hash, 29, r, s).has_value());
+  EXPECT_FALSE(recover_public_key(hash, 27, uint256(0), s).has_value());
+  EXPECT_FALSE(recover_public_key(hash, 27, r, uint256(0)).has_value());
+  EXPECT_FALSE(recover_public_key(hash, 27, n, s).has_value());
+  EXPECT_FALSE(recover_public_key(hash, 27, r, n).has_value());
+  // x = 5 is not on the curve: 5^3 + 7 is not a square mod p
+  EXPECT_FALSE(recover_public_key(hash, 27, uint256(5), s).has_value());
+  EXPECT_EQ(ecrecover(hash, 27, uint256(5), s), Address::zero());
+  EXPECT_FALSE(verify_signature(hash, 27, uint256(5), s, Address::zero()));
+}
+
+TEST(Secp256k1Test, GeneratorTableMatchesPointMultiplication) {
+  using crypto::detail::Fn;
+  const auto &g = crypto::detail::generator_multiple(0, 1);
+  std::mt19937_64 rng(13);
+  std::vector<uint256> scalars = {uint256(1), uint256(8), uint256(9),
+                                  uint256(0x88), Fn::P - uint256(1),
+                                  uint256::max() >> 4};
+  for (int i = 0; i < 16; i++) {
+    scalars.push_back(random_u256(rng) % Fn::P);
+  }
+  for (const uint256 &k : scalars) {
+    EXPECT_EQ(to_affine(crypto::detail::mul_generator(k)),
+              to_affine(crypto::detail::mul_point(g, k)));
+  }
+  EXPECT_TRUE(crypto::detail::mul_generator(Fn::P).is_infinity());
+  EXPECT_TRUE(crypto::detail::mul_point(g, Fn::P).is_infinity());
+}
+
+TEST(Secp256k1Test, RecoverRandomSignatures) {
+  using crypto::detail::Fn;
+  std::mt19937_64 rng(2612);
+  for (int i = 0; i < 8; i++) {
+    const uint256 &d = random_u256(rng) % Fn::P;
+    const uint256 &k = random_u256(rng) % Fn::P;
+    const bytes32 &hash = random_u256(rng).bytes();
+    // sign: r = (k * G).x, s = k^-1 * (e + r * d)
+    const auto &point = to_affine(crypto::detail::mul_generator(k));
+    const uint256 &r = point.first % Fn::P;
+    const Fn &s = Fn::from_uint256(k).inverse() *
+                  (Fn::from_uint256(uint256(hash)) +
+                   Fn::from_uint256(r) * Fn::from_uint256(d));
+    uint8_t v = 27 + uint8_t(point.second.low & 1);
+    const auto &key = recover_public_key(hash, v, r, s.to_uint256());
+    ASSERT_TRUE(key.has_value());
+    const auto &expected = to_affine(crypto::detail::mul_generator(d));
+    EXPECT_EQ(uint256(as_bytes32(std::vector<uint8_t>(key->begin(),
+                                                      key->begin() + 32))),
+              expected.first);
+    EXPECT_EQ(uint256(as_bytes32(std::vector<uint8_t>(key->begin() + 32,
+                                                      key->end()))),
+              expected.second);
+  }
+}
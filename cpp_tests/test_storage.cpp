@@ -28,6 +28,17 @@ TEST(StorageTest, BasicTestUint256) {
   }
 }
 
+TEST(StorageTest, BasicTestInt256) {
+  StorageSlot slot(1, 0);
+  clear_mock_storage();
+  {
+    int256 value = -123456789;
+    write_storage_value(slot, value);
+    int256 read_value = read_storage_value<int256>(slot);
+    EXPECT_EQ(value, read_value);
+  }
+}
+
 TEST(StorageTest, BasicTestString) {
   StorageSlot slot(2, 0);
   {
@@ -161,3 +172,166 @@ TEST(StorageTest, BasicTestStorageSlotOffset) {
   EXPECT_EQ(value2, decoded_value2);
   EXPECT_EQ(value3, decoded_value3);
 }
+
+TEST(StorageTest, BasicTestStorageSlotKey) {
+  clear_mock_storage();
+  const auto &key = as_bytes32(unhex(
+      "290decd9548b62a8d60345a988386fc84ba6bc95484008f6362f93160ef3e563"));
+  StorageSlot from_key(key, 0);
+  StorageSlot from_slot(uint256(key), 0);
+  EXPECT_EQ(from_key.get_slot(), from_slot.get_slot());
+  EXPECT_EQ(from_key.get_key(), from_slot.get_key());
+  EXPECT_EQ(bytesToHex(from_key.to_bytes32()),
+            "290decd9548b62a8d60345a988386fc84ba6bc95484008f6362f93160ef3e563");
+
+  uint256 value = uint256(__uint128_t(42), __uint128_t(7));
+  write_storage_value(from_key, value);
+  EXPECT_EQ(read_storage_value<uint256>(from_slot), value);
+  EXPECT_EQ(bytesToHex(hostio::read_storage(key)),
+            bytesToHex(value.bytes()));
+}
+
+TEST(StorageTest, BasicTestFixedPoint) {
+  clear_mock_storage();
+  StorageSlot slot(3, 0);
+  const ufixed18 &price = ufixed18::from_raw(uint256(1234500000000000000ull));
+  write_storage_value(slot, price);
+  EXPECT_EQ(read_storage_value<uint256>(slot), price.to_raw());
+  EXPECT_EQ(read_storage_value<ufixed18>(slot), price);
+
+  const sfixed18 &delta = sfixed18::from_raw(int256(-2500000000000000000ll));
+  write_storage_value(slot, delta);
+  EXPECT_EQ(read_storage_value<int256>(slot), delta.to_raw());
+  EXPECT_EQ(read_storage_value<sfixed18>(slot), delta);
+}
+
+TEST(StorageTest, MapKeySlot) {
+  // h(k) . p with the string key zero padded to 32 bytes, the slots
+  // contracts deployed with this SDK use
+  const StorageSlot map_slot(3, 0);
+  testing::internal::CaptureStdout();
+  const bytes32 &string_key_slot =
+      to_map_key_slot(map_slot, std::string("hello"));
+  const std::string slot_hex =
+      "0000000000000000000000000000000000000000000000000000000000000003";
+  EXPECT_NE(testing::internal::GetCapturedStdout().find(
+                "mock keccak256(68656c6c6f" + std::string(54, '0') +
+                slot_hex + ")"),
+            std::string::npos);
+  std::vector<uint8_t> expected_input = unpadded_string("hello");
+  expected_input.insert(expected_input.end(), map_slot.get_key().begin(),
+                        map_slot.get_key().end());
+  EXPECT_EQ(string_key_slot, hostio::keccak256(expected_input));
+  EXPECT_EQ(string_key_slot, detail::padded_string_map_key_slot(
+                                 map_slot, std::string("hello")));
+  // keys past the stack buffer and the empty key
+  for (const std::string &key : {std::string(300, 'k'), std::string()}) {
+    std::vector<uint8_t> input = unpadded_string(key);
+    input.insert(input.end(), map_slot.get_key().begin(),
+                 map_slot.get_key().end());
+    EXPECT_EQ(to_map_key_slot(map_slot, key), hostio::keccak256(input));
+  }
+
+  // DTVM_SOLIDITY_STRING_MAP_KEYS hashes the key unpadded
+  testing::internal::CaptureStdout();
+  const bytes32 &solidity_slot =
+      detail::solidity_string_map_key_slot(map_slot, std::string("hello"));
+  EXPECT_NE(testing::internal::GetCapturedStdout().find(
+                "mock keccak256(68656c6c6f" + slot_hex + ")"),
+            std::string::npos);
+  EXPECT_NE(solidity_slot, string_key_slot);
+  // a key of a multiple of 32 bytes is hashed the same either way
+  const std::string word_key(32, 'k');
+  EXPECT_EQ(detail::padded_string_map_key_slot(map_slot, word_key),
+            detail::solidity_string_map_key_slot(map_slot, word_key));
+
+  // value type keys are padded to 32 bytes
+  const Address owner("0x112233445566778899aa112233445566778899aa");
+  testing::internal::CaptureStdout();
+  to_map_key_slot(map_slot, owner);
+  const std::string owner_hex =
+      "000000000000000000000000112233445566778899aa112233445566778899aa";
+  EXPECT_NE(testing::internal::GetCapturedStdout().find(
+                "mock keccak256(" + owner_hex + slot_hex + ")"),
+            std::string::npos);
+  EXPECT_EQ(to_map_key_slot(map_slot, uint256(7)),
+            to_map_key_slot(map_slot, uint256(7).bytes()));
+}
+
+namespace {
+
+struct Position {
+  Address owner;
+  uint64_t expiry;
+  bool open;
+  __uint128_t amount;
+  std::array<uint8_t, 4> tag;
+};
+DTVM_ABI_STRUCT(Position, owner, expiry, open, amount, tag)
+
+struct Account {
+  uint8_t version;
+  Position position;
+  std::string name;
+  uint16_t count;
+};
+DTVM_ABI_STRUCT(Account, version, position, name, count)
+
+} // namespace
+
+TEST(StorageTest, StructSlotPacking) {
+  clear_mock_storage();
+  // owner, expiry and open share slot 0, amount does not fit after them
+  EXPECT_EQ(StorageStruct<Position>::SLOTS, size_t(2));
+  // the nested struct and the string start new slots, and so does the
+  // member after them
+  EXPECT_EQ(StorageStruct<Account>::SLOTS, size_t(5));
+
+  const Address owner("0x112233445566778899aa112233445566778899aa");
+  const Position position{
+      owner, 0x0102030405060708, true, 0x1234, {0xde, 0xad, 0xbe, 0xef}};
+  StorageStruct<Position> stored(StorageSlot(4, 0));
+  stored.set(position);
+  // the first member in the lowest bytes, as solidity lays out
+  // struct { address owner; uint64 expiry; bool open; uint128 amount;
+  // bytes4 tag; }
+  EXPECT_EQ(bytesToHex(hostio::read_storage(uint256(4))),
+            "0000000101020304050607081122334455667788"
+            "99aa112233445566778899aa");
+  EXPECT_EQ(bytesToHex(hostio::read_storage(uint256(5))),
+            "000000000000000000000000deadbeef"
+            "00000000000000000000000000001234");
+
+  const Position &loaded = stored.get();
+  EXPECT_EQ(loaded.owner, owner);
+  EXPECT_EQ(loaded.expiry, uint64_t(0x0102030405060708));
+  EXPECT_TRUE(loaded.open);
+  EXPECT_TRUE(loaded.amount == __uint128_t(0x1234));
+  EXPECT_EQ(loaded.tag, position.tag);
+
+  // one member, the others in its slot stay
+  stored.set<&Position::open>(false);
+  EXPECT_FALSE(stored.get<&Position::open>());
+  EXPECT_EQ(stored.get<&Position::expiry>(), uint64_t(0x0102030405060708));
+  EXPECT_EQ(stored.get<&Position::owner>(), owner);
+
+  // nested structs and strings through StorageValue and StorageMap
+  const Account account{2, position, "alice", 7};
+  StorageMap<Address, Account> accounts(StorageSlot(6, 0));
+  accounts.set(owner, account);
+  const StorageSlot account_slot(to_map_key_slot(StorageSlot(6, 0), owner),
+                                 0);
+  const uint256 &base = account_slot.get_slot();
+  EXPECT_EQ(hostio::read_storage(base)[31], uint8_t(2));
+  EXPECT_EQ(read_storage_value<std::string>(StorageSlot(base + uint256(3), 0)),
+            "alice");
+  EXPECT_EQ(hostio::read_storage(base + uint256(4))[31], uint8_t(7));
+
+  const Account &loaded_account = StorageValue<Account>(account_slot).get();
+  EXPECT_EQ(loaded_account.version, uint8_t(2));
+  EXPECT_EQ(loaded_account.position.owner, owner);
+  EXPECT_EQ(loaded_account.position.tag, position.tag);
+  EXPECT_EQ(loaded_account.name, "alice");
+  EXPECT_EQ(loaded_account.count, uint16_t(7));
+  EXPECT_EQ(accounts.get(owner).position.expiry, position.expiry);
+}
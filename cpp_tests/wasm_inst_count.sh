@@ -0,0 +1,46 @@
+#!/bin/bash
+# Build wasm_kernels.cpp once per uint256 backend and print the static wasm
+# instruction count of every kernel, plus how many calls it makes (calls
+# into compiler-rt such as __multi3 or __lshrti3 are extra cost on top).
+# secp256k1_fp_mul_u128 is the Montgomery multiplication written on
+# __uint128_t, the baseline the mul64 based secp256k1_fp_mul is compared to.
+# Requires em++ (emscripten 3.1.69+) and wasm-objdump (wabt) in PATH.
+set -e
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+OUT_DIR="$SCRIPT_DIR/build/wasm_inst_count"
+mkdir -p "$OUT_DIR"
+
+KERNELS='["_u256_add","_u256_sub","_u256_mul","_u256_shl","_u256_shr","_u256_lt","_u256_div","_secp256k1_fp_mul","_secp256k1_fp_mul_u128","_secp256k1_recover"]'
+
+for backend in U128:1 LIMB64:2 BITINT:3; do
+  name=${backend%%:*}
+  value=${backend##*:}
+  wasm_file="$OUT_DIR/uint256_$name.wasm"
+  if ! em++ -std=c++17 -O3 -DDTVM_UINT256_BACKEND=$value -I "$SCRIPT_DIR/.." \
+      "$SCRIPT_DIR/wasm_kernels.cpp" -o "$wasm_file" --no-entry \
+      -s EXPORTED_FUNCTIONS="$KERNELS" -Wl,--allow-undefined \
+      -s ERROR_ON_UNDEFINED_SYMBOLS=0 -s STANDALONE_WASM=0 2>/dev/null; then
+    echo "backend $name: not supported by this compiler, skipped"
+    continue
+  fi
+  echo "backend $name:"
+  # function headers look like "000123 func[5] <u256_add>:", instruction
+  # lines like " 000124: 20 00 | local.get 0"
+  wasm-objdump -d "$wasm_file" | awk '
+    /^[0-9a-f]+ func\[[0-9]+\] </ {
+      name = $3
+      gsub(/[<>:]/, "", name)
+      next
+    }
+    /^ [0-9a-f]+:/ && name ~ /^(u256_|secp256k1_)/ {
+      if ($0 ~ /\| local\[/) next
+      insts[name]++
+      if ($0 ~ /\| call /) calls[name]++
+    }
+    END {
+      for (n in insts) {
+        printf "  %-22s %5d instructions %3d calls\n", n, insts[n], calls[n]
+      }
+    }' | sort
+done
@@ -0,0 +1,104 @@
+// Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// uint256 kernels exported one per function, compiled to wasm by
+// wasm_inst_count.sh to compare the instruction cost of the backends
+
+#include <contractlib/v1/math.hpp>
+#include <contractlib/v1/secp256k1.hpp>
+
+using dtvm::uint256;
+
+namespace {
+
+// The Montgomery multiplication as it was written on __uint128_t, kept as the
+// baseline of secp256k1_fp_mul: wasm32 lowers every product to a __multi3 call
+dtvm::detail::Limbs4 montgomery_mul_u128(const dtvm::detail::Limbs4 &a,
+                                         const dtvm::detail::Limbs4 &b,
+                                         const dtvm::detail::Limbs4 &p,
+                                         uint64_t n0) {
+  uint64_t t[6] = {};
+  for (int i = 0; i < 4; i++) {
+    __uint128_t cur = 0;
+    for (int j = 0; j < 4; j++) {
+      cur = __uint128_t(a[j]) * b[i] + t[j] + uint64_t(cur >> 64);
+      t[j] = uint64_t(cur);
+    }
+    cur = __uint128_t(t[4]) + uint64_t(cur >> 64);
+    t[4] = uint64_t(cur);
+    t[5] = uint64_t(cur >> 64);
+
+    uint64_t m = t[0] * n0;
+    cur = __uint128_t(m) * p[0] + t[0];
+    for (int j = 1; j < 4; j++) {
+      cur = __uint128_t(m) * p[j] + t[j] + uint64_t(cur >> 64);
+      t[j - 1] = uint64_t(cur);
+    }
+    cur = __uint128_t(t[4]) + uint64_t(cur >> 64);
+    t[3] = uint64_t(cur);
+    t[4] = t[5] + uint64_t(cur >> 64);
+  }
+  dtvm::detail::Limbs4 result = {t[0], t[1], t[2], t[3]};
+  if (t[4] != 0 || !dtvm::detail::limbs_less(result, p)) {
+    dtvm::detail::limbs_sub(result, p, result);
+  }
+  return result;
+}
+
+} // namespace
+
+extern "C" {
+void u256_add(const uint256 *a, const uint256 *b, uint256 *result) {
+  *result = *a + *b;
+}
+
+void u256_sub(const uint256 *a, const uint256 *b, uint256 *result) {
+  *result = *a - *b;
+}
+
+void u256_mul(const uint256 *a, const uint256 *b, uint256 *result) {
+  *result = *a * *b;
+}
+
+void u256_shl(const uint256 *a, uint32_t shift, uint256 *result) {
+  *result = *a << shift;
+}
+
+void u256_shr(const uint256 *a, uint32_t shift, uint256 *result) {
+  *result = *a >> shift;
+}
+
+int32_t u256_lt(const uint256 *a, const uint256 *b) { return *a < *b; }
+
+void u256_div(const uint256 *a, const uint256 *b, uint256 *result) {
+  *result = *a / *b;
+}
+
+// both take and return Montgomery limbs, so only the multiplication is counted
+void secp256k1_fp_mul(const dtvm::detail::Limbs4 *a,
+                      const dtvm::detail::Limbs4 *b,
+                      dtvm::detail::Limbs4 *result) {
+  using Fp = dtvm::secp256k1_fp;
+  *result = (Fp::from_montgomery_limbs(*a) * Fp::from_montgomery_limbs(*b))
+                .montgomery_limbs();
+}
+
+void secp256k1_fp_mul_u128(const dtvm::detail::Limbs4 *a,
+                           const dtvm::detail::Limbs4 *b,
+                           dtvm::detail::Limbs4 *result) {
+  constexpr dtvm::detail::Limbs4 P =
+      dtvm::detail::to_limbs(dtvm::Secp256k1FieldParams::P);
+  *result = montgomery_mul_u128(*a, *b, P, dtvm::detail::montgomery_n0(P[0]));
+}
+
+int32_t secp256k1_recover(const dtvm::bytes32 *hash, uint8_t v,
+                          const uint256 *r, const uint256 *s,
+                          dtvm::crypto::PublicKey *public_key) {
+  const auto &key = dtvm::crypto::recover_public_key(*hash, v, *r, *s);
+  if (!key) {
+    return 0;
+  }
+  *public_key = *key;
+  return 1;
+}
+}
@@ -69,11 +69,11 @@ protected:
     }
 
     CResult totalSupply() override {
-        return Ok(this->totalSupply_->get());
+        return finish_encoded(this->totalSupply_->get());
     }
 
     CResult decimals() override {
-        return Ok(this->decimals_->get());
+        return finish_encoded(this->decimals_->get());
     }
 
     CResult name() override {
@@ -85,15 +85,17 @@ protected:
     }
 
     CResult balanceOf(const Address &owner) override {
-        uint256 bal = this->balances_->get(owner);
-        return Ok(bal);
+        // encoded on the stack and handed to the host, no heap allocation
+        return finish_encoded(this->balances_->get(owner));
     }
 
     CResult mint(const Address& owner, const uint256& amount) override {
         uint256 total_supply = this->totalSupply_->get();
-        this->totalSupply_->set(total_supply + amount);
+        // reverts with Panic(0x11) on overflow like solidity 0.8
+        this->totalSupply_->set(checked_add(total_supply, amount));
         uint256 owner_bal = this->balances_->get(owner);
-        this->balances_->set(owner, owner_bal + amount);
+        // a balance never exceeds the total supply checked above
+        this->balances_->set(owner, unchecked_add(owner_bal, amount));
         emitTransfer(Address::zero(), owner, amount);
         return Ok();
     }
@@ -104,9 +106,9 @@ protected:
         if (sender_bal < amount) {
             return Revert("balance not enough");
         }
-        this->balances_->set(sender, sender_bal - amount);
+        this->balances_->set(sender, unchecked_sub(sender_bal, amount));
         uint256 to_bal = this->balances_->get(to);
-        this->balances_->set(to, to_bal + amount);
+        this->balances_->set(to, unchecked_add(to_bal, amount));
         emitTransfer(sender, to, amount);
         return Ok();
     }
@@ -114,7 +116,7 @@ protected:
     CResult approve(const Address &spender, const uint256& amount) override {
         const auto& owner = get_msg_sender();
         uint256 allowance = this->allowance_->get<Address, uint256>(owner, spender);
-        this->allowance_->set(owner, spender, allowance + amount);
+        this->allowance_->set(owner, spender, checked_add(allowance, amount));
         emitApproval(owner, spender, amount);
         return Ok();
     }
@@ -125,15 +127,15 @@ protected:
         if (allowance < amount) {
             return Revert("allowance not enough");
         }
-        this->allowance_->set(from, spender, allowance - amount);
+        this->allowance_->set(from, spender, unchecked_sub(allowance, amount));
 
         uint256 from_bal = this->balances_->get(from);
         if (from_bal < amount) {
             return Revert("balance not enough");
         }
-        this->balances_->set(from, from_bal - amount);
+        this->balances_->set(from, unchecked_sub(from_bal, amount));
         uint256 to_bal = this->balances_->get(to);
-        this->balances_->set(to, to_bal + amount);
+        this->balances_->set(to, unchecked_add(to_bal, amount));
         emitTransfer(from, to, amount);
         return Ok();
     }
@@ -25,9 +25,8 @@ public:
         addr_ = addr;
     }
     inline dtvm::CResult balanceOf(dtvm::CallInfoPtr call_info, const dtvm::Address& owner) override {
-        std::vector<uint8_t> encoded_input = { 112, 160, 130, 49 }; // 1889567281, function selector bytes, balanceOf(address)
-        std::vector<uint8_t> encoded_args = dtvm::abi_encode(std::make_tuple(owner));
-        encoded_input.insert(encoded_input.end(), encoded_args.begin(), encoded_args.end());
+        const std::vector<uint8_t> encoded_input =
+            dtvm::abi_encode_call(DTVM_SELECTOR("balanceOf(address)"), owner);
         return dtvm::call(addr_, encoded_input, call_info->value, call_info->gas);
     }
     virtual dtvm::CResult balanceOf(const dtvm::Address &owner) {
@@ -78,8 +77,9 @@ public:
 
 protected:
     inline void emitTransfer(dtvm::Address from, dtvm::Address to, dtvm::uint256 amount) {
-        const std::vector <uint8_t> topic1 = { 221, 242, 82, 173 }; // 3723645613, Transfer(address,address,uint256)
-        const std::vector <uint8_t> data = dtvm::abi_encode(std::make_tuple(from, to, amount));
+        constexpr dtvm::bytes32 topic1_hash = DTVM_EVENT_TOPIC("Transfer(address,address,uint256)");
+        const std::vector<uint8_t> topic1(topic1_hash.begin(), topic1_hash.end());
+        const std::vector <uint8_t> data = dtvm::abi_encode_args(from, to, amount);
         dtvm::hostio::emit_log({topic1}, data);
     }
 
@@ -111,12 +111,12 @@ public:
         dtvm::Input input(input_with_selector.data() + 4, input_with_selector.size() - 4);
         switch (selector) {
             
-            case 2326892680: { // selector of callOtherBalance
+            case DTVM_SELECTOR("callOtherBalance(address,address)"): {
                 return interface_callOtherBalance(call_info, input);
             }
                 break;
 
-            case 1889567281: { // selector of balanceOf
+            case DTVM_SELECTOR("balanceOf(address)"): {
                 return interface_balanceOf(call_info, input);
             }
                 break;
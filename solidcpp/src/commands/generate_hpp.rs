@@ -1,7 +1,10 @@
 // Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
-use crate::commands::sol_types_utils::transform_solidity_storage_type_to_cpp;
+use crate::commands::sol_types_utils::{
+    canonical_solidity_abi_type, transform_solidity_abi_type_to_cpp,
+    transform_solidity_storage_type_to_cpp,
+};
 use crate::commands::utils::with_prefix_comma_if_not_empty;
 use byteorder::ByteOrder;
 use serde_json::Value;
@@ -117,31 +120,14 @@ public:
                     abi_method_signature += ",";
                 }
 
-                let internal_type = input["internalType"].as_str().unwrap(); // address/uint256/(t1,t2...)...
-                abi_method_signature += internal_type;
-                let arg_type = input["type"].as_str().unwrap();
-                // TODO: If the ABI parameter is a custom struct, we also need to generate the corresponding C++ type
-                // for this custom struct, as well as the encoding and decoding functions.
+                // address/uint256/(t1,t2...)...
+                abi_method_signature += &canonical_solidity_abi_type(input);
+                // structs are std::tuple of their members
                 let mut arg_name: String = input["name"].as_str().unwrap().to_string();
                 if arg_name.is_empty() {
                     arg_name = format!("annoy_arg{input_index}");
                 }
-                let arg_type_cpp_mapping = HashMap::from([
-                    ("address", "Address"),
-                    ("uint256", "uint256"),
-                    ("uint128", "__uint128_t"),
-                    ("uint64", "uint64_t"),
-                    ("uint32", "uint32_t"),
-                    ("uint8", "uint8_t"),
-                    ("int256", "int256"),
-                    ("int128", "__int128_t"),
-                    ("int64", "int64_t"),
-                    ("int32", "int32_t"),
-                    ("int8", "int8_t"),
-                    ("bool", "bool"),
-                    ("string", "std::string"),
-                ]);
-                let arg_type_in_cpp = &format!("dtvm::{}", arg_type_cpp_mapping[&arg_type]);
+                let arg_type_in_cpp = &transform_solidity_abi_type_to_cpp(input);
                 args_cpp_buf += &format!("const {arg_type_in_cpp} &{arg_name}");
 
                 args_decode_cpp_buf += &format!(
@@ -166,10 +152,6 @@ public:
             hasher.update(abi_method_signature.as_bytes());
             let sig_bytes = hasher.finalize();
             let selector_bytes: [u8; 4] = sig_bytes[0..4].try_into().unwrap();
-            let selector_bytes_cpp_vector_code = &format!(
-                "{{ {}, {}, {}, {} }}",
-                selector_bytes[0], selector_bytes[1], selector_bytes[2], selector_bytes[3]
-            );
             // println!("selector hex: {}", hex::encode(selector_bytes));
             let selector: u32 = byteorder::BigEndian::read_u32(&selector_bytes);
             // println!("method {abi_method_signature} selector {selector}");
@@ -210,9 +192,8 @@ protected:
                     proxy_cls_buf += &format!(
                         r#"
   inline dtvm::CResult {abi_name}(dtvm::CallInfoPtr call_info {args_cpp_buf_with_prefix_comma}) override {{
-      std::vector<uint8_t> encoded_input = {selector_bytes_cpp_vector_code}; // {selector}, function selector bytes, {abi_method_signature}
-      std::vector<uint8_t> encoded_args = dtvm::abi_encode(std::make_tuple({all_params_name_list_cpp_buf}));
-      encoded_input.insert(encoded_input.end(), encoded_args.begin(), encoded_args.end());
+      // {selector}, function selector, {abi_method_signature}
+      const std::vector<uint8_t> encoded_input = dtvm::abi_encode_call({selector}u{all_params_name_list_cpp_buf_with_prefix_comma});
       return dtvm::call(addr_, encoded_input, call_info->value, call_info->gas);
   }}
   inline dtvm::CResult {abi_name}({args_cpp_buf}) override {{
@@ -222,18 +203,11 @@ protected:
                     );
                 }
                 "event" => {
-                    // Generate the hash of this event's function signature as topic1
-                    let mut event_topic_cpp_code: String = "".to_string();
-                    for (i, b) in selector_bytes.iter().enumerate() {
-                        if i > 0 {
-                            event_topic_cpp_code += ", ";
-                        }
-                        let b_str = format!("{b}");
-                        event_topic_cpp_code += &b_str;
-                    }
+                    // The whole hash of this event's signature as topic0, hashed at compile time
                     let mut topics_set_code = format!(
                         r#"
-      const std::vector <uint8_t> topic0 = {{ {event_topic_cpp_code} }}; // {selector}, {abi_method_signature}
+      constexpr dtvm::bytes32 topic0_hash = DTVM_EVENT_TOPIC("{abi_method_signature}");
+      const std::vector<uint8_t> topic0(topic0_hash.begin(), topic0_hash.end());
                     "#
                     );
                     let mut topics_vars_array_code = "{topic0".to_string();
@@ -253,7 +227,7 @@ protected:
 protected:
   inline void emit{abi_name}({args_cpp_buf}) {{
       {topics_set_code}
-      const std::vector <uint8_t> data = dtvm::abi_encode(std::make_tuple({all_params_name_list_cpp_buf}));
+      const std::vector <uint8_t> data = dtvm::abi_encode_args({all_params_name_list_cpp_buf});
       dtvm::hostio::emit_log({topics_vars_array_code}, data);
   }}
 "#
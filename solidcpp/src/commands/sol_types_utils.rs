@@ -1,6 +1,7 @@
 // Copyright (C) 2024-2025 the DTVM authors. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+use serde_json::Value;
 use std::collections::HashMap;
 
 fn parse_type(solidity_type: &str) -> String {
@@ -65,6 +66,81 @@ pub fn transform_solidity_storage_type_to_cpp(solidity_type: &str) -> String {
     parse_type(solidity_type)
 }
 
+fn abi_type_to_cpp(abi_type: &str, param: &Value) -> String {
+    // T[] and T[N], the last brackets are the outermost dimension
+    if let Some(element_type) = abi_type.strip_suffix(']') {
+        let open_pos = element_type.rfind('[').unwrap();
+        let element_cpp = abi_type_to_cpp(&element_type[..open_pos], param);
+        let length = &element_type[open_pos + 1..];
+        if length.is_empty() {
+            return format!("std::vector<{element_cpp}>");
+        }
+        return format!("std::array<{element_cpp}, {length}>");
+    }
+    if abi_type == "tuple" {
+        let components = param["components"]
+            .as_array()
+            .unwrap()
+            .iter()
+            .map(transform_solidity_abi_type_to_cpp)
+            .collect::<Vec<_>>()
+            .join(", ");
+        return format!("std::tuple<{components}>");
+    }
+    match abi_type {
+        "address" => return "dtvm::Address".to_string(),
+        "bool" => return "bool".to_string(),
+        "string" => return "std::string".to_string(),
+        "bytes" => return "dtvm::Bytes".to_string(),
+        "bytes32" => return "dtvm::bytes32".to_string(),
+        "uint256" => return "dtvm::uint256".to_string(),
+        "int256" => return "dtvm::int256".to_string(),
+        _ => {}
+    }
+    if let Some(size) = abi_type.strip_prefix("bytes") {
+        return format!("std::array<uint8_t, {size}>");
+    }
+    // uintN and intN in the smallest integer type that holds them
+    let (prefix, bits) = if let Some(bits) = abi_type.strip_prefix("uint") {
+        ("u", bits)
+    } else if let Some(bits) = abi_type.strip_prefix("int") {
+        ("", bits)
+    } else {
+        panic!("unknown abi type: {}", abi_type);
+    };
+    match bits.parse::<u32>().unwrap() {
+        0..=8 => format!("{prefix}int8_t"),
+        9..=16 => format!("{prefix}int16_t"),
+        17..=32 => format!("{prefix}int32_t"),
+        33..=64 => format!("{prefix}int64_t"),
+        65..=128 => format!("__{prefix}int128_t"),
+        _ => format!("dtvm::{prefix}int256"),
+    }
+}
+
+// The C++ type of an ABI parameter or component, e.g. uint256[] is
+// std::vector<dtvm::uint256> and a struct is a std::tuple of its members
+pub fn transform_solidity_abi_type_to_cpp(param: &Value) -> String {
+    abi_type_to_cpp(param["type"].as_str().unwrap(), param)
+}
+
+// The type as written in a function signature, structs expand to the tuple
+// of their members
+pub fn canonical_solidity_abi_type(param: &Value) -> String {
+    let abi_type = param["type"].as_str().unwrap();
+    if let Some(array_suffix) = abi_type.strip_prefix("tuple") {
+        let components = param["components"]
+            .as_array()
+            .unwrap()
+            .iter()
+            .map(canonical_solidity_abi_type)
+            .collect::<Vec<_>>()
+            .join(",");
+        return format!("({components}){array_suffix}");
+    }
+    abi_type.to_string()
+}
+
 #[test]
 fn test_nested_mapping_transform() {
     let input = "t_mapping(t_address,t_mapping(t_address,t_uint256))";
@@ -103,3 +179,54 @@ fn test_simple_type_transform() {
         assert_eq!(output, "dtvm::StorageArray<uint32_t>");
     }
 }
+
+#[test]
+fn test_abi_type_transform() {
+    let param = |abi_type: &str| serde_json::json!({ "type": abi_type });
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("uint256")),
+        "dtvm::uint256"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("uint24")),
+        "uint32_t"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("int128")),
+        "__int128_t"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("string")),
+        "std::string"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("bytes")),
+        "dtvm::Bytes"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("bytes32")),
+        "dtvm::bytes32"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("bytes4")),
+        "std::array<uint8_t, 4>"
+    );
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&param("uint256[][2]")),
+        "std::array<std::vector<dtvm::uint256>, 2>"
+    );
+
+    let order = serde_json::json!({
+        "type": "tuple[]",
+        "internalType": "struct Order[]",
+        "components": [
+            { "type": "address" },
+            { "type": "string[]" },
+        ],
+    });
+    assert_eq!(
+        transform_solidity_abi_type_to_cpp(&order),
+        "std::vector<std::tuple<dtvm::Address, std::vector<std::string>>>"
+    );
+    assert_eq!(canonical_solidity_abi_type(&order), "(address,string[])[]");
+}